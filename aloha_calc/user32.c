@@ -246,6 +246,7 @@ void sound_makesilence();
 bool compare_signed( String target_str, uint32 length, uint32 status_nzcv );
 bool compare_unsigned( String target_str, uint32 length, uint32 status_nzcv );
 bool timer_routine();
+bool rate_reporter( uint32 length, uint32 time );
 
 /* Variables on Global Scope */
 dictionary label_list;
@@ -276,6 +277,7 @@ int32 _user_start() {
 	obj buffer_line = heap32_malloc( UART32_UARTMALLOC_MAXROW + 1 / 4 ); // Add for Null Character
 	uint32 length_arg = 0;
 	uint32 length_temp = 0;
+	uint32 length_rom = 0; // Bytes Saved or Loaded
 	uint32 src_index = 0;
 	uint32 current_line = 0;
 	uint32 status_nzcv = 0;
@@ -1089,11 +1091,16 @@ int32 _user_start() {
 								var_temp3.u32 += var_temp2.u32; // End Point
 								if ( var_temp3.u32 > UART32_UARTMALLOC_LENGTH ) var_temp3.u32 = UART32_UARTMALLOC_LENGTH;
 								var_temp4.u32 = _load_32( array_source + 8 ); // Chip Select
+								length_rom = 0;
+								_stopwatch_start();
 								for ( uint32 i = var_temp2.u32; i < var_temp3.u32; i++ ) {
 									_uartsetheap( i );
-									if ( _romwrite_i2c( (obj)UART32_UARTINT_HEAP, var_temp4.u32, var_temp.u32, str32_strlen( UART32_UARTINT_HEAP ) + 1 ) ) break; // Add One for Null
+									length_temp = str32_strlen( UART32_UARTINT_HEAP ) + 1; // Add One for Null
+									if ( _romwrite_i2c( (obj)UART32_UARTINT_HEAP, var_temp4.u32, var_temp.u32, length_temp ) ) break;
+									length_rom += length_temp;
 									var_temp.u32 += UART32_UARTMALLOC_MAXROW + 1; // Add One for Null Character
 								}
+								rate_reporter( length_rom, (uint32)_stopwatch_end() );
 
 								break;
 							case load:
@@ -1104,13 +1111,17 @@ int32 _user_start() {
 								var_temp3.u32 += var_temp2.u32; // End Point
 								if ( var_temp3.u32 > UART32_UARTMALLOC_LENGTH ) var_temp3.u32 = UART32_UARTMALLOC_LENGTH;
 								var_temp4.u32 = _load_32( array_source + 8 ); // Chip Select
+								length_rom = 0;
+								_stopwatch_start();
 								for ( uint32 i = var_temp2.u32; i < var_temp3.u32; i++ ) {
 									_uartsetheap( i );
 									if ( _romread_i2c( buffer_line, var_temp4.u32, var_temp.u32, UART32_UARTMALLOC_MAXROW ) ) break; // Stay Null Character at End
+									length_rom += UART32_UARTMALLOC_MAXROW;
 									heap32_mcopy( (obj)UART32_UARTINT_HEAP, 0, buffer_line, 0, str32_strlen( (String)buffer_line ) + 1 ); // Add Null Character
 									line_clean( UART32_UARTINT_HEAP );
 									var_temp.u32 += UART32_UARTMALLOC_MAXROW + 1; // Add One for Null Character
 								}
+								rate_reporter( length_rom, (uint32)_stopwatch_end() );
 								current_line = UART32_UARTMALLOC_NUMBER - 1; // Next Line Becomes Last Line to Be Loaded
 
 								break;
@@ -1821,14 +1832,18 @@ bool process_counter() {
 
 bool text_sender( String target_str ) {
 	uint32 length = str32_strlen( target_str );
-	_uarttx( target_str, length );
 
-	return true;
+	return text_sender_length( target_str, length );
 }
 
 
 bool text_sender_length( String target_str, uint32 length ) {
-	_uarttx( target_str, length );
+	uint32 remain;
+	while ( length ) {
+		remain = _uarttxqueue( target_str, length ); // Retry on Full Ring Buffer
+		target_str += length - remain;
+		length = remain;
+	}
 
 	return true;
 }
@@ -2111,6 +2126,7 @@ bool compare_unsigned( String target_str, uint32 length, uint32 status_nzcv ) {
 
 
 bool timer_routine() {
+	_uartline( true ); // Edit Lines or Push to Client FIFO with Bytes Received by IRQ
 	if ( OS_FIQ_ONEFRAME ) {
 		_soundplay( mode_soundplay );
 		_gpioplay( gpio_output );
@@ -2119,3 +2135,18 @@ bool timer_routine() {
 	return true;
 }
 
+
+bool rate_reporter( uint32 length, uint32 time ) {
+	String str_rate;
+	float32 rate;
+
+	if ( ! time ) time = 1; // Prevent Division by Zero
+	rate = vfp32_fdiv( vfp32_u32tof32( length ), vfp32_u32tof32( time ) );
+	rate = vfp32_fmul( rate, 1000000.0 ); // Bytes per Microseconds to Bytes per Seconds
+	str_rate = cvt32_int32_to_string_deci( (int32)vfp32_f32tou32( rate ), 1, 0 );
+	text_sender( str_rate );
+	text_sender( " Bytes/s\r\n\0" );
+	heap32_mfree( (obj)str_rate );
+
+	return true;
+}
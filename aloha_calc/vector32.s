@@ -133,6 +133,17 @@ os_reset:
 	bl uart32_uartmalloc_client
 	pop {r0-r3}
 
+	push {r0-r3}
+	mov r0, #1024                                            @ 1024 Words, 4096 Bytes Ring Buffer for Transmit
+	mov r1, #256                                             @ 256 Words, Up to 256 Bytes Transmitted by DMA
+	bl uart32_uarttxmalloc
+	pop {r0-r3}
+
+	push {r0-r3}
+	mov r0, #256                                             @ 256 Words, 1024 Bytes Ring Buffer for Receive
+	bl uart32_uartrxmalloc
+	pop {r0-r3}
+
 	push {r0-r3}
 	mov r0, #0xF0           @ Divisor of Clock to Decimal 240 for 1MHz
 	mov r1, #0x0030         @ Delay
@@ -174,11 +185,6 @@ os_irq:
 os_fiq:
 	push {r0-r7,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_armtimer_base
 
@@ -10,6 +10,9 @@
 /* Define Debug Status */
 /*.equ __DEBUG, 1*/
 
+/* Loopback Test of dmx32_dmx512dma_rx and dmx32_dmx512dma_tx in os_debug, Needs __DEBUG */
+/*.equ __LOOPBACK, 1*/
+
 .include "system32/equ32.s"
 .include "system32/macro32.s"
 
@@ -143,8 +146,139 @@ OS_RESET_DMX512_CHANNEL: .word 0x00                                    @ DMX512
 
 os_debug:
 	push {lr}
+
+.ifdef __LOOPBACK
+	/**
+	 * UART Loopback for One Second, Packets Sent by DMA Are Received by DMA
+	 * Shows: Received Packets, Microseconds in dmx32_dmx512dma_rx (CPU Load in PPM), Discarded Packets, Sent Packets,
+	 * Slots of Last Packet, Slots Not Matched with Sent Packet
+	 */
+	push {r4-r8}
+
+	mov r0, #1                                                     @ Start Code
+	add r0, r0, #512                                               @ Channel Length
+	bl dmx32_dmx512dma_init
+	cmp r0, #0
+	bne os_debug_loopback_common
+
+	/* Start Code 0, Slot N Is N & 0xFF */
+	ldr r0, ADDR32_DMX32_BUFFER_FRONT
+	ldr r0, [r0]
+	ldr r1, ADDR32_DMX32_BUFFER_LENGTH
+	ldr r1, [r1]
+	mov r2, #0
+	os_debug_loopback_fill:
+		strb r2, [r0, r2]
+		add r2, r2, #1
+		cmp r2, r1
+		blo os_debug_loopback_fill
+
+	mov r0, #1                                                     @ Integer Divisor Bit[15:0], 7500000 / (16 * 250000) is 1.875
+	mov r1, #0b111000                                              @ Fractional Divisor Bit[5:0], Fixed Point Float 0.875
+	mov r2, #0b11<<equ32_uart0_lcrh_wlen|equ32_uart0_lcrh_fen|equ32_uart0_lcrh_stp2 @ Line Control
+	mov r3, #equ32_uart0_cr_rxe|equ32_uart0_cr_txe                 @ Control
+	bl uart32_uartinit
+
+	mov r0, #0                                                     @ Test Data Off
+	mov r1, #1                                                     @ Tx On
+	mov r2, #1                                                     @ Rx On
+	mov r3, #1                                                     @ Loopback On
+	bl uart32_uartsettest
+
+	mov r0, #0                                                     @ Polling
+	bl dmx32_dmx512dma_rxinit
+	cmp r0, #0
+	bne os_debug_loopback_restore
+
+	mov r4, #equ32_peripherals_base
+	add r4, r4, #equ32_systemtimer_base
+	ldr r5, [r4, #equ32_systemtimer_counter_lower]                 @ Start
+	ldr r6, ADDR32_DMX32_DMA_RXTIME
+	ldr r6, [r6]
+	ldr r7, ADDR32_DMX32_DMA_RXCOUNT
+	ldr r7, [r7]
+
+	os_debug_loopback_loop:
+		mov r0, #0                                                 @ Send FRONT, No Swap
+		bl dmx32_dmx512dma_tx
+		bl dmx32_dmx512dma_rx
+		ldr r0, [r4, #equ32_systemtimer_counter_lower]
+		sub r0, r0, r5
+		ldr r1, os_debug_loopback_duration
+		cmp r0, r1
+		blo os_debug_loopback_loop
+
+	ldr r0, ADDR32_DMX32_DMA_RXCOUNT
+	ldr r0, [r0]
+	sub r0, r0, r7
+	macro32_debug r0, 0, 84                                        @ Packets per Second
+	ldr r0, ADDR32_DMX32_DMA_RXTIME
+	ldr r0, [r0]
+	sub r0, r0, r6
+	macro32_debug r0, 0, 96                                        @ Microseconds per Second, CPU Load in PPM
+	ldr r0, ADDR32_DMX32_DMA_RXERROR
+	ldr r0, [r0]
+	macro32_debug r0, 0, 108
+	ldr r0, ADDR32_DMX32_DMA_COUNT
+	ldr r0, [r0]
+	macro32_debug r0, 0, 120
+
+	/* Compare Last Packet of Receiver with Source of Transmitter */
+	ldr r0, ADDR32_DMX32_DMA_RXBACK
+	ldr r0, [r0]
+	ldr r1, ADDR32_DMX32_BUFFER_FRONT
+	ldr r1, [r1]
+	ldr r2, ADDR32_DMX32_DMA_RXSLOTS
+	ldr r2, [r2]
+	macro32_debug r2, 0, 132
+	mov r3, #0
+	mov r8, #0
+	os_debug_loopback_compare:
+		cmp r3, r2
+		bhs os_debug_loopback_compare_common
+		ldrb r4, [r0, r3]
+		ldrb r5, [r1, r3]
+		cmp r4, r5
+		addne r8, r8, #1
+		add r3, r3, #1
+		b os_debug_loopback_compare
+
+	os_debug_loopback_compare_common:
+		macro32_debug r8, 0, 144                                   @ 0 as OK
+
+	/* Back to Receiver Only */
+	os_debug_loopback_restore:
+		mov r0, #equ32_dma32_channel_uart32
+		bl dma32_clear_channel
+		mov r0, #equ32_dma32_channel_dmx32_rx
+		bl dma32_clear_channel
+		mov r0, #equ32_peripherals_base
+		add r0, r0, #equ32_uart0_base_upper
+		add r0, r0, #equ32_uart0_base_lower
+		mov r1, #0
+		str r1, [r0, #equ32_uart0_dmacr]
+		str r1, [r0, #equ32_uart0_imsc]
+		mov r0, #0
+		mov r1, #0
+		mov r2, #1
+		mov r3, #0
+		bl uart32_uartsettest
+		mov r0, #1
+		mov r1, #0b111000
+		mov r2, #0b11<<equ32_uart0_lcrh_wlen|equ32_uart0_lcrh_fen|equ32_uart0_lcrh_stp2
+		mov r3, #equ32_uart0_cr_rxe
+		bl uart32_uartinit
+
+	os_debug_loopback_common:
+		pop {r4-r8}
+.endif
+
 	pop {pc}
 
+.ifdef __LOOPBACK
+os_debug_loopback_duration: .word 1000000                             @ Micro Seconds
+.endif
+
 os_irq:
 	push {r0-r12,lr}
 	pop {r0-r12,pc}
@@ -152,11 +286,6 @@ os_irq:
 os_fiq:
 	push {r0-r7,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	/* Clear Timer Interrupt */
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_armtimer_base
@@ -216,11 +216,6 @@ os_irq:
 os_fiq:
 	push {r0-r4,lr}                           @ r5-r7 is used across modes
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_armtimer_base
 
@@ -201,6 +201,58 @@ macro32_debug r1 0 60
 
 macro32_debug r0 0 72
 
+	/**
+	 * Check heap32_mcopy on Overlap over equ32_heap32_mcopy_dmathres in Privileged Mode
+	 * Destination is 0x100 bytes lower than source in the same memory space, word n is n before copy.
+	 * Shows 0 if all words are copied, otherwise the index of the first wrong word plus 1.
+	 */
+	mov r5, #equ32_heap32_mcopy_dmathres>>2
+	add r5, r5, #0x80                         @ Number of Words, 0x200 Bytes Over Threshold
+	mov r0, r5
+	bl heap32_malloc
+	cmp r0, #0
+	beq os_debug_mcopy_common
+	mov r6, r0
+
+	mov r1, #0
+	os_debug_mcopy_fill:
+		str r1, [r6, r1, lsl #2]
+		add r1, r1, #1
+		cmp r1, r5
+		blo os_debug_mcopy_fill
+
+	mov r0, #equ32_heap32_mcopy_dmathres
+	add r0, r0, #0x100
+	push {r0}                                 @ Length of Bytes to Be Copied
+	mov r0, r6
+	mov r1, #0
+	mov r2, r6
+	mov r3, #0x100
+	bl heap32_mcopy
+	add sp, sp, #4
+
+	mov r1, #0
+	sub r5, r5, #0x40                         @ Words Copied
+	os_debug_mcopy_check:
+		ldr r2, [r6, r1, lsl #2]
+		add r3, r1, #0x40                     @ Word Index of Source
+		cmp r2, r3
+		bne os_debug_mcopy_check_common
+		add r1, r1, #1
+		cmp r1, r5
+		blo os_debug_mcopy_check
+		mvn r1, #0                            @ All Copied
+
+		os_debug_mcopy_check_common:
+			add r1, r1, #1
+
+macro32_debug r1 0 84
+
+	mov r0, r6
+	bl heap32_mfree
+
+	os_debug_mcopy_common:
+
 	pop {r0-r8,pc}
 
 os_irq:
@@ -212,11 +212,6 @@ macro32_debug r0, 364, 324
 os_irq:
 	push {r0-r12,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_interrupt_base
 	ldr r1, [r0, #equ32_interrupt_pending_irqs2]
@@ -247,11 +242,6 @@ OS_IRQ_COUNT: .word 0x00
 os_fiq:
 	push {r0-r7,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	/* Clear Timer Interrupt */
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_armtimer_base
@@ -147,11 +147,6 @@ os_irq:
 os_fiq:
 	push {r0-r7,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	/* Clear Timer Interrupt */
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_armtimer_base
@@ -120,6 +120,20 @@ ADDR32_HID32_KEYBOARD_GET_101:         .word HID32_KEYBOARD_GET_101
 ADDR32_HID32_KEYBOARD_GET_SHIFT_101:   .word HID32_KEYBOARD_GET_SHIFT_101
 
 
+/**
+ * system32/library/dmx32.s
+ */
+
+ADDR32_DMX32_BUFFER_FRONT:     .word DMX32_BUFFER_FRONT
+ADDR32_DMX32_BUFFER_LENGTH:    .word DMX32_BUFFER_LENGTH
+ADDR32_DMX32_DMA_COUNT:        .word DMX32_DMA_COUNT
+ADDR32_DMX32_DMA_RXBACK:       .word DMX32_DMA_RXBACK
+ADDR32_DMX32_DMA_RXCOUNT:      .word DMX32_DMA_RXCOUNT
+ADDR32_DMX32_DMA_RXERROR:      .word DMX32_DMA_RXERROR
+ADDR32_DMX32_DMA_RXSLOTS:      .word DMX32_DMA_RXSLOTS
+ADDR32_DMX32_DMA_RXTIME:       .word DMX32_DMA_RXTIME
+
+
 /**
  * system32/library/font_mono_12px.s
  */
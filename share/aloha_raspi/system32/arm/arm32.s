@@ -419,6 +419,7 @@ arm32_cache_info:
  * function arm32_cache_operation_heap
  * Invalidate and Clean Cache by MVA Address in an Allocated Heap
  * Caution! This function is relevant to library/heap32.s
+ * The heap block is passed to arm32_cache_operation_range as one range.
  *
  * Parameters
  * r0: Pointer of Heap Block Allocated
@@ -438,29 +439,18 @@ arm32_cache_operation_heap:
 	beq arm32_cache_operation_heap_error
 
 	ldr block_size, [block_start, #-4]
-	add block_size, block_start, block_size
 	sub block_size, block_size, #4
 
-	bic block_start, block_start, #0x1F
-	bic block_size, block_size, #0x1F
-
-	arm32_cache_operation_heap_loop:
-		cmp block_start, block_size
-		bhi arm32_cache_operation_heap_success
-
-		cmp flag, #0
-		mcreq p15, 0, block_start, c7, c6, 1     @ Invalidate Data Cache to PoC by MVA
-		cmp flag, #1
-		mcreq p15, 0, block_start, c7, c10, 1    @ Clean Data Cache to PoC by MVA
-		cmp flag, #2
-		mcreq p15, 0, block_start, c7, c14, 1    @ Clean and Invalidate Data Cache to PoC by MVA
-		cmp flag, #3
-		mcreq p15, 0, block_start, c7, c11, 1    @ Clean Data Cache to PoU by MVA (FROM ARMv7)
-
-		macro32_dsb ip
+	push {lr}
+	push {block_start,block_size}             @ One Range (Start Address, Length)
+	mov r2, flag
+	mov r0, sp
+	mov r1, #1
+	bl arm32_cache_operation_range
+	add sp, sp, #8
+	pop {lr}
 
-		add block_start, block_start, #0x20      @ 32 Bytes (4 Words) Align
-		b arm32_cache_operation_heap_loop
+	b arm32_cache_operation_heap_success
 
 	arm32_cache_operation_heap_error:
 		mov r0, #1
@@ -477,6 +467,294 @@ arm32_cache_operation_heap:
 .unreq block_size
 
 
+/**
+ * function arm32_cache_operation_range
+ * Invalidate and Clean Data Cache by Ranges under One Barrier
+ * If the total length reaches ARM32_CACHE_CROSSOVER, cleaning is applied to the whole data cache instead of lines by MVA.
+ * Invalidation is always by lines by MVA, because the whole cache can't be invalidated without losing or writing back other data.
+ * In ARMv6, the whole cache is used automatically. From ARMv7, the whole cache is operated by set/way,
+ * which is applied to caches of the current core only, and isn't broadcasted to other cores as lines by MVA.
+ * So, from ARMv7, the whole cache is used only if bit[2] of the flag is set by a caller which knows other cores don't hold the data.
+ *
+ * Parameters
+ * r0: Pointer of Array of Ranges, Each Range Is Two Words (Start Address, Length of Bytes)
+ * r1: Number of Ranges
+ * r2: Flag, 0(Invalidate)/1(Clean to PoC)/2(Clean and Invalidate)/3(Clean to PoU: From ARMv7), Bit[2] Allows Whole Cache of Current Core (From ARMv7)
+ *
+ * Return: r0 (0 as Lines by MVA, 1 as Whole Cache)
+ */
+.globl arm32_cache_operation_range
+arm32_cache_operation_range:
+	/* Auto (Local) Variables, but just Aliases */
+	ranges      .req r0 @ Parameter, Register for Argument and Result, Scratch Register
+	number      .req r1 @ Parameter, Register for Argument
+	flag        .req r2 @ Parameter, Register for Argument
+	addr        .req r3
+	end         .req r4
+	total       .req r5
+	line        .req r6
+	count       .req r7
+
+	push {r4-r7,lr}
+
+	macro32_dsb ip                               @ Ensure Completion of Stores Before
+
+	mov total, #0
+	mov count, #0
+	arm32_cache_operation_range_sum:
+		cmp count, number
+		bhs arm32_cache_operation_range_sum_common
+		add addr, ranges, count, lsl #3
+		ldr addr, [addr, #4]
+		add total, total, addr
+		add count, count, #1
+		b arm32_cache_operation_range_sum
+
+	arm32_cache_operation_range_sum_common:
+		tst flag, #0x3
+		beq arm32_cache_operation_range_lines     @ Invalidation Is Only by Lines
+.ifndef __ARMV6
+		tst flag, #0x4
+		beq arm32_cache_operation_range_lines     @ Set/Way Is Not Broadcasted to Other Cores
+.endif
+		ldr addr, ARM32_CACHE_CROSSOVER
+		cmp addr, #0
+		beq arm32_cache_operation_range_lines     @ Zero Disables Whole Cache
+		cmp total, addr
+		bhs arm32_cache_operation_range_whole
+
+	arm32_cache_operation_range_lines:
+		and flag, flag, #0x3
+		ldr line, ARM32_CACHE_LINE
+		mov count, #0
+
+		arm32_cache_operation_range_lines_loop:
+			cmp count, number
+			bhs arm32_cache_operation_range_lines_success
+			ldr addr, [ranges, count, lsl #3]
+			add end, ranges, count, lsl #3
+			ldr end, [end, #4]
+			add count, count, #1
+			cmp end, #0
+			beq arm32_cache_operation_range_lines_loop
+			add end, addr, end
+			sub ip, line, #1
+			bic addr, addr, ip
+
+			arm32_cache_operation_range_lines_loop_mva:
+				cmp flag, #0
+				mcreq p15, 0, addr, c7, c6, 1     @ Invalidate Data Cache to PoC by MVA
+				cmp flag, #1
+				mcreq p15, 0, addr, c7, c10, 1    @ Clean Data Cache to PoC by MVA
+				cmp flag, #2
+				mcreq p15, 0, addr, c7, c14, 1    @ Clean and Invalidate Data Cache to PoC by MVA
+				cmp flag, #3
+				mcreq p15, 0, addr, c7, c11, 1    @ Clean Data Cache to PoU by MVA (FROM ARMv7)
+				add addr, addr, line
+				cmp addr, end
+				blo arm32_cache_operation_range_lines_loop_mva
+
+			b arm32_cache_operation_range_lines_loop
+
+		arm32_cache_operation_range_lines_success:
+			mov r0, #0
+			b arm32_cache_operation_range_common
+
+	arm32_cache_operation_range_whole:
+		and flag, flag, #0x3
+.ifdef __ARMV6
+		mov ip, #0
+		cmp flag, #2
+		mcrne p15, 0, ip, c7, c10, 0              @ Clean Entire Data Cache
+		mcreq p15, 0, ip, c7, c14, 0              @ Clean and Invalidate Entire Data Cache
+.else
+		mov addr, flag
+		cmp flag, #2
+		movne flag, #1                            @ Clean
+		push {r0-r3}
+		mov r0, #1
+		mov r1, flag
+		bl arm32_cache_operation_all
+		pop {r0-r3}
+		cmp addr, #3
+		beq arm32_cache_operation_range_whole_success   @ PoU Is L2
+		push {r0-r3}
+		mov r0, #2
+		mov r1, flag
+		bl arm32_cache_operation_all
+		pop {r0-r3}
+.endif
+
+		arm32_cache_operation_range_whole_success:
+			mov r0, #1
+
+	arm32_cache_operation_range_common:
+		macro32_dsb ip                           @ Ensure Completion of Instructions Before
+		pop {r4-r7,pc}
+
+.unreq ranges
+.unreq number
+.unreq flag
+.unreq addr
+.unreq end
+.unreq total
+.unreq line
+.unreq count
+
+
+/**
+ * function arm32_cache_calibrate
+ * Measure Crossover Length between Lines by MVA and Whole Cache
+ * The range is dirtied and cleaned by lines, then dirtied and cleaned by the whole cache, and each time is measured by the system timer.
+ * ARM32_CACHE_CROSSOVER is set to the length which costs the same time as the whole cache.
+ * From ARMv7, ARM32_CACHE_CROSSOVER is used only on arm32_cache_operation_range with bit[2] of the flag.
+ * Call this function with several lengths to benchmark maintenance time against the length.
+ *
+ * Parameters
+ * r0: Start Address of Cacheable Memory for Measurement, Word Aligned
+ * r1: Length of Bytes for Measurement, Multiple of 4
+ *
+ * Return: r0 (Crossover Length of Bytes, 0 as Error), r1 (Microseconds by Lines), r2 (Microseconds by Whole Cache)
+ * Error: Length Is Zero
+ */
+.globl arm32_cache_calibrate
+arm32_cache_calibrate:
+	/* Auto (Local) Variables, but just Aliases */
+	addr        .req r0 @ Parameter, Register for Argument and Result, Scratch Register
+	length      .req r1 @ Parameter, Register for Argument
+	time_lines  .req r2
+	time_whole  .req r3
+	start       .req r4
+	count       .req r5
+	temp        .req r6
+
+	push {r4-r6,lr}
+
+	cmp length, #0
+	moveq r0, #0
+	beq arm32_cache_calibrate_common
+
+.ifndef __ARMV6
+	/* Minimum Line Size of Data Cache from Cache Type Register (CTR) */
+	mrc p15, 0, temp, c0, c0, 1
+	lsr temp, temp, #16
+	and temp, temp, #0xF                        @ DminLine Bit[19:16], Log2 of Words
+	mov count, #4
+	lsl temp, count, temp
+	str temp, ARM32_CACHE_LINE
+.endif
+
+	/* By Lines */
+	mov temp, #0
+	str temp, ARM32_CACHE_CROSSOVER
+	bl arm32_cache_calibrate_dirty
+	push {r0-r3}
+	bl arm32_timestamp
+	mov start, r0
+	pop {r0-r3}
+	push {r0-r3}
+	push {addr,length}
+	mov r0, sp
+	mov r1, #1
+	mov r2, #1
+	bl arm32_cache_operation_range
+	add sp, sp, #8
+	bl arm32_timestamp
+	sub temp, r0, start
+	pop {r0-r3}
+	mov time_lines, temp
+
+	/* By Whole Cache */
+	mov temp, #1
+	str temp, ARM32_CACHE_CROSSOVER
+	bl arm32_cache_calibrate_dirty
+	push {r0-r3}
+	bl arm32_timestamp
+	mov start, r0
+	pop {r0-r3}
+	push {r0-r3}
+	push {addr,length}
+	mov r0, sp
+	mov r1, #1
+	mov r2, #0x5                                @ Clean to PoC, Allow Whole Cache
+	bl arm32_cache_operation_range
+	add sp, sp, #8
+	bl arm32_timestamp
+	sub temp, r0, start
+	pop {r0-r3}
+	mov time_whole, temp
+
+	/* Crossover = Length * Time by Whole / Time by Lines, 64-bit Product Not to Overflow */
+	cmp time_lines, #0
+	moveq time_lines, #1
+	umull r0, start, length, time_whole         @ Lower in r0, Upper in start
+	cmp start, time_lines
+	mvnhs r0, #0                                @ Quotient Exceeds 32 Bits, Saturate
+	bhs arm32_cache_calibrate_store
+
+	/* Shift and Subtract, Quotient Comes in r0 from Bit[0], Remainder Stays in start */
+	mov count, #32
+	arm32_cache_calibrate_divide:
+		lsls r0, r0, #1
+		adcs start, start, start
+		cmpcc start, time_lines
+		subcs start, start, time_lines
+		orrcs r0, r0, #1
+		subs count, count, #1
+		bne arm32_cache_calibrate_divide
+
+	arm32_cache_calibrate_store:
+		cmp r0, #0
+		moveq r0, #1
+		str r0, ARM32_CACHE_CROSSOVER
+
+	arm32_cache_calibrate_common:
+		mov r1, time_lines
+		mov r2, time_whole
+		pop {r4-r6,pc}
+
+.unreq addr
+.unreq length
+.unreq time_lines
+.unreq time_whole
+.unreq start
+.unreq count
+.unreq temp
+
+
+/**
+ * Dirty Lines for arm32_cache_calibrate
+ * r0: Start Address, r1: Length of Bytes
+ */
+arm32_cache_calibrate_dirty:
+	/* Auto (Local) Variables, but just Aliases */
+	addr        .req r0
+	length      .req r1
+	temp        .req r2
+
+	push {r0-r2}
+
+	arm32_cache_calibrate_dirty_loop:
+		subs length, length, #4
+		blo arm32_cache_calibrate_dirty_common
+		ldr temp, [addr]
+		str temp, [addr], #4
+		b arm32_cache_calibrate_dirty_loop
+
+	arm32_cache_calibrate_dirty_common:
+		macro32_dsb ip
+		pop {r0-r2}
+		mov pc, lr
+
+.unreq addr
+.unreq length
+.unreq temp
+
+.globl ARM32_CACHE_LINE
+.globl ARM32_CACHE_CROSSOVER
+ARM32_CACHE_LINE:      .word equ32_arm32_cache_line      @ Bytes of Line Stepped by MVA
+ARM32_CACHE_CROSSOVER: .word equ32_arm32_cache_crossover @ Total Bytes to Use Whole Cache, 0 as Lines Only
+
 ARM32_STOPWATCH_LOW:  .word 0x00
 ARM32_STOPWATCH_HIGH: .word 0x00
 
@@ -544,6 +822,314 @@ arm32_stopwatch_end:
 .unreq count_high
 
 
+/**
+ * function arm32_perf_init
+ * Initialize Performance Monitor Unit (PMU) and Clear Markers
+ * The cycle counter and two event counters are reset and started, and interrupts of PMU are disabled.
+ * Numbers of events are specific to the CPU, e.g., ARM11 (c15, c12 on CP15) has only two event counters,
+ * and ARMv7/ARMv8 AArch32 (c9 on CP15) uses the common architectural events. Counters are of the core which calls this function.
+ *
+ * Parameters
+ * r0: Event Number for Event Counter 0
+ * r1: Event Number for Event Counter 1
+ *
+ * Return: r0 (0 as Success)
+ */
+.globl arm32_perf_init
+arm32_perf_init:
+	/* Auto (Local) Variables, but just Aliases */
+	event0         .req r0
+	event1         .req r1
+	temp           .req r2
+	temp2          .req r3
+
+	and event0, event0, #0xFF
+	and event1, event1, #0xFF
+	str event0, ARM32_PERF_EVENT0
+	str event1, ARM32_PERF_EVENT1
+
+.ifdef __ARMV6
+	/* Performance Monitor Control Register (PMNC) */
+	lsl temp, event0, #20                          @ EvtCount0 Bit[27:20]
+	orr temp, temp, event1, lsl #12                @ EvtCount1 Bit[19:12]
+	orr temp, temp, #0x700                         @ Clear Overflow Flags Bit[10:8], Interrupts Bit[6:4] Are Disabled
+	orr temp, temp, #0b111                         @ Enable, Reset Event Counters, Reset Cycle Counter
+	mcr p15, 0, temp, c15, c12, 0
+.else
+	mvn temp, #0
+	mcr p15, 0, temp, c9, c14, 2                   @ Clear Interrupt Enables (PMINTENCLR)
+	mcr p15, 0, temp, c9, c12, 3                   @ Clear Overflow Flags (PMOVSR)
+
+	mov temp, #0
+	mcr p15, 0, temp, c9, c12, 5                   @ Select Event Counter 0 (PMSELR)
+	macro32_isb ip
+	mcr p15, 0, event0, c9, c13, 1                 @ Event Type (PMXEVTYPER)
+	mov temp, #1
+	mcr p15, 0, temp, c9, c12, 5                   @ Select Event Counter 1 (PMSELR)
+	macro32_isb ip
+	mcr p15, 0, event1, c9, c13, 1                 @ Event Type (PMXEVTYPER)
+
+	mov temp, #0x80000000                          @ Cycle Counter
+	orr temp, temp, #0b11                          @ Event Counter 0 and 1
+	mcr p15, 0, temp, c9, c12, 1                   @ Count Enable Set (PMCNTENSET)
+
+	/* Performance Monitor Control Register (PMCR) */
+	mov temp, #0b111                               @ Enable, Reset Event Counters, Reset Cycle Counter
+	mcr p15, 0, temp, c9, c12, 0
+.endif
+
+	macro32_isb ip
+
+	/* Clear Markers */
+	ldr temp, ARM32_PERF_BUFFER
+	mov temp2, #equ32_arm32_perf_markers<<equ32_arm32_perf_entry_shift
+	mov event0, #0
+	arm32_perf_init_clear:
+		subs temp2, temp2, #4
+		str event0, [temp, temp2]
+		bgt arm32_perf_init_clear
+
+	arm32_perf_init_common:
+		macro32_dsb ip
+		mov r0, #0
+		mov pc, lr
+
+.unreq event0
+.unreq event1
+.unreq temp
+.unreq temp2
+
+
+/**
+ * function arm32_perf_begin
+ * Begin of Scope to Be Measured by Performance Monitor Unit (PMU)
+ * Counters are read on the end of this function to exclude overhead of this function as possible.
+ *
+ * Parameters
+ * r0: Number of Marker, 0 to equ32_arm32_perf_markers - 1
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Number of Marker Is Overflow
+ */
+.globl arm32_perf_begin
+arm32_perf_begin:
+	/* Auto (Local) Variables, but just Aliases */
+	marker         .req r0
+	cycles         .req r1
+	event0         .req r2
+	event1         .req r3
+
+	cmp marker, #equ32_arm32_perf_markers
+	bhs arm32_perf_begin_error
+
+	ldr ip, ARM32_PERF_BUFFER
+	add ip, ip, marker, lsl #equ32_arm32_perf_entry_shift
+
+.ifdef __ARMV6
+	mrc p15, 0, event0, c15, c12, 2                @ Count Register 0 (PMN0)
+	mrc p15, 0, event1, c15, c12, 3                @ Count Register 1 (PMN1)
+	mrc p15, 0, cycles, c15, c12, 1                @ Cycle Counter Register (CCNT)
+.else
+	mov event0, #0
+	mcr p15, 0, event0, c9, c12, 5                 @ Select Event Counter 0 (PMSELR)
+	macro32_isb event0
+	mrc p15, 0, event0, c9, c13, 2                 @ Event Count (PMXEVCNTR)
+	mov event1, #1
+	mcr p15, 0, event1, c9, c12, 5                 @ Select Event Counter 1 (PMSELR)
+	macro32_isb event1
+	mrc p15, 0, event1, c9, c13, 2                 @ Event Count (PMXEVCNTR)
+	mrc p15, 0, cycles, c9, c13, 0                 @ Cycle Count (PMCCNTR)
+.endif
+
+	str cycles, [ip, #equ32_arm32_perf_start_cycles]
+	str event0, [ip, #equ32_arm32_perf_start_event0]
+	str event1, [ip, #equ32_arm32_perf_start_event1]
+
+	b arm32_perf_begin_success
+
+	arm32_perf_begin_error:
+		mov r0, #1
+		b arm32_perf_begin_common
+
+	arm32_perf_begin_success:
+		mov r0, #0
+
+	arm32_perf_begin_common:
+		mov pc, lr
+
+.unreq marker
+.unreq cycles
+.unreq event0
+.unreq event1
+
+
+/**
+ * function arm32_perf_end
+ * End of Scope to Be Measured by Performance Monitor Unit (PMU)
+ * Counts from arm32_perf_begin are accumulated to the sum, the minimum, and the maximum of the marker,
+ * and the histogram of cycles is incremented. The average is the sum divided by the number of measurements.
+ * Counters are read on the start of this function to exclude overhead of this function as possible.
+ *
+ * Parameters
+ * r0: Number of Marker, 0 to equ32_arm32_perf_markers - 1
+ *
+ * Return: r0 (Cycles from arm32_perf_begin, -1 as Error)
+ * Error: Number of Marker Is Overflow
+ */
+.globl arm32_perf_end
+arm32_perf_end:
+	/* Auto (Local) Variables, but just Aliases */
+	marker         .req r0
+	cycles         .req r1
+	event0         .req r2
+	event1         .req r3
+	entry          .req r4
+	count          .req r5
+	temp           .req r6
+
+.ifdef __ARMV6
+	mrc p15, 0, cycles, c15, c12, 1                @ Cycle Counter Register (CCNT)
+	mrc p15, 0, event0, c15, c12, 2                @ Count Register 0 (PMN0)
+	mrc p15, 0, event1, c15, c12, 3                @ Count Register 1 (PMN1)
+.else
+	mrc p15, 0, cycles, c9, c13, 0                 @ Cycle Count (PMCCNTR)
+	mov event0, #0
+	mcr p15, 0, event0, c9, c12, 5                 @ Select Event Counter 0 (PMSELR)
+	macro32_isb event0
+	mrc p15, 0, event0, c9, c13, 2                 @ Event Count (PMXEVCNTR)
+	mov event1, #1
+	mcr p15, 0, event1, c9, c12, 5                 @ Select Event Counter 1 (PMSELR)
+	macro32_isb event1
+	mrc p15, 0, event1, c9, c13, 2                 @ Event Count (PMXEVCNTR)
+.endif
+
+	push {r4-r6,lr}
+
+	cmp marker, #equ32_arm32_perf_markers
+	bhs arm32_perf_end_error
+
+	ldr entry, ARM32_PERF_BUFFER
+	add entry, entry, marker, lsl #equ32_arm32_perf_entry_shift
+
+	/* Differences, Wrap Around of 32-bit Counters Is Allowed Only Once */
+	ldr temp, [entry, #equ32_arm32_perf_start_cycles]
+	sub cycles, cycles, temp
+	ldr temp, [entry, #equ32_arm32_perf_start_event0]
+	sub event0, event0, temp
+	ldr temp, [entry, #equ32_arm32_perf_start_event1]
+	sub event1, event1, temp
+
+	ldr count, [entry, #equ32_arm32_perf_count]
+	add count, count, #1
+	str count, [entry, #equ32_arm32_perf_count]
+
+	push {r0-r3}
+	add r0, entry, #equ32_arm32_perf_cycles
+	mov r2, count
+	bl arm32_perf_stat
+	pop {r0-r3}
+
+	push {r0-r3}
+	add r0, entry, #equ32_arm32_perf_event0
+	mov r1, event0
+	mov r2, count
+	bl arm32_perf_stat
+	pop {r0-r3}
+
+	push {r0-r3}
+	add r0, entry, #equ32_arm32_perf_event1
+	mov r1, event1
+	mov r2, count
+	bl arm32_perf_stat
+	pop {r0-r3}
+
+	/* Histogram, Bucket Is Floor of Log Base 4 */
+	clz temp, cycles
+	rsbs temp, temp, #31                           @ Index of Most Significant Bit, Negative If Zero
+	movmi temp, #0
+	lsr temp, temp, #1
+	add entry, entry, #equ32_arm32_perf_histogram
+	ldr count, [entry, temp, lsl #2]
+	add count, count, #1
+	str count, [entry, temp, lsl #2]
+
+	b arm32_perf_end_success
+
+	arm32_perf_end_error:
+		mvn r0, #0
+		b arm32_perf_end_common
+
+	arm32_perf_end_success:
+		mov r0, cycles
+
+	arm32_perf_end_common:
+		macro32_dsb ip
+		pop {r4-r6,pc}
+
+.unreq marker
+.unreq cycles
+.unreq event0
+.unreq event1
+.unreq entry
+.unreq count
+.unreq temp
+
+
+/**
+ * Accumulate Value to Statistics (Sum Lower, Sum Upper, Min, Max)
+ * r0: Pointer of Statistics
+ * r1: Value
+ * r2: Number of Measurements Including This Value
+ */
+arm32_perf_stat:
+	/* Auto (Local) Variables, but just Aliases */
+	stat           .req r0
+	value          .req r1
+	count          .req r2
+	temp           .req r3
+
+	ldr temp, [stat]
+	adds temp, temp, value
+	str temp, [stat]
+	ldr temp, [stat, #4]
+	adc temp, temp, #0
+	str temp, [stat, #4]
+
+	ldr temp, [stat, #8]
+	cmp count, #1
+	beq arm32_perf_stat_min
+	cmp value, temp
+	bhs arm32_perf_stat_max
+
+	arm32_perf_stat_min:
+		str value, [stat, #8]
+
+	arm32_perf_stat_max:
+		ldr temp, [stat, #12]
+		cmp value, temp
+		strhi value, [stat, #12]
+
+	arm32_perf_stat_common:
+		mov pc, lr
+
+.unreq stat
+.unreq value
+.unreq count
+.unreq temp
+
+.globl ARM32_PERF_BUFFER
+.globl ARM32_PERF_EVENT0
+.globl ARM32_PERF_EVENT1
+ARM32_PERF_BUFFER: .word _ARM32_PERF_BUFFER
+ARM32_PERF_EVENT0: .word 0x00                  @ Event Number for Event Counter 0
+ARM32_PERF_EVENT1: .word 0x00                  @ Event Number for Event Counter 1
+
+.section	.data
+.balign 4
+_ARM32_PERF_BUFFER: .space equ32_arm32_perf_markers<<equ32_arm32_perf_entry_shift @ Markers of arm32_perf_begin and arm32_perf_end
+.section	.arm_system32
+
+
 /**
  * function arm32_sleep
  * Sleep in Micro Seconds
@@ -985,6 +1571,10 @@ arm32_change_address:
 
 	macro32_dsb ip
 
+	push {r0-r3,lr}
+	bl arm32_split_supersection
+	pop {r0-r3,lr}
+
 	mov temp, #0xFF00000
 	add temp, #0xF0000000
 
@@ -1101,8 +1691,24 @@ arm32_set_cache:
 	arm32_set_cache_loop:
 		cmp memorymap_base, size
 		bhs arm32_set_cache_success
+		push {r0-r3,lr}
+		mov r1, memorymap_base
+		bl arm32_split_supersection
+		pop {r0-r3,lr}
 		ldr temp, [base_addr]
 		macro32_dsb ip
+		and ip, temp, #0b11
+		cmp ip, #equ32_mmu_page
+		bne arm32_set_cache_loop_section
+		/* Page Table Returns to Section */
+		push {r0-r3,lr}
+		lsr r0, number_core, #16
+		bic r1, temp, #0xFF
+		bic r1, r1, #0x300
+		bl arm32_l2table_free
+		mov temp, r0                                 @ First Small Page Has Destination of Section
+		pop {r0-r3,lr}
+		arm32_set_cache_loop_section:
 		bic temp, temp, #0x000000FF                  @ Clear Except Destination Address
 		bic temp, temp, #0x0000FF00
 		bic temp, temp, #0x000F0000
@@ -1137,6 +1743,445 @@ arm32_set_cache:
 .unreq number_core
 
 
+/**
+ * function arm32_split_supersection
+ * Split Supersection into 16 Sections
+ * Call this function before changing a part of a supersection, arm32_set_cache and arm32_set_cache_page call this function.
+ *
+ * Parameters
+ * r0: Secure state (0) or Non-secure state (1)
+ * r1: Virtual Address in Supersection
+ *
+ * Return: r0 (0 as Not Supersection, 1 as Split)
+ */
+.globl arm32_split_supersection
+arm32_split_supersection:
+	/* Auto (Local) Variables, but just Aliases */
+	non_secure     .req r0
+	addr           .req r1
+	desc           .req r2
+	base_addr      .req r3
+	temp           .req r4
+	count          .req r5
+
+	push {r4-r5,lr}
+
+	macro32_multicore_id temp
+
+	ldr base_addr, ARM32_VADESCRIPTOR_ADDR
+	add base_addr, base_addr, temp, lsl #16       @ 0x10000, 65536 Bytes Offset
+	add base_addr, base_addr, non_secure, lsl #14 @ 0x4000, 16384 Bytes Offset
+
+	lsr addr, addr, #24
+	add base_addr, base_addr, addr, lsl #6        @ First Descriptor of 16 Descriptors
+	lsl addr, addr, #24
+
+	ldr desc, [base_addr]
+	and temp, desc, #0b11
+	cmp temp, #equ32_mmu_section
+	bne arm32_split_supersection_success
+	tst desc, #equ32_mmu_supersection
+	beq arm32_split_supersection_success
+
+	bic desc, desc, #equ32_mmu_supersection       @ Bit[23:20] Are Zeros on Supersection
+	mov count, #16
+
+	arm32_split_supersection_loop:
+		push {r0-r3}
+		bl arm32_change_descriptor
+		pop {r0-r3}
+		add addr, addr, #0x00100000
+		add desc, desc, #0x00100000
+		subs count, count, #1
+		bne arm32_split_supersection_loop
+
+	mov r0, #1
+	b arm32_split_supersection_common
+
+	arm32_split_supersection_success:
+		mov r0, #0
+
+	arm32_split_supersection_common:
+		macro32_dsb ip                       @ Ensure Completion of Instructions Before
+		pop {r4-r5,pc}
+
+.unreq non_secure
+.unreq addr
+.unreq desc
+.unreq base_addr
+.unreq temp
+.unreq count
+
+
+/**
+ * function arm32_set_supersection
+ * Merge 16 Sections into Supersection to Reduce TLB Misses
+ * Each 16M bytes aligned block in the range is merged only if its 16 sections have the same attributes,
+ * domain 0, and contiguous destinations, so call this function after setting cache status by sections.
+ *
+ * Parameters
+ * r0: Secure state (0) or Non-secure state (1)
+ * r1: Start Address of Virtual Memory
+ * r2: Size of Memory
+ *
+ * Return: r0 (Number of Supersections)
+ */
+.globl arm32_set_supersection
+arm32_set_supersection:
+	/* Auto (Local) Variables, but just Aliases */
+	non_secure     .req r0
+	addr           .req r1
+	end            .req r2
+	base_addr      .req r3
+	desc           .req r4
+	temp           .req r5
+	count          .req r6
+	number         .req r7
+	first          .req r8
+	addr_desc      .req r9
+
+	push {r4-r9,lr}
+
+	add end, addr, end
+
+	/* Align Start by 16M Bytes */
+	lsl temp, addr, #8
+	lsr addr, addr, #24
+	cmp temp, #0
+	addne addr, addr, #1
+	lsl addr, addr, #24
+
+	macro32_multicore_id temp
+
+	ldr base_addr, ARM32_VADESCRIPTOR_ADDR
+	add base_addr, base_addr, temp, lsl #16       @ 0x10000, 65536 Bytes Offset
+	add base_addr, base_addr, non_secure, lsl #14 @ 0x4000, 16384 Bytes Offset
+
+	mov number, #0
+
+	arm32_set_supersection_loop:
+		adds temp, addr, #0x01000000
+		bcs arm32_set_supersection_success
+		cmp temp, end
+		bhi arm32_set_supersection_success
+
+		lsr temp, addr, #20
+		add addr_desc, base_addr, temp, lsl #2
+
+		ldr first, [addr_desc]
+		and temp, first, #0b11
+		cmp temp, #equ32_mmu_section
+		bne arm32_set_supersection_loop_common
+		tst first, #equ32_mmu_supersection
+		bne arm32_set_supersection_loop_common     @ If Already Merged
+		tst first, #0x1E0
+		bne arm32_set_supersection_loop_common     @ Domain[8:5] Is PA[39:36] on Supersection
+		tst first, #0x00F00000
+		bne arm32_set_supersection_loop_common     @ Destination Is Not Aligned by 16M Bytes
+
+		mov count, #1
+		arm32_set_supersection_loop_check:
+			ldr desc, [addr_desc, count, lsl #2]
+			add temp, first, count, lsl #20
+			cmp desc, temp
+			bne arm32_set_supersection_loop_common
+			add count, count, #1
+			cmp count, #16
+			blo arm32_set_supersection_loop_check
+
+		orr first, first, #equ32_mmu_supersection
+		mov count, #0
+		arm32_set_supersection_loop_merge:
+			push {r0-r3}
+			add r1, addr, count, lsl #20
+			mov r2, first
+			bl arm32_change_descriptor
+			pop {r0-r3}
+			add count, count, #1
+			cmp count, #16
+			blo arm32_set_supersection_loop_merge
+
+		add number, number, #1
+
+		arm32_set_supersection_loop_common:
+			add addr, addr, #0x01000000
+			b arm32_set_supersection_loop
+
+	arm32_set_supersection_success:
+		macro32_dsb ip
+		macro32_invalidate_tlb_all ip
+		macro32_dsb ip
+		macro32_isb ip
+		mov r0, number
+
+	arm32_set_supersection_common:
+		pop {r4-r9,pc}
+
+.unreq non_secure
+.unreq addr
+.unreq end
+.unreq base_addr
+.unreq desc
+.unreq temp
+.unreq count
+.unreq number
+.unreq first
+.unreq addr_desc
+
+
+/**
+ * function arm32_set_cache_page
+ * Change Cache Status by 4K Bytes Small Pages
+ * Each 1M bytes section in the range is translated to a second level page table which inherits attributes of the section.
+ * Page tables are allocated from equ32_arm32_l2table_number tables per core, and arm32_set_cache on the section returns its table.
+ *
+ * Parameters
+ * r0: Secure state (0) or Non-secure state (1)
+ * r1: Flag of Second Level Descriptor for Small Page, e.g., equ32_mmu_second_small|equ32_mmu_second_inner_none|...
+ * r2: Start Address of Virtual Memory to Set Cache
+ * r3: Size of Memory to Set Cache
+ *
+ * Return: r0 (0 as success, 1 and 2 as error)
+ * Error(1): When Virtual Address is not Defined or Size Is Zero
+ * Error(2): No Free Page Table
+ */
+.globl arm32_set_cache_page
+arm32_set_cache_page:
+	/* Auto (Local) Variables, but just Aliases */
+	non_secure     .req r0
+	desc_flag      .req r1
+	addr           .req r2
+	end            .req r3
+	base_addr      .req r4
+	desc           .req r5
+	table          .req r6
+	temp           .req r7
+	count          .req r8
+	number_core    .req r9
+
+	push {r4-r9,lr}
+
+	macro32_dsb ip
+
+	cmp end, #0
+	beq arm32_set_cache_page_error1
+
+	add end, addr, end
+	lsr addr, addr, #12
+	lsl addr, addr, #12                           @ Align by 4K Bytes
+
+	lsl desc_flag, desc_flag, #20
+	lsr desc_flag, desc_flag, #20                 @ Bit[11:0]
+
+	macro32_multicore_id number_core
+
+	ldr base_addr, ARM32_VADESCRIPTOR_ADDR
+	add base_addr, base_addr, number_core, lsl #16 @ 0x10000, 65536 Bytes Offset
+	add base_addr, base_addr, non_secure, lsl #14  @ 0x4000, 16384 Bytes Offset
+
+	arm32_set_cache_page_loop:
+		cmp addr, end
+		bhs arm32_set_cache_page_success
+
+		push {r0-r3}
+		mov r1, addr
+		bl arm32_split_supersection
+		pop {r0-r3}
+
+		lsr temp, addr, #20
+		ldr desc, [base_addr, temp, lsl #2]
+		and temp, desc, #0b11
+		cmp temp, #equ32_mmu_page
+		beq arm32_set_cache_page_loop_page
+		cmp temp, #equ32_mmu_section
+		bne arm32_set_cache_page_error1
+
+		push {r0-r3}
+		mov r0, number_core
+		bl arm32_l2table_alloc
+		mov table, r0
+		pop {r0-r3}
+		cmp table, #0
+		beq arm32_set_cache_page_error2
+
+		/* Inherit Section, TEX, APX, AP, S, and nG Are Shifted by 6 Bits, C and B Are Same */
+		lsr temp, desc, #6
+		and temp, temp, #0xFF0
+		and count, desc, #0b1100
+		orr temp, temp, count
+		tst desc, #equ32_mmu_section_executenever
+		orrne temp, temp, #equ32_mmu_second_small_xn
+		orr temp, temp, #equ32_mmu_second_small
+		lsr count, desc, #20
+		orr temp, temp, count, lsl #20            @ Destination Bit[31:20]
+
+		mov count, #0
+		arm32_set_cache_page_loop_fill:
+			str temp, [table, count, lsl #2]
+			add temp, temp, #0x1000
+			add count, count, #1
+			cmp count, #256
+			blo arm32_set_cache_page_loop_fill
+
+		mov count, #0
+		arm32_set_cache_page_loop_clean:
+			add temp, table, count
+			macro32_clean_cache temp, ip
+			add count, count, #32
+			cmp count, #0x400
+			blo arm32_set_cache_page_loop_clean
+
+		macro32_dsb ip
+
+		/* First Level Descriptor for Page Table */
+		and temp, desc, #0x1E0                    @ Domain[8:5]
+		orr temp, temp, #equ32_mmu_page
+		tst desc, #equ32_mmu_section_nonsecure
+		orrne temp, temp, #equ32_mmu_page_nonsecure
+		orr desc, temp, table
+
+		push {r0-r3}
+		mov r1, addr
+		mov r2, desc
+		bl arm32_change_descriptor
+		pop {r0-r3}
+
+		arm32_set_cache_page_loop_page:
+			bic table, desc, #0xFF
+			bic table, table, #0x300              @ Page Table Base Address Bit[31:10]
+			lsr temp, addr, #12
+			and temp, temp, #0xFF
+			add table, table, temp, lsl #2
+
+			ldr temp, [table]
+			lsr temp, temp, #12
+			lsl temp, temp, #12                   @ Destination Bit[31:12]
+			orr temp, temp, desc_flag
+			str temp, [table]
+
+			macro32_dsb ip
+			macro32_clean_cache table, ip
+			macro32_dsb ip
+
+			add addr, addr, #0x1000
+			b arm32_set_cache_page_loop
+
+	arm32_set_cache_page_error1:
+		mov r0, #1
+		b arm32_set_cache_page_common
+
+	arm32_set_cache_page_error2:
+		mov r0, #2
+		b arm32_set_cache_page_common
+
+	arm32_set_cache_page_success:
+		macro32_invalidate_tlb_all ip
+		macro32_dsb ip
+		macro32_isb ip
+		mov r0, #0
+
+	arm32_set_cache_page_common:
+		macro32_dsb ip                       @ Ensure Completion of Instructions Before
+		pop {r4-r9,pc}
+
+.unreq non_secure
+.unreq desc_flag
+.unreq addr
+.unreq end
+.unreq base_addr
+.unreq desc
+.unreq table
+.unreq temp
+.unreq count
+.unreq number_core
+
+
+/**
+ * Allocate Second Level Page Table (1K Bytes)
+ * r0: Number of Core
+ * Return: r0 (Address of Page Table, 0 as No Free Table)
+ */
+arm32_l2table_alloc:
+	/* Auto (Local) Variables, but just Aliases */
+	number_core    .req r0
+	addr_bitmap    .req r1
+	bitmap         .req r2
+	temp           .req r3
+
+	ldr addr_bitmap, arm32_l2table_bitmap_addr
+	add addr_bitmap, addr_bitmap, number_core, lsl #2
+	ldr bitmap, [addr_bitmap]
+
+	mvn temp, bitmap
+	lsl temp, temp, #32 - equ32_arm32_l2table_number
+	lsr temp, temp, #32 - equ32_arm32_l2table_number
+	cmp temp, #0
+	moveq r0, #0
+	beq arm32_l2table_alloc_common
+
+	rsb ip, temp, #0
+	and ip, temp, ip
+	clz ip, ip
+	rsb ip, ip, #31                              @ Lowest Free Table
+	mov temp, #1
+	orr bitmap, bitmap, temp, lsl ip
+	str bitmap, [addr_bitmap]
+
+	ldr temp, ARM32_VADESCRIPTOR_ADDR
+	add temp, temp, number_core, lsl #16
+	add temp, temp, #equ32_arm32_l2table_offset
+	add r0, temp, ip, lsl #10
+
+	arm32_l2table_alloc_common:
+		mov pc, lr
+
+.unreq number_core
+.unreq addr_bitmap
+.unreq bitmap
+.unreq temp
+
+
+/**
+ * Free Second Level Page Table
+ * r0: Number of Core
+ * r1: Address of Page Table
+ * Return: r0 (First Descriptor of Page Table)
+ */
+arm32_l2table_free:
+	/* Auto (Local) Variables, but just Aliases */
+	number_core    .req r0
+	table          .req r1
+	bitmap         .req r2
+	temp           .req r3
+
+	ldr temp, ARM32_VADESCRIPTOR_ADDR
+	add temp, temp, number_core, lsl #16
+	add temp, temp, #equ32_arm32_l2table_offset
+	sub temp, table, temp
+	lsr temp, temp, #10
+	cmp temp, #equ32_arm32_l2table_number
+	bhs arm32_l2table_free_common                @ Out of Pool
+
+	ldr ip, arm32_l2table_bitmap_addr
+	add ip, ip, number_core, lsl #2
+	ldr bitmap, [ip]
+	mov number_core, #1
+	bic bitmap, bitmap, number_core, lsl temp
+	str bitmap, [ip]
+
+	arm32_l2table_free_common:
+		ldr r0, [table]
+		mov pc, lr
+
+.unreq number_core
+.unreq table
+.unreq bitmap
+.unreq temp
+
+arm32_l2table_bitmap_addr: .word arm32_l2table_bitmap
+arm32_l2table_bitmap:      .word 0x00, 0x00, 0x00, 0x00 @ Allocated Page Tables for Each Core
+
+
 .globl ARM32_VADESCRIPTOR_ADDR
 .globl ARM32_VADESCRIPTOR_SIZE
 ARM32_VADESCRIPTOR_ADDR: .word SYSTEM32_VADESCRIPTOR
@@ -14,6 +14,7 @@
 .equ dma32_txfr_len,              0x0000000C @ Transfer Length
 .equ dma32_stride,                0x00000010 @ 2D Stride
 .equ dma32_nextconbk,             0x00000014 @ Next CB Addres
+.equ dma32_segment,               0x00000014 @ Size of Each Segment for dma32_submit (20 Bytes)
 
 
 /**
@@ -556,6 +557,828 @@ macro32_debug source_ad, 100, 150
 .unreq mul_number
 
 
+/**
+ * function dma32_submit
+ * Submit Scatter-gather Transfer to DMA Pool without Waiting
+ * Each segment is copied to a CB allocated from the pool (equ32_dma32_cb_pool_start), and CBs are chained in order.
+ * A free channel is selected from DMA32_POOL_CHANNEL, lite channels (7-14) are skipped if any segment exceeds 16-bit length or uses 2D mode.
+ * Interrupt is enabled only on the last CB. Check completion by dma32_poll, dma32_wait_ticket, or dma32_complete.
+ *
+ * Parameters
+ * r0: Pointer of Array of Segments, Each Segment Is 5 Words Same as Word0-4 of CB (TI, Source, Destination, Length, 2D Stride)
+ * r1: Number of Segments
+ *
+ * Return: r0 (Ticket, 0 as Error)
+ * Error: No Segment, No Free Channel, or No Free CB
+ */
+.globl dma32_submit
+dma32_submit:
+	/* Auto (Local) Variables, but just Aliases */
+	segment      .req r0 @ Parameter, Register for Argument and Result, Scratch Register
+	number       .req r1 @ Parameter, Register for Argument, Scratch Register
+	channel      .req r2
+	temp         .req r3
+	free         .req r4
+	addr_cb      .req r5
+	prev         .req r6
+	first        .req r7
+	map          .req r8
+	save_cpsr    .req r9
+	index        .req r10
+	temp2        .req r11
+
+	push {r4-r11,lr}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	cmp number, #0
+	beq dma32_submit_error
+
+	/* Reap Finished Channels Even If IRQ Is Not Used */
+	push {r0-r3}
+	bl dma32_irq
+	pop {r0-r3}
+
+	ldr free, DMA32_POOL_CHANNEL
+	ldr temp, dma32_pool_busy
+	bic free, free, temp
+
+	/* Lite Channels Have 16-bit Length and No 2D Mode */
+	mov temp2, segment
+	mov index, #0
+	dma32_submit_check:
+		ldr temp, [temp2, #dma32_txfr_len]
+		cmp temp, #0x10000
+		bichs free, free, #0x7F00
+		bichs free, free, #0x0080                   @ Exclude Channel 7-14
+		ldr temp, [temp2, #dma32_ti]
+		tst temp, #equ32_dma_ti_tdmode
+		bicne free, free, #0x7F00
+		bicne free, free, #0x0080                   @ Exclude Channel 7-14
+		add temp2, temp2, #dma32_segment
+		add index, index, #1
+		cmp index, number
+		blo dma32_submit_check
+
+	cmp free, #0
+	beq dma32_submit_error
+
+	/* Lowest Free Channel */
+	rsb temp, free, #0
+	and temp, free, temp
+	clz temp, temp
+	rsb channel, temp, #31
+
+	ldr map, dma32_pool_cbmap_addr
+	mvn first, #0                                  @ -1 as No CB
+	mov prev, #0
+	mov index, #0
+
+	dma32_submit_alloc:
+		mov temp2, #0
+
+		dma32_submit_alloc_find:
+			cmp temp2, #equ32_dma32_cb_pool_size / 32
+			bhs dma32_submit_error_free
+			ldr temp, [map, temp2, lsl #2]
+			mvns temp, temp                        @ Free Bits
+			addeq temp2, temp2, #1
+			beq dma32_submit_alloc_find
+
+		/* Lowest Free Bit, Free Is Reused As CB Number */
+		rsb free, temp, #0
+		and free, temp, free
+		clz free, free
+		rsb free, free, #31
+		ldr temp, [map, temp2, lsl #2]
+		mov addr_cb, #1
+		orr temp, temp, addr_cb, lsl free
+		str temp, [map, temp2, lsl #2]
+		add free, free, temp2, lsl #5
+		add free, free, #equ32_dma32_cb_pool_start
+
+		cmn first, #1
+		moveq first, free
+
+		ldr addr_cb, DMA32_CB
+		add addr_cb, addr_cb, free, lsl #5
+
+		ldr temp, [segment, #dma32_ti]
+		bic temp, temp, #equ32_dma_ti_inten
+		str temp, [addr_cb, #dma32_ti]
+		ldr temp, [segment, #dma32_source_ad]
+		str temp, [addr_cb, #dma32_source_ad]
+		ldr temp, [segment, #dma32_dest_ad]
+		str temp, [addr_cb, #dma32_dest_ad]
+		ldr temp, [segment, #dma32_txfr_len]
+		str temp, [addr_cb, #dma32_txfr_len]
+		ldr temp, [segment, #dma32_stride]
+		str temp, [addr_cb, #dma32_stride]
+		mov temp, #0
+		str temp, [addr_cb, #dma32_nextconbk]
+
+		/* Chain from Previous CB */
+		cmp prev, #0
+		addne temp, addr_cb, #equ32_bus_coherence_base
+		strne temp, [prev, #dma32_nextconbk]
+		mov prev, addr_cb
+
+		add segment, segment, #dma32_segment
+		add index, index, #1
+		cmp index, number
+		blo dma32_submit_alloc
+
+	/* Interrupt on Last CB */
+	ldr temp, [prev, #dma32_ti]
+	orr temp, temp, #equ32_dma_ti_inten
+	str temp, [prev, #dma32_ti]
+
+	macro32_dsb ip
+
+	/* Issue Ticket, 1 to 0x7FFFFFFF */
+	ldr temp, DMA32_POOL_TICKET
+	add temp2, temp, #1
+	bic temp2, temp2, #0x80000000
+	cmp temp2, #0
+	moveq temp2, #1
+	str temp2, DMA32_POOL_TICKET
+
+	ldr addr_cb, dma32_pool_slot_addr
+	add addr_cb, addr_cb, channel, lsl #3
+	str temp, [addr_cb]                            @ Ticket
+	str first, [addr_cb, #4]                       @ First CB Number
+
+	ldr temp2, dma32_pool_busy
+	mov index, #1
+	orr temp2, temp2, index, lsl channel
+	str temp2, dma32_pool_busy
+
+	macro32_dsb ip
+
+	push {r0-r3}
+	mov r0, channel
+	mov r1, first
+	bl dma32_set_channel
+	pop {r0-r3}
+
+	mov r0, temp
+	b dma32_submit_common
+
+	dma32_submit_error_free:
+		cmn first, #1
+		beq dma32_submit_error
+		push {r0-r3}
+		mov r0, first
+		bl dma32_pool_freechain
+		pop {r0-r3}
+
+	dma32_submit_error:
+		mov r0, #0
+
+	dma32_submit_common:
+		msr cpsr_c, save_cpsr
+		macro32_dsb ip
+		pop {r4-r11,pc}
+
+.unreq segment
+.unreq number
+.unreq channel
+.unreq temp
+.unreq free
+.unreq addr_cb
+.unreq prev
+.unreq first
+.unreq map
+.unreq save_cpsr
+.unreq index
+.unreq temp2
+
+
+/**
+ * function dma32_irq
+ * Reap Finished Transfers on DMA Pool
+ * Each finished channel is freed with its CBs, and its ticket is queued to the completion queue.
+ * The ticket of a channel stopped with DMA error is also recorded to the error ring for dma32_poll.
+ * Call this function in IRQ with DMA interrupts enabled by dma32_pool_init.
+ * dma32_submit, dma32_poll, and dma32_wait_ticket call this function too, so IRQ is optional.
+ *
+ * Return: r0 (Number of Reaped Transfers)
+ */
+.globl dma32_irq
+dma32_irq:
+	/* Auto (Local) Variables, but just Aliases */
+	reaped       .req r0
+	busy         .req r1
+	channel      .req r2
+	addr_dma     .req r3
+	temp         .req r4
+	slot         .req r5
+	ticket       .req r6
+	save_cpsr    .req r7
+	temp2        .req r8
+
+	push {r4-r8,lr}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	mov reaped, #0
+	ldr busy, dma32_pool_busy
+	mov channel, #0
+
+	dma32_irq_loop:
+		cmp channel, #15
+		bhs dma32_irq_success
+
+		mov temp, #1
+		tst busy, temp, lsl channel
+		beq dma32_irq_loop_common
+
+		mov addr_dma, #equ32_peripherals_base
+		add addr_dma, addr_dma, #equ32_dma_base
+		add addr_dma, addr_dma, channel, lsl #8     @ Multiply by equ32_dma_channel_offset
+
+		mov ticket, #0
+		ldr temp, [addr_dma, #equ32_dma_cs]
+		tst temp, #equ32_dma_cs_error
+		movne ticket, #0x80000000                   @ Error Flag on Ticket
+		movne temp, #equ32_dma_cs_reset
+		bne dma32_irq_loop_finish
+		tst temp, #equ32_dma_cs_active
+		bne dma32_irq_loop_common                   @ If Still Active
+		mov temp, #equ32_dma_cs_int|equ32_dma_cs_end  @ Write 1 to Clear
+
+		dma32_irq_loop_finish:
+			str temp, [addr_dma, #equ32_dma_cs]
+
+			macro32_dsb ip
+
+			ldr slot, dma32_pool_slot_addr
+			add slot, slot, channel, lsl #3
+			ldr temp, [slot]
+			orr ticket, ticket, temp
+			mov temp, #0
+			str temp, [slot]
+
+			push {r0-r3}
+			ldr r0, [slot, #4]
+			bl dma32_pool_freechain
+			pop {r0-r3}
+
+			mov temp, #1
+			bic busy, busy, temp, lsl channel
+
+			/* Error Ring, Overwrites Oldest */
+			tst ticket, #0x80000000
+			beq dma32_irq_loop_queue
+			ldr temp, DMA32_ERROR_INDEX
+			ldr slot, DMA32_ERROR_RING_ADDR
+			and temp2, temp, #equ32_dma32_pool_error_size - 1
+			bic ip, ticket, #0x80000000
+			str ip, [slot, temp2, lsl #2]
+			add temp, temp, #1
+			str temp, DMA32_ERROR_INDEX
+
+		dma32_irq_loop_queue:
+			/* Completion Queue */
+			ldr temp, DMA32_COMPLETE_HEAD
+			ldr temp2, DMA32_COMPLETE_TAIL
+			sub temp2, temp, temp2
+			cmp temp2, #equ32_dma32_pool_ring_size
+			ldrhs temp2, DMA32_COMPLETE_OVERFLOW
+			addhs temp2, temp2, #1
+			strhs temp2, DMA32_COMPLETE_OVERFLOW
+			bhs dma32_irq_loop_reaped
+
+			ldr slot, DMA32_COMPLETE_RING_ADDR
+			and temp2, temp, #equ32_dma32_pool_ring_size - 1
+			str ticket, [slot, temp2, lsl #2]
+			macro32_dsb ip
+			add temp, temp, #1
+			str temp, DMA32_COMPLETE_HEAD
+
+		dma32_irq_loop_reaped:
+			add reaped, reaped, #1
+
+		dma32_irq_loop_common:
+			add channel, channel, #1
+			b dma32_irq_loop
+
+	dma32_irq_success:
+		str busy, dma32_pool_busy
+		macro32_dsb ip
+
+	dma32_irq_common:
+		msr cpsr_c, save_cpsr
+		pop {r4-r8,pc}
+
+.unreq reaped
+.unreq busy
+.unreq channel
+.unreq addr_dma
+.unreq temp
+.unreq slot
+.unreq ticket
+.unreq save_cpsr
+.unreq temp2
+
+
+/**
+ * function dma32_poll
+ * Check Ticket Issued by dma32_submit
+ *
+ * Parameters
+ * r0: Ticket
+ *
+ * Return: r0 (0 as Completed, 1 as Pending, 2 and 3 as Error)
+ * Error(2): Ticket Is Not Issued
+ * Error(3): DMA Error, Only Last equ32_dma32_pool_error_size Tickets with DMA Error Are Recorded
+ */
+.globl dma32_poll
+dma32_poll:
+	/* Auto (Local) Variables, but just Aliases */
+	ticket       .req r0
+	slot         .req r1
+	channel      .req r2
+	temp         .req r3
+
+	push {lr}
+
+	cmp ticket, #0
+	beq dma32_poll_error
+	ldr temp, DMA32_POOL_TICKET
+	cmp ticket, temp
+	bhs dma32_poll_error
+
+	push {r0-r3}
+	bl dma32_irq
+	pop {r0-r3}
+
+	ldr slot, dma32_pool_slot_addr
+	mov channel, #0
+
+	dma32_poll_loop:
+		ldr temp, [slot, channel, lsl #3]
+		cmp temp, ticket
+		beq dma32_poll_pending
+		add channel, channel, #1
+		cmp channel, #15
+		blo dma32_poll_loop
+
+	/* Tickets with DMA Error */
+	ldr slot, DMA32_ERROR_RING_ADDR
+	mov channel, #0
+
+	dma32_poll_failed:
+		ldr temp, [slot, channel, lsl #2]
+		cmp temp, ticket
+		beq dma32_poll_error3
+		add channel, channel, #1
+		cmp channel, #equ32_dma32_pool_error_size
+		blo dma32_poll_failed
+
+	b dma32_poll_success
+
+	dma32_poll_pending:
+		mov r0, #1
+		b dma32_poll_common
+
+	dma32_poll_error:
+		mov r0, #2
+		b dma32_poll_common
+
+	dma32_poll_error3:
+		mov r0, #3
+		b dma32_poll_common
+
+	dma32_poll_success:
+		mov r0, #0
+
+	dma32_poll_common:
+		pop {pc}
+
+.unreq ticket
+.unreq slot
+.unreq channel
+.unreq temp
+
+
+/**
+ * function dma32_wait_ticket
+ * Wait for Ticket Issued by dma32_submit
+ *
+ * Parameters
+ * r0: Ticket
+ * r1: Time Out in Turns
+ *
+ * Return: r0 (0 as Success, 1, 2 and 3 as Error)
+ * Error(1): Time Out
+ * Error(2): Ticket Is Not Issued
+ * Error(3): DMA Error
+ */
+.globl dma32_wait_ticket
+dma32_wait_ticket:
+	/* Auto (Local) Variables, but just Aliases */
+	ticket       .req r0
+	timeout      .req r1
+	result       .req r2
+
+	push {lr}
+
+	dma32_wait_ticket_loop:
+		push {r0-r1}
+		bl dma32_poll
+		mov result, r0
+		pop {r0-r1}
+		cmp result, #1
+		bne dma32_wait_ticket_common             @ Completed or Error
+		subs timeout, timeout, #1
+		bhs dma32_wait_ticket_loop
+
+	dma32_wait_ticket_common:
+		mov r0, result
+		pop {pc}
+
+.unreq ticket
+.unreq timeout
+.unreq result
+
+
+/**
+ * function dma32_cancel
+ * Cancel Ticket Issued by dma32_submit
+ * The channel of the ticket is reset, then the channel and its CBs are freed without queuing the ticket to the completion queue.
+ * Use this function after the time out of dma32_wait_ticket, before touching the destination by CPU.
+ *
+ * Parameters
+ * r0: Ticket
+ *
+ * Return: r0 (0 as Canceled, 1 as Not Pending)
+ */
+.globl dma32_cancel
+dma32_cancel:
+	/* Auto (Local) Variables, but just Aliases */
+	ticket       .req r0
+	slot         .req r1
+	channel      .req r2
+	temp         .req r3
+	save_cpsr    .req r4
+
+	push {r4,lr}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	cmp ticket, #0
+	beq dma32_cancel_error
+
+	ldr slot, dma32_pool_slot_addr
+	mov channel, #0
+
+	dma32_cancel_loop:
+		ldr temp, [slot, channel, lsl #3]
+		cmp temp, ticket
+		beq dma32_cancel_found
+		add channel, channel, #1
+		cmp channel, #15
+		blo dma32_cancel_loop
+
+	b dma32_cancel_error
+
+	dma32_cancel_found:
+		mov temp, #equ32_peripherals_base
+		add temp, temp, #equ32_dma_base
+		add temp, temp, channel, lsl #8            @ Multiply by equ32_dma_channel_offset
+		mov ip, #equ32_dma_cs_reset
+		str ip, [temp, #equ32_dma_cs]
+
+		macro32_dsb ip
+
+		add slot, slot, channel, lsl #3
+		mov temp, #0
+		str temp, [slot]
+
+		push {r0-r3}
+		ldr r0, [slot, #4]
+		bl dma32_pool_freechain
+		pop {r0-r3}
+
+		ldr temp, dma32_pool_busy
+		mov ip, #1
+		bic temp, temp, ip, lsl channel
+		str temp, dma32_pool_busy
+
+		b dma32_cancel_success
+
+	dma32_cancel_error:
+		mov r0, #1
+		b dma32_cancel_common
+
+	dma32_cancel_success:
+		mov r0, #0
+
+	dma32_cancel_common:
+		msr cpsr_c, save_cpsr
+		macro32_dsb ip
+		pop {r4,pc}
+
+.unreq ticket
+.unreq slot
+.unreq channel
+.unreq temp
+.unreq save_cpsr
+
+
+/**
+ * function dma32_complete
+ * Take Ticket from Completion Queue
+ *
+ * Return: r0 (Ticket, Bit[31] Is Set If DMA Error, 0 as Empty Queue)
+ */
+.globl dma32_complete
+dma32_complete:
+	/* Auto (Local) Variables, but just Aliases */
+	ticket       .req r0
+	head         .req r1
+	tail         .req r2
+	ring         .req r3
+
+	ldr head, DMA32_COMPLETE_HEAD
+	ldr tail, DMA32_COMPLETE_TAIL
+	cmp head, tail
+	moveq ticket, #0
+	beq dma32_complete_common
+
+	ldr ring, DMA32_COMPLETE_RING_ADDR
+	and head, tail, #equ32_dma32_pool_ring_size - 1
+	ldr ticket, [ring, head, lsl #2]
+	add tail, tail, #1
+	macro32_dsb ip
+	str tail, DMA32_COMPLETE_TAIL
+
+	dma32_complete_common:
+		mov pc, lr
+
+.unreq ticket
+.unreq head
+.unreq tail
+.unreq ring
+
+
+/**
+ * function dma32_pool_init
+ * Initialize DMA Pool
+ * All transfers on the pool should be completed before calling this function.
+ *
+ * Parameters
+ * r0: Channels for Pool, Bit[14:0], Avoid Channels Used by Other Functions and VideoCore
+ * r1: 0 as Polling Only, 1 as Enabling DMA Interrupts of Channels for dma32_irq
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Transfer Is Active on Pool
+ */
+.globl dma32_pool_init
+dma32_pool_init:
+	/* Auto (Local) Variables, but just Aliases */
+	mask_channel .req r0
+	flag_irq     .req r1
+	temp         .req r2
+	temp2        .req r3
+	save_cpsr    .req r4
+
+	push {r4}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr temp, dma32_pool_busy
+	cmp temp, #0
+	bne dma32_pool_init_error
+
+	lsl mask_channel, mask_channel, #17
+	lsr mask_channel, mask_channel, #17            @ Bit[14:0]
+	str mask_channel, DMA32_POOL_CHANNEL
+
+	/* Clear Bitmap of CBs */
+	ldr temp2, dma32_pool_cbmap_addr
+	add ip, temp2, #equ32_dma32_cb_pool_size / 8
+	mov temp, #0
+	dma32_pool_init_map:
+		str temp, [temp2], #4
+		cmp temp2, ip
+		blo dma32_pool_init_map
+
+	str temp, DMA32_COMPLETE_HEAD
+	str temp, DMA32_COMPLETE_TAIL
+
+	/* IRQs 16-26 for Channel 0-10, IRQ 27 Is Shared with Channel 11-14 */
+	mov temp, mask_channel, lsl #21
+	lsr temp, temp, #5                             @ Bit[10:0] to Bit[26:16]
+	tst mask_channel, #0x7800
+	orrne temp, temp, #1<<27
+
+	mov temp2, #equ32_peripherals_base
+	add temp2, temp2, #equ32_interrupt_base
+	cmp flag_irq, #0
+	strne temp, [temp2, #equ32_interrupt_enable_irqs1]
+	streq temp, [temp2, #equ32_interrupt_disable_irqs1]
+
+	b dma32_pool_init_success
+
+	dma32_pool_init_error:
+		mov r0, #1
+		b dma32_pool_init_common
+
+	dma32_pool_init_success:
+		mov r0, #0
+
+	dma32_pool_init_common:
+		msr cpsr_c, save_cpsr
+		macro32_dsb ip
+		pop {r4}
+		mov pc, lr
+
+.unreq mask_channel
+.unreq flag_irq
+.unreq temp
+.unreq temp2
+.unreq save_cpsr
+
+
+/**
+ * function dma32_pool_claim
+ * Claim Channel from DMA Pool for Exclusive Use
+ * The highest free channel in DMA32_POOL_CHANNEL is removed from it, so dma32_submit doesn't use the channel.
+ * Use this function for a chain which runs long or endlessly, e.g., gpio32_dmaplay, then return the channel by dma32_pool_release.
+ * If the interrupts of the pool are enabled, don't set INTEN on the chain, because dma32_irq doesn't clear a claimed channel.
+ *
+ * Return: r0 (Channel, -1 as Error)
+ * Error: No Free Channel in Pool
+ */
+.globl dma32_pool_claim
+dma32_pool_claim:
+	/* Auto (Local) Variables, but just Aliases */
+	channel      .req r0
+	free         .req r1
+	temp         .req r2
+	save_cpsr    .req r3
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr free, DMA32_POOL_CHANNEL
+	ldr temp, dma32_pool_busy
+	bic free, free, temp
+	cmp free, #0
+	mvneq channel, #0
+	beq dma32_pool_claim_common
+
+	/* Highest Free Channel, Low Channels (Full) Are Left to dma32_submit */
+	clz temp, free
+	rsb channel, temp, #31
+
+	ldr free, DMA32_POOL_CHANNEL
+	mov temp, #1
+	bic free, free, temp, lsl channel
+	str free, DMA32_POOL_CHANNEL
+
+	dma32_pool_claim_common:
+		msr cpsr_c, save_cpsr
+		macro32_dsb ip
+		mov pc, lr
+
+.unreq channel
+.unreq free
+.unreq temp
+.unreq save_cpsr
+
+
+/**
+ * function dma32_pool_release
+ * Release Channel Claimed by dma32_pool_claim
+ * The channel is returned to DMA32_POOL_CHANNEL. Stop the channel beforehand.
+ *
+ * Parameters
+ * r0: Channel
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Channel Is Overflow
+ */
+.globl dma32_pool_release
+dma32_pool_release:
+	/* Auto (Local) Variables, but just Aliases */
+	channel      .req r0
+	mask         .req r1
+	temp         .req r2
+	save_cpsr    .req r3
+
+	cmp channel, #15
+	movhs r0, #1
+	bhs dma32_pool_release_common
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr mask, DMA32_POOL_CHANNEL
+	mov temp, #1
+	orr mask, mask, temp, lsl channel
+	str mask, DMA32_POOL_CHANNEL
+
+	msr cpsr_c, save_cpsr
+	macro32_dsb ip
+
+	mov r0, #0
+
+	dma32_pool_release_common:
+		mov pc, lr
+
+.unreq channel
+.unreq mask
+.unreq temp
+.unreq save_cpsr
+
+
+/**
+ * Free Chain of CBs on DMA Pool
+ * r0: First CB Number
+ */
+dma32_pool_freechain:
+	/* Auto (Local) Variables, but just Aliases */
+	number_cb    .req r0
+	addr_cb      .req r1
+	map          .req r2
+	temp         .req r3
+	index        .req r4
+	bit          .req r5
+
+	push {r4-r5}
+
+	ldr map, dma32_pool_cbmap_addr
+
+	dma32_pool_freechain_loop:
+		sub index, number_cb, #equ32_dma32_cb_pool_start
+		cmp index, #equ32_dma32_cb_pool_size
+		bhs dma32_pool_freechain_common           @ If Out of Pool
+
+		and bit, index, #0x1F
+		lsr index, index, #5
+		ldr temp, [map, index, lsl #2]
+		mov addr_cb, #1
+		bic temp, temp, addr_cb, lsl bit
+		str temp, [map, index, lsl #2]
+
+		ldr addr_cb, DMA32_CB
+		add temp, addr_cb, number_cb, lsl #5
+		ldr temp, [temp, #dma32_nextconbk]
+		cmp temp, #0
+		beq dma32_pool_freechain_common
+
+		sub temp, temp, #equ32_bus_coherence_base
+		sub temp, temp, addr_cb
+		lsr number_cb, temp, #5
+		b dma32_pool_freechain_loop
+
+	dma32_pool_freechain_common:
+		pop {r4-r5}
+		mov pc, lr
+
+.unreq number_cb
+.unreq addr_cb
+.unreq map
+.unreq temp
+.unreq index
+.unreq bit
+
+.globl DMA32_POOL_CHANNEL
+.globl DMA32_POOL_TICKET
+.globl DMA32_COMPLETE_OVERFLOW
+.balign 4
+DMA32_POOL_CHANNEL:          .word equ32_dma32_pool_channel @ Channels for dma32_submit
+DMA32_POOL_TICKET:           .word 0x01 @ Next Ticket
+DMA32_COMPLETE_HEAD:         .word 0x00 @ Free-running Index, Incremented by dma32_irq Only
+DMA32_COMPLETE_TAIL:         .word 0x00 @ Free-running Index, Incremented by dma32_complete Only
+DMA32_COMPLETE_OVERFLOW:     .word 0x00 @ Number of Tickets Not Queued Because of Full Queue
+DMA32_COMPLETE_RING_ADDR:    .word dma32_complete_ring
+DMA32_ERROR_INDEX:           .word 0x00 @ Free-running Index of Error Ring, Incremented by dma32_irq Only
+DMA32_ERROR_RING_ADDR:       .word dma32_error_ring
+dma32_pool_busy:             .word 0x00 @ Channels in Use, Bit[14:0]
+dma32_pool_cbmap_addr:       .word dma32_pool_cbmap
+dma32_pool_slot_addr:        .word dma32_pool_slot
+
+.balign 4
+dma32_complete_ring:         .space 4 * equ32_dma32_pool_ring_size
+dma32_error_ring:            .space 4 * equ32_dma32_pool_error_size @ Tickets Stopped with DMA Error, 0 as Empty
+dma32_pool_cbmap:            .space equ32_dma32_cb_pool_size / 8 @ Bitmap of CBs on Pool, 1 as Allocated
+dma32_pool_slot:             .space 8 * 15 @ Ticket (0 as Idle) and First CB Number for Each Channel
+
+
 .globl DMA32_CB
 DMA32_CB:        .word _DMA32_CB
 
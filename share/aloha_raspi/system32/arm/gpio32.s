@@ -28,6 +28,12 @@ GPIO32_LANE:           .word 0    @ Current LANE to Handle
  * 2. Place `_gpioset` with needed arguments in `user32.c`.
  * 3. GPIO sequence automatically runs with the assigned values.
  * 4. If you want to stop the GPIO sequence, use `_gpioclear`.
+ *
+ * Usage with DMA (No FIQ/IRQ on Each Beat)
+ * 1. Compile a GPIO sequence to a 256-bit aligned address in a heap block by `gpio32_seq_compile` in share/include/gpio32/sequencer.c.
+ * 2. Set the timebase by `_gpiodmatimebase`.
+ * 3. Place `_gpiodmaplay` with the address and the size of the compiled chain.
+ * 4. If you want to stop the GPIO sequence, use `_gpiodmastop`.
  */
 
 /**
@@ -827,3 +833,279 @@ gpio32_gpioreset:
 .unreq memorymap_base
 .unreq temp
 
+
+/**
+ * function gpio32_dmaplay
+ * Play Chain of DMA Control Blocks (CBs) Compiled from GPIO Sequence
+ * The chain is made by gpio32_seq_compile in share/include/gpio32/sequencer.c,
+ * with the bus address of the buffer (ARM side address + equ32_bus_coherence_base).
+ * Each beat waits for DREQ of PWM or PCM, so set the timebase beforehand, e.g., by gpio32_dmatimebase.
+ * Beats run on DMA only, so gpio32_gpioplay is not needed on FIQ/IRQ.
+ * The channel is claimed from the DMA pool (dma32_pool_claim) on the first play, and released by gpio32_dmastop.
+ * The chain on the claimed channel is replaced with the new one. The chain runs on a lite channel too (one word per CB).
+ * Heap blocks are 4-byte aligned, so allocate 28 bytes more, and compile to the 256-bit aligned address in the block.
+ *
+ * Parameters
+ * r0: Pointer of Chain of CBs, 256-bit Aligned
+ * r1: Size of Chain (Bytes), Returned by gpio32_seq_compile
+ *
+ * Return: r0 (0 as success, 1 and 2 as error)
+ * Error(1): Pointer is null or not 256-bit aligned, or size is zero
+ * Error(2): No free channel in the DMA pool
+ */
+.globl gpio32_dmaplay
+gpio32_dmaplay:
+	/* Auto (Local) Variables, but just Aliases */
+	buffer         .req r0 @ Parameter, Register for Argument and Result, Scratch Register
+	size           .req r1 @ Parameter, Register for Argument, Scratch Register
+	memorymap_base .req r2
+	temp           .req r3
+	channel        .req r4
+
+	push {r4,lr}
+
+	cmp buffer, #0
+	beq gpio32_dmaplay_error1
+	tst buffer, #0x1F
+	bne gpio32_dmaplay_error1
+	cmp size, #0
+	beq gpio32_dmaplay_error1
+
+	ldr channel, gpio32_dma_channel
+	cmn channel, #1
+	bne gpio32_dmaplay_cache
+
+	push {r0-r3}
+	bl dma32_pool_claim
+	mov channel, r0
+	pop {r0-r3}
+
+	cmn channel, #1
+	beq gpio32_dmaplay_error2
+	str channel, gpio32_dma_channel
+
+	gpio32_dmaplay_cache:
+		/* One Range (Start Address, Length) on Stack */
+		push {r0-r3}
+		mov r0, sp
+		mov r1, #1
+		mov r2, #1                                @ Clean
+		bl arm32_cache_operation_range
+		pop {r0-r3}
+
+	/* Transform to Bus Address */
+	add buffer, buffer, #equ32_bus_coherence_base
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_dma_base
+
+	ldr temp, [memorymap_base, #equ32_dma_channel_enable]
+	mov ip, #1
+	orr temp, temp, ip, lsl channel
+	str temp, [memorymap_base, #equ32_dma_channel_enable]
+
+	macro32_dsb ip
+
+	add memorymap_base, memorymap_base, channel, lsl #8         @ Multiply by equ32_dma_channel_offset
+
+	/* Reset DMA, Current Chain Is Aborted */
+	mov temp, #equ32_dma_cs_reset
+	str temp, [memorymap_base, #equ32_dma_cs]
+
+	macro32_dsb ip
+
+	str buffer, [memorymap_base, #equ32_dma_conblk_ad]
+
+	macro32_dsb ip
+
+	mov temp, #equ32_dma_cs_active|equ32_dma_cs_wait_writes
+	str temp, [memorymap_base, #equ32_dma_cs]
+
+	macro32_dsb ip
+
+	b gpio32_dmaplay_success
+
+	gpio32_dmaplay_error1:
+		mov r0, #1
+		b gpio32_dmaplay_common
+
+	gpio32_dmaplay_error2:
+		mov r0, #2
+		b gpio32_dmaplay_common
+
+	gpio32_dmaplay_success:
+		mov r0, #0
+
+	gpio32_dmaplay_common:
+		pop {r4,pc}
+
+.unreq buffer
+.unreq size
+.unreq memorymap_base
+.unreq temp
+.unreq channel
+
+
+/**
+ * function gpio32_dmastop
+ * Stop Chain of DMA Control Blocks Played by gpio32_dmaplay
+ * The current beat is completed, so the timebase should run until this function returns.
+ * GPIO stays the status of the last beat. The channel is released to the DMA pool.
+ *
+ * Return: r0 (0 as success)
+ */
+.globl gpio32_dmastop
+gpio32_dmastop:
+	/* Auto (Local) Variables, but just Aliases */
+	channel        .req r0
+
+	push {lr}
+
+	ldr channel, gpio32_dma_channel
+	cmn channel, #1
+	beq gpio32_dmastop_success
+
+	bl dma32_clear_channel
+
+	ldr channel, gpio32_dma_channel
+	bl dma32_pool_release
+
+	mvn channel, #0
+	str channel, gpio32_dma_channel
+
+	gpio32_dmastop_success:
+		mov r0, #0
+
+	gpio32_dmastop_common:
+		pop {pc}
+
+.unreq channel
+
+
+/**
+ * function gpio32_dmacapture
+ * Snapshot of Capture by Chain of DMA Control Blocks Played by gpio32_dmaplay
+ * The range of captured data is invalidated in the data cache, then the current CB is returned.
+ * E.g., the chain compiled by softuart32_cap_compile in share/include/softuart32/capture.c copies GPLEV0 on each beat,
+ * and softuart32_cap_head converts the current CB to the index of the ring of levels.
+ *
+ * Parameters
+ * r0: Pointer of Captured Data
+ * r1: Size of Captured Data (Bytes)
+ *
+ * Return: r0 (Bus Address of Current CB, 0 as Not Active)
+ */
+.globl gpio32_dmacapture
+gpio32_dmacapture:
+	/* Auto (Local) Variables, but just Aliases */
+	data           .req r0 @ Parameter, Register for Argument and Result, Scratch Register
+	size           .req r1 @ Parameter, Register for Argument, Scratch Register
+	memorymap_base .req r2
+	temp           .req r3
+
+	/* One Range (Start Address, Length) on Stack */
+	push {r0-r3,lr}
+	mov r0, sp
+	mov r1, #1
+	mov r2, #0                                @ Invalidate
+	bl arm32_cache_operation_range
+	pop {r0-r3,lr}
+
+	ldr temp, gpio32_dma_channel
+	cmn temp, #1
+	moveq r0, #0
+	beq gpio32_dmacapture_common
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_dma_base
+	add memorymap_base, memorymap_base, temp, lsl #8         @ Multiply by equ32_dma_channel_offset
+
+	ldr temp, [memorymap_base, #equ32_dma_cs]
+	tst temp, #equ32_dma_cs_active
+	moveq r0, #0
+	ldrne r0, [memorymap_base, #equ32_dma_conblk_ad]
+
+	gpio32_dmacapture_common:
+		mov pc, lr
+
+.unreq data
+.unreq size
+.unreq memorymap_base
+.unreq temp
+
+gpio32_dma_channel: .word 0xFFFFFFFF @ Channel Claimed from DMA Pool by gpio32_dmaplay, -1 as None
+
+
+/**
+ * function gpio32_dmatimebase
+ * Set PWM as Timebase of Chain of DMA Control Blocks Played by gpio32_dmaplay
+ * Caution! PWM is occupied, so this function conflicts with PWM mode of snd32 and pwm32.
+ * To use PCM as the timebase, initialize PCM with its FIFO and DREQ, e.g., by snd32_soundinit_i2s,
+ * and compile the chain with GPIO32_SEQ_TIMEBASE_PCM.
+ * One beat takes clock divisors * range / 500Mhz (PLLD). E.g., divisors 5.0 and range 50 make 2Mhz.
+ * PWM is not connected with any GPIO, and the threshold of DREQ is one not to burst beats into FIFO.
+ *
+ * Parameters
+ * r0: Clock Divisors, Fixed Point, Bit[23:12] as Integer, Bit[11:0] as Fractional
+ * r1: Range of PWM0 (Clocks per Beat)
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Range is zero
+ */
+.globl gpio32_dmatimebase
+gpio32_dmatimebase:
+	/* Auto (Local) Variables, but just Aliases */
+	divisors       .req r0 @ Parameter, Register for Argument and Result, Scratch Register
+	range          .req r1 @ Parameter, Register for Argument, Scratch Register
+	memorymap_base .req r2
+	value          .req r3
+
+	cmp range, #0
+	beq gpio32_dmatimebase_error
+
+	push {r0-r3,lr}
+	mov r2, divisors
+	mov r0, #equ32_cm_pwm
+	mov r1, #equ32_cm_ctl_mash_1
+	add r1, r1, #equ32_cm_ctl_enab|equ32_cm_ctl_src_plld            @ 500Mhz
+	bl arm32_clockmanager
+	pop {r0-r3,lr}
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_pwm_base_lower
+	add memorymap_base, memorymap_base, #equ32_pwm_base_upper
+
+	mov value, #0
+	str value, [memorymap_base, #equ32_pwm_ctl]
+
+	macro32_dsb ip
+
+	str range, [memorymap_base, #equ32_pwm_rng1]
+
+	mov value, #equ32_pwm_dmac_enable
+	orr value, value, #1<<equ32_pwm_dmac_panic
+	orr value, value, #1<<equ32_pwm_dmac_dreq
+	str value, [memorymap_base, #equ32_pwm_dmac]
+
+	mov value, #equ32_pwm_ctl_clrf1|equ32_pwm_ctl_usef1|equ32_pwm_ctl_pwen1
+	str value, [memorymap_base, #equ32_pwm_ctl]
+
+	macro32_dsb ip
+
+	b gpio32_dmatimebase_success
+
+	gpio32_dmatimebase_error:
+		mov r0, #1
+		b gpio32_dmatimebase_common
+
+	gpio32_dmatimebase_success:
+		mov r0, #0
+
+	gpio32_dmatimebase_common:
+		mov pc, lr
+
+.unreq divisors
+.unreq range
+.unreq memorymap_base
+.unreq value
+
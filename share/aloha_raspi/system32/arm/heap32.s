@@ -342,6 +342,253 @@ heap32_mpop:
 .unreq save_cpsr
 
 
+/**
+ * function heap32_mringmalloc
+ * Make Ring Buffer for Single Producer and Single Consumer
+ * The ring buffer has three words for head index, tail index, and mask, and data space in bytes.
+ * Head and tail are free-running indexes, and only the producer writes head and only the consumer writes tail.
+ * So, the producer and the consumer can be in different contexts, e.g., IRQ and user mode, without disabling interrupts.
+ * Use heap32_mfree to free the ring buffer.
+ *
+ * Parameters
+ * r0: Size of Data Space (Words), Rounded Down to Power of 2
+ *
+ * Return: r0 (Pointer of Ring Buffer, If 0, No Enough Space to Allocate)
+ */
+.globl heap32_mringmalloc
+heap32_mringmalloc:
+	/* Auto (Local) Variables, but just Aliases */
+	words       .req r0
+	ring        .req r1
+	temp        .req r2
+
+	push {lr}
+
+	cmp words, #0
+	beq heap32_mringmalloc_error
+
+	clz temp, words
+	mov words, #0x80000000
+	lsr words, words, temp                      @ Round Down to Power of 2
+
+	push {r0}
+	add r0, words, #3                           @ Add Head, Tail, and Mask
+	bl heap32_malloc
+	mov ring, r0
+	pop {r0}
+
+	cmp ring, #0
+	beq heap32_mringmalloc_error
+
+	mov temp, #0
+	str temp, [ring, #equ32_heap32_mring_head]
+	str temp, [ring, #equ32_heap32_mring_tail]
+	lsl words, words, #2                        @ Substitution of Multiplication by 4
+	sub words, words, #1
+	str words, [ring, #equ32_heap32_mring_mask]
+
+	b heap32_mringmalloc_success
+
+	heap32_mringmalloc_error:
+		mov r0, #0
+		b heap32_mringmalloc_common
+
+	heap32_mringmalloc_success:
+		mov r0, ring
+
+	heap32_mringmalloc_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq words
+.unreq ring
+.unreq temp
+
+
+/**
+ * function heap32_mringwrite
+ * Write Bytes to Ring Buffer (Producer Side)
+ * Call this function only from one producer per ring buffer.
+ *
+ * Parameters
+ * r0: Pointer of Ring Buffer
+ * r1: Pointer of Bytes to Be Written
+ * r2: Size (Bytes)
+ *
+ * Return: r0 (Size (Bytes) Written, Less Than r2 If Ring Buffer Is Full)
+ */
+.globl heap32_mringwrite
+heap32_mringwrite:
+	/* Auto (Local) Variables, but just Aliases */
+	ring        .req r0
+	heap        .req r1
+	size        .req r2
+	head        .req r3
+	tail        .req r4
+	mask        .req r5
+	byte        .req r6
+	count       .req r7
+	temp        .req r8
+
+	push {r4-r8}
+
+	mov count, #0
+
+	cmp ring, #0
+	beq heap32_mringwrite_common
+
+	ldr head, [ring, #equ32_heap32_mring_head]
+	ldr tail, [ring, #equ32_heap32_mring_tail]
+	ldr mask, [ring, #equ32_heap32_mring_mask]
+
+	macro32_dsb ip                              @ Ensure Completion of Reading Tail Before Overwriting Data
+
+	heap32_mringwrite_loop:
+		cmp count, size
+		bhs heap32_mringwrite_publish
+
+		sub temp, head, tail
+		cmp temp, mask
+		bhi heap32_mringwrite_publish           @ If Full
+
+		ldrb byte, [heap, count]
+		and temp, head, mask
+		add temp, temp, #equ32_heap32_mring_data
+		strb byte, [ring, temp]
+
+		add head, head, #1
+		add count, count, #1
+		b heap32_mringwrite_loop
+
+	heap32_mringwrite_publish:
+		macro32_dsb ip                          @ Ensure Completion of Writing Data Before Publishing Head
+		str head, [ring, #equ32_heap32_mring_head]
+
+	heap32_mringwrite_common:
+		macro32_dsb ip
+		mov r0, count
+		pop {r4-r8}
+		mov pc, lr
+
+.unreq ring
+.unreq heap
+.unreq size
+.unreq head
+.unreq tail
+.unreq mask
+.unreq byte
+.unreq count
+.unreq temp
+
+
+/**
+ * function heap32_mringread
+ * Read Bytes from Ring Buffer (Consumer Side)
+ * Call this function only from one consumer per ring buffer.
+ *
+ * Parameters
+ * r0: Pointer of Ring Buffer
+ * r1: Pointer of Memory Space to Store Bytes
+ * r2: Maximum Size (Bytes)
+ *
+ * Return: r0 (Size (Bytes) Read, 0 If Ring Buffer Is Empty)
+ */
+.globl heap32_mringread
+heap32_mringread:
+	/* Auto (Local) Variables, but just Aliases */
+	ring        .req r0
+	heap        .req r1
+	size        .req r2
+	head        .req r3
+	tail        .req r4
+	mask        .req r5
+	byte        .req r6
+	count       .req r7
+	temp        .req r8
+
+	push {r4-r8}
+
+	mov count, #0
+
+	cmp ring, #0
+	beq heap32_mringread_common
+
+	ldr head, [ring, #equ32_heap32_mring_head]
+	ldr tail, [ring, #equ32_heap32_mring_tail]
+	ldr mask, [ring, #equ32_heap32_mring_mask]
+
+	macro32_dsb ip                              @ Ensure Completion of Reading Head Before Reading Data
+
+	heap32_mringread_loop:
+		cmp count, size
+		bhs heap32_mringread_publish
+
+		cmp tail, head
+		beq heap32_mringread_publish            @ If Empty
+
+		and temp, tail, mask
+		add temp, temp, #equ32_heap32_mring_data
+		ldrb byte, [ring, temp]
+		strb byte, [heap, count]
+
+		add tail, tail, #1
+		add count, count, #1
+		b heap32_mringread_loop
+
+	heap32_mringread_publish:
+		macro32_dsb ip                          @ Ensure Completion of Reading Data Before Publishing Tail
+		str tail, [ring, #equ32_heap32_mring_tail]
+
+	heap32_mringread_common:
+		macro32_dsb ip
+		mov r0, count
+		pop {r4-r8}
+		mov pc, lr
+
+.unreq ring
+.unreq heap
+.unreq size
+.unreq head
+.unreq tail
+.unreq mask
+.unreq byte
+.unreq count
+.unreq temp
+
+
+/**
+ * function heap32_mringcount
+ * Count Bytes in Ring Buffer
+ *
+ * Parameters
+ * r0: Pointer of Ring Buffer
+ *
+ * Return: r0 (Size (Bytes) Stored in Ring Buffer)
+ */
+.globl heap32_mringcount
+heap32_mringcount:
+	/* Auto (Local) Variables, but just Aliases */
+	ring        .req r0
+	head        .req r1
+	tail        .req r2
+
+	cmp ring, #0
+	beq heap32_mringcount_common
+
+	macro32_dsb ip
+
+	ldr head, [ring, #equ32_heap32_mring_head]
+	ldr tail, [ring, #equ32_heap32_mring_tail]
+	sub r0, head, tail
+
+	heap32_mringcount_common:
+		mov pc, lr
+
+.unreq ring
+.unreq head
+.unreq tail
+
+
 /**
  * function heap32_clear_heap
  * Clear (All Zero) in Heap
@@ -698,6 +945,10 @@ heap32_mcount:
 /**
  * function heap32_mcopy
  * Copy Value in Memory
+ * Bounds are checked once, then bytes are copied by blocks of 8 words if both pointers have the same word alignment.
+ * In privileged mode, the middle part is copied by DMA (dma32_submit) if the length is equ32_heap32_mcopy_dmathres or more,
+ * and the destination doesn't overlap the source. If the destination overlaps the source forward, bytes are copied by CPU.
+ * If the destination overlaps the source backward, bytes are copied one by one in the forward order.
  *
  * Parameters
  * r0: Pointer of Start Address of Memory Space to Be Destination
@@ -722,13 +973,14 @@ heap32_mcopy:
 	byte         .req r7
 	heap_start   .req r8
 	heap_size    .req r9
-	heap1_dup    .req r10
+	head         .req r10
+	heap1_dup    .req r11
 
-	push {r4-r10}
+	push {r4-r11,lr}
 
-	add sp, sp, #28                           @ r4-r10 offset 28 bytes
+	add sp, sp, #36                           @ r4-r11 and lr offset 36 bytes
 	pop {size}                                @ Get Fifth Arguments
-	sub sp, sp, #32                           @ Retrieve SP
+	sub sp, sp, #40                           @ Retrieve SP
 
 	macro32_dsb ip                            @ Ensure Completion of Instructions Before
 
@@ -763,21 +1015,83 @@ heap32_mcopy:
 	add heap1, heap1, offset1                 @ Add Offset for Destination
 	add heap2, heap2, offset2                 @ Add Offset for Source
 
-	heap32_mcopy_loop:
-		cmp heap1, heap1_size
-		bhs heap32_mcopy_success
-		cmp heap2, heap2_size
-		bhs heap32_mcopy_success
+	/* Clip Length by Ends of Both Memory Spaces */
+	sub heap1_size, heap1_size, heap1
+	sub heap2_size, heap2_size, heap2
+	cmp size, heap1_size
+	movgt size, heap1_size
+	cmp size, heap2_size
+	movgt size, heap2_size
+	cmp size, #0
+	ble heap32_mcopy_success
+
+	/* Backward Overlap Needs Byte by Byte in Forward Order */
+	cmp heap1, heap2
+	bls heap32_mcopy_forward
+	add byte, heap2, size
+	cmp heap1, byte
+	blo heap32_mcopy_byte
+	b heap32_mcopy_dma
 
-		ldrb byte, [heap2]
-		strb byte, [heap1]
+	/**
+	 * Forward Overlap Is Copied by CPU in Forward Order
+	 * DMA writes the middle part before CPU copies the head, so DMA would overwrite the source of the head.
+	 */
+	heap32_mcopy_forward:
+		add byte, heap1, size
+		cmp heap2, byte
+		blo heap32_mcopy_cpu
+
+	heap32_mcopy_dma:
+		cmp size, #equ32_heap32_mcopy_dmathres
+		blo heap32_mcopy_cpu
+		mrs byte, cpsr
+		and byte, byte, #0x1F
+		cmp byte, #equ32_user_mode
+		beq heap32_mcopy_cpu                  @ DMA and Cache Operations Are Privileged
+
+		/* Middle Part Aligned by 64 Bytes on Destination to Own Whole Cache Lines */
+		rsb head, heap1, #0
+		and head, head, #0x3F
+		sub heap_size, size, head
+		bic heap_size, heap_size, #0x3F
+
+		push {r0-r3}
+		add r0, heap1, head
+		add r1, heap2, head
+		mov r2, heap_size
+		bl heap32_mcopy_dmacopy
+		mov byte, r0
+		pop {r0-r3}
+		cmp byte, #0
+		bne heap32_mcopy_cpu                  @ If DMA Is Not Available
+
+		/* Head and Tail by CPU */
+		push {r0-r3}
+		mov r1, heap2                         @ Source Before r2 (heap2) Is Overwritten
+		mov r2, head
+		bl heap32_mcopy_block
+		pop {r0-r3}
 
-		add heap1, heap1, #1
-		add heap2, heap2, #1
-		sub size, size, #1
-		cmp size, #0
-		ble heap32_mcopy_success
-		b heap32_mcopy_loop               @ If Bytes are not Zero
+		add byte, head, heap_size
+		add r0, heap1, byte
+		add r1, heap2, byte
+		sub r2, size, byte
+		bl heap32_mcopy_block
+		b heap32_mcopy_success
+
+	heap32_mcopy_cpu:
+		mov r1, heap2
+		mov r2, size
+		bl heap32_mcopy_block
+		b heap32_mcopy_success
+
+	heap32_mcopy_byte:
+		ldrb byte, [heap2], #1
+		strb byte, [heap1], #1
+		subs size, size, #1
+		bgt heap32_mcopy_byte
+		b heap32_mcopy_success
 
 	heap32_mcopy_error:
 		mov r0, #0
@@ -788,8 +1102,7 @@ heap32_mcopy:
 
 	heap32_mcopy_common:
 		macro32_dsb ip                    @ Ensure Completion of Instructions Before
-		pop {r4-r10}
-		mov pc, lr
+		pop {r4-r11,pc}
 
 .unreq heap1
 .unreq offset1
@@ -801,9 +1114,168 @@ heap32_mcopy:
 .unreq byte
 .unreq heap_start
 .unreq heap_size
+.unreq head
 .unreq heap1_dup
 
 
+/**
+ * Copy Bytes in Forward Order by CPU for heap32_mcopy
+ * r0: Destination, r1: Source, r2: Length of Bytes
+ */
+heap32_mcopy_block:
+	/* Auto (Local) Variables, but just Aliases */
+	dst          .req r0
+	src          .req r1
+	length       .req r2
+	data         .req r3
+
+	push {r4-r10}
+
+	cmp length, #0
+	beq heap32_mcopy_block_common
+
+	/* Same Word Alignment on Both Enables Block Transfer */
+	eor ip, dst, src
+	tst ip, #3
+	bne heap32_mcopy_block_byte
+
+	heap32_mcopy_block_align:
+		tst dst, #3
+		beq heap32_mcopy_block_loop_pre
+		ldrb data, [src], #1
+		strb data, [dst], #1
+		subs length, length, #1
+		bne heap32_mcopy_block_align
+		b heap32_mcopy_block_common
+
+	heap32_mcopy_block_loop_pre:
+		subs length, length, #32
+		blo heap32_mcopy_block_word_pre
+
+	heap32_mcopy_block_loop:
+		pld [src, #64]
+		ldmia src!, {r3-r10}
+		stmia dst!, {r3-r10}
+		subs length, length, #32
+		bhs heap32_mcopy_block_loop
+
+	heap32_mcopy_block_word_pre:
+		add length, length, #32
+
+	heap32_mcopy_block_word:
+		subs length, length, #4
+		blo heap32_mcopy_block_byte_pre
+		ldr data, [src], #4
+		str data, [dst], #4
+		b heap32_mcopy_block_word
+
+	heap32_mcopy_block_byte_pre:
+		adds length, length, #4
+		beq heap32_mcopy_block_common
+
+	heap32_mcopy_block_byte:
+		ldrb data, [src], #1
+		strb data, [dst], #1
+		subs length, length, #1
+		bne heap32_mcopy_block_byte
+
+	heap32_mcopy_block_common:
+		pop {r4-r10}
+		mov pc, lr
+
+.unreq dst
+.unreq src
+.unreq length
+.unreq data
+
+
+/**
+ * Copy Bytes by DMA for heap32_mcopy, Privileged Mode Only
+ * r0: Destination (64 Bytes Align), r1: Source, r2: Length of Bytes (Multiple of 64)
+ * Return: r0 (0 as Success, 1 as Error)
+ */
+heap32_mcopy_dmacopy:
+	/* Auto (Local) Variables, but just Aliases */
+	dst          .req r4
+	src          .req r5
+	length       .req r6
+
+	push {r4-r6,lr}
+
+	mov dst, r0
+	mov src, r1
+	mov length, r2
+
+	/* Clean and Invalidate Source and Destination to Point of Coherency under One Barrier */
+	push {length}
+	push {dst}
+	push {length}
+	push {src}
+	mov r0, sp
+	mov r1, #2
+	mov r2, #2
+	bl arm32_cache_operation_range
+	add sp, sp, #16
+
+	/* One Segment on Stack */
+	mov r0, #0
+	push {r0}                                 @ 2D Stride
+	push {length}                             @ Transfer Length
+	add r0, dst, #equ32_bus_coherence_base
+	push {r0}                                 @ Destination Address
+	add r0, src, #equ32_bus_coherence_base
+	push {r0}                                 @ Source Address
+	mov r0, #0<<equ32_dma_ti_permap           @ DREQ Map for No DREQ
+	orr r0, r0, #4<<equ32_dma_ti_burst_length
+	orr r0, r0, #equ32_dma_ti_src_inc
+	orr r0, r0, #equ32_dma_ti_dst_inc
+	orr r0, r0, #equ32_dma_ti_wait_resp
+	push {r0}                                 @ Transfer Information
+	mov r0, sp
+	mov r1, #1
+	bl dma32_submit
+	add sp, sp, #dma32_segment
+	cmp r0, #0
+	beq heap32_mcopy_dmacopy_error            @ No Free Channel or CB
+
+	push {r0}
+	mov r1, length                            @ Time Out in Turns
+	bl dma32_wait_ticket
+	mov r1, r0
+	pop {r0}
+	cmp r1, #0
+	beq heap32_mcopy_dmacopy_done
+
+	/* Stop DMA Before Fallback to CPU, Otherwise DMA May Write Destination After CPU */
+	bl dma32_cancel
+	b heap32_mcopy_dmacopy_error
+
+	heap32_mcopy_dmacopy_done:
+		/* Drop Lines Speculatively Filled During DMA */
+		push {dst,length}
+		mov r0, sp
+		mov r1, #1
+		mov r2, #0
+		bl arm32_cache_operation_range
+		add sp, sp, #8
+
+		b heap32_mcopy_dmacopy_success
+
+	heap32_mcopy_dmacopy_error:
+		mov r0, #1
+		b heap32_mcopy_dmacopy_common
+
+	heap32_mcopy_dmacopy_success:
+		mov r0, #0
+
+	heap32_mcopy_dmacopy_common:
+		pop {r4-r6,pc}
+
+.unreq dst
+.unreq src
+.unreq length
+
+
 /**
  * function heap32_align_32
  * Align Heap By 32 Bytes (8 Words)
@@ -919,7 +1391,7 @@ heap32_mfill:
 	heap_start       .req r3
 	heap_size        .req r4
 
-	push {r4}
+	push {r4-r9}
 
 	macro32_dsb ip                              @ Ensure Completion of Instructions Before
 
@@ -939,6 +1411,22 @@ heap32_mfill:
 	cmp block_start, heap_start
 	blo heap32_mfill_error
 
+	/* Blocks of 8 Words */
+	mov r3, data
+	mov r4, data
+	mov r5, data
+	mov r6, data
+	mov r7, data
+	mov r8, data
+	mov r9, data
+	sub ip, block_size, block_start
+
+	heap32_mfill_block:
+		subs ip, ip, #32
+		blo heap32_mfill_loop
+		stmia block_start!, {r1,r3-r9}
+		b heap32_mfill_block
+
 	heap32_mfill_loop:
 		cmp block_start, block_size
 		bhs heap32_mfill_success
@@ -957,7 +1445,7 @@ heap32_mfill:
 
 	heap32_mfill_common:
 		macro32_dsb ip                      @ Ensure Completion of Instructions Before
-		pop {r4}
+		pop {r4-r9}
 		mov pc, lr
 
 .unreq block_start
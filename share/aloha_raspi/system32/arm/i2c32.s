@@ -260,3 +260,592 @@ macro32_debug temp, 0, 112
 .unreq byte
 .unreq temp
 .unreq addr_i2c
+
+
+/**
+ * Usage of Transaction Queue
+ * Functions above busy-poll the status register of BSC1 on each byte.
+ * With the queue, transactions (equ32_trans32_*) are submitted by i2c32_i2csubmit and run in the background.
+ * A transaction writes bytes of the write buffer, then reads bytes to the read buffer (Chained Write-then-read).
+ * Either length can be zero. FIFO is served by i2c32_i2cirq in IRQ (IRQ 53) or in i2c32_i2cpoll without IRQ.
+ * BSC1 sends STOP on DONE. So the read phase is started while the write phase is active (TA), before DONE,
+ * and BSC1 sends a repeated start between the phases (i2c32_i2cchain). This needs the whole write buffer in FIFO (16 bytes) in time.
+ * If DONE comes first, e.g., IRQ is late to the last byte of a long write buffer, the read phase is started after STOP.
+ * The status of the transaction becomes 0 on success, or 1-2 on error, the same as i2c32_i2ctx.
+ * If the callback of the transaction is not zero, it's called on completion with r0 as the pointer of the transaction.
+ * The callback runs in i2c32_i2cirq (IRQ or i2c32_i2cpoll) with IRQ disabled, so keep it short.
+ * Don't use i2c32_i2ctx and i2c32_i2crx while the queue is busy.
+ * Utilization: I2C32_QUEUE_BUSY / elapsed time. I2C32_QUEUE_IRQ is the number of services of FIFO, not time.
+ */
+
+
+/**
+ * function i2c32_i2csubmit
+ * Submit Transaction to I2C Queue without Waiting
+ *
+ * Parameters
+ * r0: Pointer of Transaction Entry, Status Other Than -1
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Entry Is Pending, or No Byte to Transfer
+ */
+.globl i2c32_i2csubmit
+i2c32_i2csubmit:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	temp         .req r1
+	tail         .req r2
+	temp2        .req r3
+	save_cpsr    .req r4
+
+	push {r4,lr}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr temp, [entry, #equ32_trans32_status]
+	cmp temp, #-1
+	beq i2c32_i2csubmit_error
+
+	ldr temp, [entry, #equ32_trans32_tx_length]
+	ldr temp2, [entry, #equ32_trans32_rx_length]
+	orrs temp, temp, temp2
+	beq i2c32_i2csubmit_error
+
+	mvn temp, #0
+	str temp, [entry, #equ32_trans32_status]
+	mov temp, #0
+	str temp, [entry, #equ32_trans32_next]
+	str temp, [entry, #equ32_trans32_count_tx]
+	str temp, [entry, #equ32_trans32_count_rx]
+
+	ldr tail, I2C32_QUEUE_TAIL
+	cmp tail, #0
+	strne entry, [tail, #equ32_trans32_next]
+	str entry, I2C32_QUEUE_TAIL
+	bne i2c32_i2csubmit_success
+
+	/* Start If Queue Was Empty */
+	str entry, I2C32_QUEUE_HEAD
+	mov r1, #0
+	bl i2c32_i2cstart
+
+	b i2c32_i2csubmit_success
+
+	i2c32_i2csubmit_error:
+		mov r0, #1
+		b i2c32_i2csubmit_common
+
+	i2c32_i2csubmit_success:
+		mov r0, #0
+
+	i2c32_i2csubmit_common:
+		macro32_dsb ip
+		msr cpsr_c, save_cpsr
+		pop {r4,pc}
+
+.unreq entry
+.unreq temp
+.unreq tail
+.unreq temp2
+.unreq save_cpsr
+
+
+/**
+ * function i2c32_i2cirq
+ * Serve FIFO of Transaction on Head of I2C Queue
+ * Call this function in IRQ with the interrupt enabled by i2c32_i2cqueueinit.
+ *
+ * Return: r0 (0 as Idle, 1 as Busy)
+ */
+.globl i2c32_i2cirq
+i2c32_i2cirq:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	addr_i2c     .req r1
+	status       .req r2
+	temp         .req r3
+	save_cpsr    .req r4
+	control      .req r5
+	result       .req r6
+
+	push {r4-r6,lr}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr entry, I2C32_QUEUE_HEAD
+	cmp entry, #0
+	beq i2c32_i2cirq_idle
+
+	ldr temp, I2C32_QUEUE_IRQ
+	add temp, temp, #1
+	str temp, I2C32_QUEUE_IRQ
+
+	mov addr_i2c, #equ32_peripherals_base
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_upper
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_lower
+
+	ldr status, [addr_i2c, #equ32_i2c_s]
+
+	tst status, #equ32_i2c_s_err
+	movne result, #1
+	bne i2c32_i2cirq_finish
+
+	tst status, #equ32_i2c_s_clkt
+	movne result, #2
+	bne i2c32_i2cirq_finish
+
+	ldr control, [addr_i2c, #equ32_i2c_c]
+	tst control, #equ32_i2c_c_read
+	bne i2c32_i2cirq_read
+
+	push {r0-r3}
+	bl i2c32_i2cfill
+	pop {r0-r3}
+
+	tst status, #equ32_i2c_s_done
+	bne i2c32_i2cirq_write
+
+	/* Repeated Start If Whole Write Buffer Is in FIFO */
+	push {r0-r3}
+	bl i2c32_i2cchain
+	pop {r0-r3}
+
+	b i2c32_i2cirq_busy
+
+	i2c32_i2cirq_write:
+	/* Write Is Done with STOP, Chain Read If Any with START */
+	ldr temp, [entry, #equ32_trans32_rx_length]
+	cmp temp, #0
+	moveq result, #0
+	beq i2c32_i2cirq_finish
+
+	push {r0-r3}
+	mov r1, #1
+	bl i2c32_i2cstart
+	pop {r0-r3}
+
+	b i2c32_i2cirq_busy
+
+	i2c32_i2cirq_read:
+		push {r0-r3}
+		bl i2c32_i2cdrain
+		pop {r0-r3}
+
+		tst status, #equ32_i2c_s_done
+		beq i2c32_i2cirq_busy
+
+		/* Rest of FIFO */
+		push {r0-r3}
+		bl i2c32_i2cdrain
+		pop {r0-r3}
+
+		mov result, #0
+
+	i2c32_i2cirq_finish:
+		/* Clear Status, Stop Interrupts */
+		mov temp, #equ32_i2c_s_clkt|equ32_i2c_s_err
+		orr temp, temp, #equ32_i2c_s_done
+		str temp, [addr_i2c, #equ32_i2c_s]
+		mov temp, #equ32_i2c_c_i2cen
+		orr temp, temp, #equ32_i2c_c_clear1
+		str temp, [addr_i2c, #equ32_i2c_c]
+
+		str result, [entry, #equ32_trans32_status]
+
+		/* Metrics */
+		mov temp, #equ32_peripherals_base
+		add temp, temp, #equ32_systemtimer_base
+		ldr temp, [temp, #equ32_systemtimer_counter_lower]
+		ldr control, [entry, #equ32_trans32_time]
+		sub temp, temp, control
+		str temp, [entry, #equ32_trans32_time]
+		ldr control, I2C32_QUEUE_BUSY
+		add control, control, temp
+		str control, I2C32_QUEUE_BUSY
+		ldr control, I2C32_QUEUE_COUNT
+		add control, control, #1
+		str control, I2C32_QUEUE_COUNT
+		ldr control, I2C32_QUEUE_BYTES
+		ldr temp, [entry, #equ32_trans32_count_tx]
+		add control, control, temp
+		ldr temp, [entry, #equ32_trans32_count_rx]
+		add control, control, temp
+		str control, I2C32_QUEUE_BYTES
+
+		/* Next Transaction */
+		mov result, entry
+		ldr entry, [entry, #equ32_trans32_next]
+		str entry, I2C32_QUEUE_HEAD
+		cmp entry, #0
+		streq entry, I2C32_QUEUE_TAIL
+		beq i2c32_i2cirq_callback
+
+		mov r1, #0
+		bl i2c32_i2cstart
+
+	i2c32_i2cirq_callback:
+		ldr ip, [result, #equ32_trans32_callback]
+		cmp ip, #0
+		beq i2c32_i2cirq_busy
+		macro32_dsb ip
+		mov r0, result
+		ldr ip, [result, #equ32_trans32_callback]
+		blx ip
+
+	i2c32_i2cirq_busy:
+		mov r0, #1
+		b i2c32_i2cirq_common
+
+	i2c32_i2cirq_idle:
+		mov r0, #0
+
+	i2c32_i2cirq_common:
+		macro32_dsb ip
+		msr cpsr_c, save_cpsr
+		pop {r4-r6,pc}
+
+.unreq entry
+.unreq addr_i2c
+.unreq status
+.unreq temp
+.unreq save_cpsr
+.unreq control
+.unreq result
+
+
+/**
+ * function i2c32_i2cpoll
+ * Check Status of Transaction on I2C Queue
+ * The FIFO is served in this function too, so IRQ is optional.
+ *
+ * Parameters
+ * r0: Pointer of Transaction Entry
+ *
+ * Return: r0 (Status, -1 as Pending, 0 as Success, 1-2 as Error)
+ */
+.globl i2c32_i2cpoll
+i2c32_i2cpoll:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+
+	push {r0,lr}
+	bl i2c32_i2cirq
+	pop {r0,lr}
+
+	ldr r0, [entry, #equ32_trans32_status]
+	mov pc, lr
+
+.unreq entry
+
+
+/**
+ * function i2c32_i2cqueueinit
+ * Initialize I2C Queue and Metrics
+ *
+ * Parameters
+ * r0: 0 as Polling Only, 1 as Enabling I2C Interrupt (IRQ 53) for i2c32_i2cirq
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Queue Is Busy
+ */
+.globl i2c32_i2cqueueinit
+i2c32_i2cqueueinit:
+	/* Auto (Local) Variables, but just Aliases */
+	flag_irq     .req r0
+	temp         .req r1
+	temp2        .req r2
+	save_cpsr    .req r3
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr temp, I2C32_QUEUE_HEAD
+	cmp temp, #0
+	bne i2c32_i2cqueueinit_error
+
+	str temp, I2C32_QUEUE_TAIL
+	str temp, I2C32_QUEUE_BUSY
+	str temp, I2C32_QUEUE_COUNT
+	str temp, I2C32_QUEUE_BYTES
+	str temp, I2C32_QUEUE_IRQ
+
+	mov temp, #1<<21                               @ I2C IRQ #53
+	mov temp2, #equ32_peripherals_base
+	add temp2, temp2, #equ32_interrupt_base
+	cmp flag_irq, #0
+	strne temp, [temp2, #equ32_interrupt_enable_irqs2]
+	streq temp, [temp2, #equ32_interrupt_disable_irqs2]
+
+	b i2c32_i2cqueueinit_success
+
+	i2c32_i2cqueueinit_error:
+		mov r0, #1
+		b i2c32_i2cqueueinit_common
+
+	i2c32_i2cqueueinit_success:
+		mov r0, #0
+
+	i2c32_i2cqueueinit_common:
+		macro32_dsb ip
+		msr cpsr_c, save_cpsr
+		mov pc, lr
+
+.unreq flag_irq
+.unreq temp
+.unreq temp2
+.unreq save_cpsr
+
+
+/**
+ * Start Write or Read Phase of Transaction, Called with IRQ Disabled
+ * r0: Pointer of Transaction Entry
+ * r1: 0 as Write Phase If Any, 1 as Read Phase
+ */
+i2c32_i2cstart:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	flag_read    .req r1
+	addr_i2c     .req r2
+	temp         .req r3
+
+	push {lr}
+
+	mov addr_i2c, #equ32_peripherals_base
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_upper
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_lower
+
+	cmp flag_read, #0
+	bne i2c32_i2cstart_read
+
+	/* Time to Start */
+	mov temp, #equ32_peripherals_base
+	add temp, temp, #equ32_systemtimer_base
+	ldr temp, [temp, #equ32_systemtimer_counter_lower]
+	str temp, [entry, #equ32_trans32_time]
+
+	ldr temp, [entry, #equ32_trans32_tx_length]
+	cmp temp, #0
+	beq i2c32_i2cstart_read
+
+	mov flag_read, #equ32_i2c_s_clkt|equ32_i2c_s_err
+	orr flag_read, flag_read, #equ32_i2c_s_done
+	str flag_read, [addr_i2c, #equ32_i2c_s]
+	ldr flag_read, [entry, #equ32_trans32_address]
+	str flag_read, [addr_i2c, #equ32_i2c_addr]
+	str temp, [addr_i2c, #equ32_i2c_dlen]
+	mov temp, #equ32_i2c_c_i2cen
+	orr temp, temp, #equ32_i2c_c_intt|equ32_i2c_c_intd
+	orr temp, temp, #equ32_i2c_c_st|equ32_i2c_c_clear1
+	str temp, [addr_i2c, #equ32_i2c_c]
+
+	bl i2c32_i2cfill
+
+	/* Repeated Start If Whole Write Buffer Is in FIFO, Otherwise Chained by i2c32_i2cirq */
+	bl i2c32_i2cchain
+	b i2c32_i2cstart_common
+
+	i2c32_i2cstart_read:
+		mov flag_read, #equ32_i2c_s_clkt|equ32_i2c_s_err
+		orr flag_read, flag_read, #equ32_i2c_s_done
+		str flag_read, [addr_i2c, #equ32_i2c_s]
+		ldr flag_read, [entry, #equ32_trans32_address]
+		str flag_read, [addr_i2c, #equ32_i2c_addr]
+		ldr temp, [entry, #equ32_trans32_rx_length]
+		str temp, [addr_i2c, #equ32_i2c_dlen]
+		mov temp, #equ32_i2c_c_i2cen
+		orr temp, temp, #equ32_i2c_c_intr|equ32_i2c_c_intd
+		orr temp, temp, #equ32_i2c_c_st|equ32_i2c_c_clear1|equ32_i2c_c_read
+		str temp, [addr_i2c, #equ32_i2c_c]
+
+	i2c32_i2cstart_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq entry
+.unreq flag_read
+.unreq addr_i2c
+.unreq temp
+
+
+/**
+ * Start Read Phase with Repeated Start, Called with IRQ Disabled
+ * DLEN and READ with ST are written while the write phase is active (TA) and before DONE (STOP).
+ * Then BSC1 sends a repeated start after the last byte in FIFO. FIFO isn't cleared to keep bytes to write.
+ * r0: Pointer of Transaction Entry
+ * Return: r0 (0 as Chained, 1 as Not Chained)
+ */
+i2c32_i2cchain:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	addr_i2c     .req r1
+	temp         .req r2
+	timeout      .req r3
+
+	ldr temp, [entry, #equ32_trans32_rx_length]
+	cmp temp, #0
+	beq i2c32_i2cchain_error
+
+	ldr temp, [entry, #equ32_trans32_count_tx]
+	ldr timeout, [entry, #equ32_trans32_tx_length]
+	cmp temp, timeout
+	blo i2c32_i2cchain_error
+
+	mov addr_i2c, #equ32_peripherals_base
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_upper
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_lower
+
+	mov timeout, #equ32_i2c32_chain_timeout
+
+	i2c32_i2cchain_loop:
+		ldr temp, [addr_i2c, #equ32_i2c_s]
+		tst temp, #equ32_i2c_s_done
+		bne i2c32_i2cchain_error                   @ STOP Is Already Sent
+		tst temp, #equ32_i2c_s_ta
+		bne i2c32_i2cchain_start
+		subs timeout, timeout, #1
+		bne i2c32_i2cchain_loop
+		b i2c32_i2cchain_error
+
+	i2c32_i2cchain_start:
+		ldr temp, [entry, #equ32_trans32_rx_length]
+		str temp, [addr_i2c, #equ32_i2c_dlen]
+		mov temp, #equ32_i2c_c_i2cen
+		orr temp, temp, #equ32_i2c_c_intr|equ32_i2c_c_intd
+		orr temp, temp, #equ32_i2c_c_st|equ32_i2c_c_read
+		str temp, [addr_i2c, #equ32_i2c_c]
+		b i2c32_i2cchain_success
+
+	i2c32_i2cchain_error:
+		mov r0, #1
+		b i2c32_i2cchain_common
+
+	i2c32_i2cchain_success:
+		mov r0, #0
+
+	i2c32_i2cchain_common:
+		macro32_dsb ip
+		mov pc, lr
+
+.unreq entry
+.unreq addr_i2c
+.unreq temp
+.unreq timeout
+
+
+/**
+ * Fill FIFO with Write Buffer, Stop Interrupt on TXW at End of Buffer
+ * r0: Pointer of Transaction Entry
+ */
+i2c32_i2cfill:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	addr_i2c     .req r1
+	count        .req r2
+	temp         .req r3
+	length       .req r4
+	buffer       .req r5
+
+	push {r4-r5}
+
+	mov addr_i2c, #equ32_peripherals_base
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_upper
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_lower
+
+	ldr count, [entry, #equ32_trans32_count_tx]
+	ldr length, [entry, #equ32_trans32_tx_length]
+	ldr buffer, [entry, #equ32_trans32_tx]
+
+	i2c32_i2cfill_loop:
+		cmp count, length
+		bhs i2c32_i2cfill_end
+
+		ldr temp, [addr_i2c, #equ32_i2c_s]
+		tst temp, #equ32_i2c_s_txd
+		beq i2c32_i2cfill_common
+
+		ldrb temp, [buffer, count]
+		strb temp, [addr_i2c, #equ32_i2c_fifo]
+		add count, count, #1
+		b i2c32_i2cfill_loop
+
+	i2c32_i2cfill_end:
+		ldr temp, [addr_i2c, #equ32_i2c_c]
+		bic temp, temp, #equ32_i2c_c_intt|equ32_i2c_c_st|equ32_i2c_c_clear1
+		str temp, [addr_i2c, #equ32_i2c_c]
+
+	i2c32_i2cfill_common:
+		str count, [entry, #equ32_trans32_count_tx]
+		pop {r4-r5}
+		mov pc, lr
+
+.unreq entry
+.unreq addr_i2c
+.unreq count
+.unreq temp
+.unreq length
+.unreq buffer
+
+
+/**
+ * Drain FIFO to Read Buffer
+ * r0: Pointer of Transaction Entry
+ */
+i2c32_i2cdrain:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	addr_i2c     .req r1
+	count        .req r2
+	temp         .req r3
+	length       .req r4
+	buffer       .req r5
+
+	push {r4-r5}
+
+	mov addr_i2c, #equ32_peripherals_base
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_upper
+	add addr_i2c, addr_i2c, #equ32_i2c1_base_lower
+
+	ldr count, [entry, #equ32_trans32_count_rx]
+	ldr length, [entry, #equ32_trans32_rx_length]
+	ldr buffer, [entry, #equ32_trans32_rx]
+
+	i2c32_i2cdrain_loop:
+		cmp count, length
+		bhs i2c32_i2cdrain_common
+
+		ldr temp, [addr_i2c, #equ32_i2c_s]
+		tst temp, #equ32_i2c_s_rxd
+		beq i2c32_i2cdrain_common
+
+		ldrb temp, [addr_i2c, #equ32_i2c_fifo]
+		strb temp, [buffer, count]
+		add count, count, #1
+		b i2c32_i2cdrain_loop
+
+	i2c32_i2cdrain_common:
+		str count, [entry, #equ32_trans32_count_rx]
+		pop {r4-r5}
+		mov pc, lr
+
+.unreq entry
+.unreq addr_i2c
+.unreq count
+.unreq temp
+.unreq length
+.unreq buffer
+
+.globl I2C32_QUEUE_BUSY
+.globl I2C32_QUEUE_COUNT
+.globl I2C32_QUEUE_BYTES
+.globl I2C32_QUEUE_IRQ
+I2C32_QUEUE_HEAD:  .word 0x00 @ Transaction in Progress
+I2C32_QUEUE_TAIL:  .word 0x00
+I2C32_QUEUE_BUSY:  .word 0x00 @ Sum of Micro Seconds from Start to Completion of Transactions
+I2C32_QUEUE_COUNT: .word 0x00 @ Number of Completed Transactions
+I2C32_QUEUE_BYTES: .word 0x00 @ Sum of Bytes Written and Read
+I2C32_QUEUE_IRQ:   .word 0x00 @ Number of Services of FIFO by i2c32_i2cirq
@@ -464,3 +464,756 @@ spi32_spirx_memory:
 .unreq addr_spi
 .unreq byte
 .unreq temp
+
+
+/**
+ * Usage of Transaction Queue
+ * Functions above busy-poll CS of SPI0 for each part of a transfer.
+ * With the queue, transactions (equ32_trans32_*) are submitted by spi32_spisubmit and run in the background.
+ * The address of the transaction is the value of CS (Chip Select, Polarity, Mode), TA and interrupts are set by the queue.
+ * If Bit[31] of the address (equ32_trans32_duplex) is set, bytes are read while writing.
+ * Otherwise, bytes are read after writing (Chained Write-then-read), and zeros are sent on reading.
+ * FIFO is served by spi32_spiirq in IRQ (IRQ 54) or in spi32_spipoll without IRQ.
+ * The status of the transaction becomes 0 on success. count_tx and count_rx are bytes sent and received on the bus.
+ * If the callback of the transaction is not zero, it's called on completion with r0 as the pointer of the transaction.
+ * The callback runs in spi32_spiirq (IRQ or spi32_spipoll) with IRQ disabled, so keep it short.
+ * Set the clock with spi32_spiclk beforehand, and don't use other functions while the queue is busy.
+ * Utilization: SPI32_QUEUE_BUSY / elapsed time. SPI32_QUEUE_IRQ is the number of services of FIFO, not time.
+ */
+
+
+/**
+ * function spi32_spisubmit
+ * Submit Transaction to SPI Queue without Waiting
+ *
+ * Parameters
+ * r0: Pointer of Transaction Entry, Status Other Than -1
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Entry Is Pending, or No Byte to Transfer
+ */
+.globl spi32_spisubmit
+spi32_spisubmit:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	temp         .req r1
+	tail         .req r2
+	temp2        .req r3
+	save_cpsr    .req r4
+
+	push {r4,lr}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr temp, [entry, #equ32_trans32_status]
+	cmp temp, #-1
+	beq spi32_spisubmit_error
+
+	ldr temp, [entry, #equ32_trans32_tx_length]
+	ldr temp2, [entry, #equ32_trans32_rx_length]
+	orrs temp, temp, temp2
+	beq spi32_spisubmit_error
+
+	mvn temp, #0
+	str temp, [entry, #equ32_trans32_status]
+	mov temp, #0
+	str temp, [entry, #equ32_trans32_next]
+	str temp, [entry, #equ32_trans32_count_tx]
+	str temp, [entry, #equ32_trans32_count_rx]
+
+	ldr tail, SPI32_QUEUE_TAIL
+	cmp tail, #0
+	strne entry, [tail, #equ32_trans32_next]
+	str entry, SPI32_QUEUE_TAIL
+	bne spi32_spisubmit_success
+
+	/* Start If Queue Was Empty */
+	str entry, SPI32_QUEUE_HEAD
+	bl spi32_spistart_queue
+
+	b spi32_spisubmit_success
+
+	spi32_spisubmit_error:
+		mov r0, #1
+		b spi32_spisubmit_common
+
+	spi32_spisubmit_success:
+		mov r0, #0
+
+	spi32_spisubmit_common:
+		macro32_dsb ip
+		msr cpsr_c, save_cpsr
+		pop {r4,pc}
+
+.unreq entry
+.unreq temp
+.unreq tail
+.unreq temp2
+.unreq save_cpsr
+
+
+/**
+ * function spi32_spiirq
+ * Serve FIFO of Transaction on Head of SPI Queue
+ * Call this function in IRQ with the interrupt enabled by spi32_spiqueueinit.
+ *
+ * Return: r0 (0 as Idle, 1 as Busy)
+ */
+.globl spi32_spiirq
+spi32_spiirq:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	addr_spi     .req r1
+	total        .req r2
+	temp         .req r3
+	save_cpsr    .req r4
+	temp2        .req r5
+	done         .req r6
+
+	push {r4-r6,lr}
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr entry, SPI32_QUEUE_HEAD
+	cmp entry, #0
+	beq spi32_spiirq_idle
+
+	ldr temp, SPI32_QUEUE_IRQ
+	add temp, temp, #1
+	str temp, SPI32_QUEUE_IRQ
+
+	push {r0-r3}
+	bl spi32_spiserve
+	mov temp2, r0
+	pop {r0-r3}
+
+	ldr temp, [entry, #equ32_trans32_count_rx]
+	cmp temp, temp2
+	blo spi32_spiirq_busy
+
+	/* Stop Transfer and Interrupts, Chip Select Is Deasserted */
+	mov addr_spi, #equ32_peripherals_base
+	add addr_spi, addr_spi, #equ32_spi0_base_upper
+	add addr_spi, addr_spi, #equ32_spi0_base_lower
+	ldr temp, [addr_spi, #equ32_spi0_cs]
+	bic temp, temp, #equ32_spi0_cs_ta|equ32_spi0_cs_intr|equ32_spi0_cs_intd
+	str temp, [addr_spi, #equ32_spi0_cs]
+
+	mov temp, #0
+	str temp, [entry, #equ32_trans32_status]
+
+	/* Metrics */
+	mov temp, #equ32_peripherals_base
+	add temp, temp, #equ32_systemtimer_base
+	ldr temp, [temp, #equ32_systemtimer_counter_lower]
+	ldr temp2, [entry, #equ32_trans32_time]
+	sub temp, temp, temp2
+	str temp, [entry, #equ32_trans32_time]
+	ldr temp2, SPI32_QUEUE_BUSY
+	add temp2, temp2, temp
+	str temp2, SPI32_QUEUE_BUSY
+	ldr temp2, SPI32_QUEUE_COUNT
+	add temp2, temp2, #1
+	str temp2, SPI32_QUEUE_COUNT
+	ldr temp2, SPI32_QUEUE_BYTES
+	ldr temp, [entry, #equ32_trans32_count_rx]
+	add temp2, temp2, temp
+	str temp2, SPI32_QUEUE_BYTES
+
+	/* Next Transaction */
+	mov done, entry
+	ldr entry, [entry, #equ32_trans32_next]
+	str entry, SPI32_QUEUE_HEAD
+	cmp entry, #0
+	streq entry, SPI32_QUEUE_TAIL
+	beq spi32_spiirq_callback
+
+	bl spi32_spistart_queue
+
+	spi32_spiirq_callback:
+		ldr ip, [done, #equ32_trans32_callback]
+		cmp ip, #0
+		beq spi32_spiirq_busy
+		macro32_dsb ip
+		mov r0, done
+		ldr ip, [done, #equ32_trans32_callback]
+		blx ip
+
+	spi32_spiirq_busy:
+		mov r0, #1
+		b spi32_spiirq_common
+
+	spi32_spiirq_idle:
+		mov r0, #0
+
+	spi32_spiirq_common:
+		macro32_dsb ip
+		msr cpsr_c, save_cpsr
+		pop {r4-r6,pc}
+
+.unreq entry
+.unreq addr_spi
+.unreq total
+.unreq temp
+.unreq save_cpsr
+.unreq temp2
+.unreq done
+
+
+/**
+ * function spi32_spipoll
+ * Check Status of Transaction on SPI Queue
+ * The FIFO is served in this function too, so IRQ is optional.
+ *
+ * Parameters
+ * r0: Pointer of Transaction Entry
+ *
+ * Return: r0 (Status, -1 as Pending, 0 as Success)
+ */
+.globl spi32_spipoll
+spi32_spipoll:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+
+	push {r0,lr}
+	bl spi32_spiirq
+	pop {r0,lr}
+
+	ldr r0, [entry, #equ32_trans32_status]
+	mov pc, lr
+
+.unreq entry
+
+
+/**
+ * function spi32_spiqueueinit
+ * Initialize SPI Queue and Metrics
+ *
+ * Parameters
+ * r0: 0 as Polling Only, 1 as Enabling SPI Interrupt (IRQ 54) for spi32_spiirq
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Queue Is Busy
+ */
+.globl spi32_spiqueueinit
+spi32_spiqueueinit:
+	/* Auto (Local) Variables, but just Aliases */
+	flag_irq     .req r0
+	temp         .req r1
+	temp2        .req r2
+	save_cpsr    .req r3
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr temp, SPI32_QUEUE_HEAD
+	cmp temp, #0
+	bne spi32_spiqueueinit_error
+
+	str temp, SPI32_QUEUE_TAIL
+	str temp, SPI32_QUEUE_BUSY
+	str temp, SPI32_QUEUE_COUNT
+	str temp, SPI32_QUEUE_BYTES
+	str temp, SPI32_QUEUE_IRQ
+
+	mov temp, #1<<22                               @ SPI IRQ #54
+	mov temp2, #equ32_peripherals_base
+	add temp2, temp2, #equ32_interrupt_base
+	cmp flag_irq, #0
+	strne temp, [temp2, #equ32_interrupt_enable_irqs2]
+	streq temp, [temp2, #equ32_interrupt_disable_irqs2]
+
+	b spi32_spiqueueinit_success
+
+	spi32_spiqueueinit_error:
+		mov r0, #1
+		b spi32_spiqueueinit_common
+
+	spi32_spiqueueinit_success:
+		mov r0, #0
+
+	spi32_spiqueueinit_common:
+		macro32_dsb ip
+		msr cpsr_c, save_cpsr
+		mov pc, lr
+
+.unreq flag_irq
+.unreq temp
+.unreq temp2
+.unreq save_cpsr
+
+
+/**
+ * Start Transaction, Called with IRQ Disabled
+ * r0: Pointer of Transaction Entry
+ */
+spi32_spistart_queue:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	addr_spi     .req r1
+	cs           .req r2
+	temp         .req r3
+
+	push {lr}
+
+	/* Time to Start */
+	mov temp, #equ32_peripherals_base
+	add temp, temp, #equ32_systemtimer_base
+	ldr temp, [temp, #equ32_systemtimer_counter_lower]
+	str temp, [entry, #equ32_trans32_time]
+
+	mov addr_spi, #equ32_peripherals_base
+	add addr_spi, addr_spi, #equ32_spi0_base_upper
+	add addr_spi, addr_spi, #equ32_spi0_base_lower
+
+	ldr cs, [entry, #equ32_trans32_address]
+	bic cs, cs, #equ32_trans32_duplex
+	bic cs, cs, #equ32_spi0_cs_ta|equ32_spi0_cs_intr|equ32_spi0_cs_intd|equ32_spi0_cs_dmaen
+	bic cs, cs, #0b11<<equ32_spi0_cs_clear
+	orr temp, cs, #0b11<<equ32_spi0_cs_clear
+	str temp, [addr_spi, #equ32_spi0_cs]          @ Set Except TA, Clear FIFOs
+	macro32_dsb ip
+
+	orr cs, cs, #equ32_spi0_cs_ta|equ32_spi0_cs_intr|equ32_spi0_cs_intd
+	str cs, [addr_spi, #equ32_spi0_cs]            @ Start of Transfer
+
+	bl spi32_spiserve
+
+	macro32_dsb ip
+	pop {pc}
+
+.unreq entry
+.unreq addr_spi
+.unreq cs
+.unreq temp
+
+
+/**
+ * Drain RxFIFO to Read Buffer, Then Fill TxFIFO with Write Buffer or Zeros
+ * Bytes in flight are up to 16 not to overflow RxFIFO.
+ * r0: Pointer of Transaction Entry
+ *
+ * Return: r0 (Total Bytes of Transaction on Bus)
+ */
+spi32_spiserve:
+	/* Auto (Local) Variables, but just Aliases */
+	entry        .req r0
+	addr_spi     .req r1
+	count        .req r2
+	temp         .req r3
+	total        .req r4
+	length_tx    .req r5
+	length_rx    .req r6
+	buffer       .req r7
+	byte         .req r8
+
+	push {r4-r8}
+
+	mov addr_spi, #equ32_peripherals_base
+	add addr_spi, addr_spi, #equ32_spi0_base_upper
+	add addr_spi, addr_spi, #equ32_spi0_base_lower
+
+	ldr length_tx, [entry, #equ32_trans32_tx_length]
+	ldr length_rx, [entry, #equ32_trans32_rx_length]
+	ldr temp, [entry, #equ32_trans32_address]
+	add total, length_tx, length_rx
+	tst temp, #equ32_trans32_duplex
+	beq spi32_spiserve_rxfifo_start
+	cmp length_tx, length_rx                        @ Maximum of Lengths in Duplex
+	movhs total, length_tx
+	movlo total, length_rx
+
+	spi32_spiserve_rxfifo_start:
+		ldr count, [entry, #equ32_trans32_count_rx]
+		ldr buffer, [entry, #equ32_trans32_rx]
+
+	spi32_spiserve_rxfifo:
+		cmp count, total
+		bhs spi32_spiserve_rxfifo_common
+
+		ldr byte, [addr_spi, #equ32_spi0_cs]
+		tst byte, #equ32_spi0_cs_rxd
+		beq spi32_spiserve_rxfifo_common
+
+		ldrb byte, [addr_spi, #equ32_spi0_fifo]
+
+		/* Index on Read Buffer */
+		tst temp, #equ32_trans32_duplex
+		subeq ip, count, length_tx
+		movne ip, count
+		cmp ip, length_rx                          @ Unsigned, Bytes on Writing Are Out of Range
+		bhs spi32_spiserve_rxfifo_next
+		strb byte, [buffer, ip]
+
+		spi32_spiserve_rxfifo_next:
+			add count, count, #1
+			b spi32_spiserve_rxfifo
+
+	spi32_spiserve_rxfifo_common:
+		str count, [entry, #equ32_trans32_count_rx]
+		mov temp, count
+		ldr count, [entry, #equ32_trans32_count_tx]
+		ldr buffer, [entry, #equ32_trans32_tx]
+
+	spi32_spiserve_txfifo:
+		cmp count, total
+		bhs spi32_spiserve_common
+
+		sub byte, count, temp
+		cmp byte, #16
+		bhs spi32_spiserve_common
+
+		ldr byte, [addr_spi, #equ32_spi0_cs]
+		tst byte, #equ32_spi0_cs_txd
+		beq spi32_spiserve_common
+
+		mov byte, #0
+		cmp count, length_tx
+		bhs spi32_spiserve_txfifo_byte
+		ldrb byte, [buffer, count]
+
+		spi32_spiserve_txfifo_byte:
+			strb byte, [addr_spi, #equ32_spi0_fifo]
+
+			add count, count, #1
+			b spi32_spiserve_txfifo
+
+	spi32_spiserve_common:
+		str count, [entry, #equ32_trans32_count_tx]
+		mov r0, total
+		pop {r4-r8}
+		mov pc, lr
+
+.unreq entry
+.unreq addr_spi
+.unreq count
+.unreq temp
+.unreq total
+.unreq length_tx
+.unreq length_rx
+.unreq buffer
+.unreq byte
+
+.globl SPI32_QUEUE_BUSY
+.globl SPI32_QUEUE_COUNT
+.globl SPI32_QUEUE_BYTES
+.globl SPI32_QUEUE_IRQ
+SPI32_QUEUE_HEAD:  .word 0x00 @ Transaction in Progress
+SPI32_QUEUE_TAIL:  .word 0x00
+SPI32_QUEUE_BUSY:  .word 0x00 @ Sum of Micro Seconds from Start to Completion of Transactions
+SPI32_QUEUE_COUNT: .word 0x00 @ Number of Completed Transactions
+SPI32_QUEUE_BYTES: .word 0x00 @ Sum of Bytes on Bus
+SPI32_QUEUE_IRQ:   .word 0x00 @ Number of Services of FIFO by spi32_spiirq
+
+
+/**
+ * function spi32_spidma
+ * SPI Transfer and Receive with DMA, Memory Order (Byte on Offset Zero is Sent First)
+ * TxFIFO is fed with DREQ 6 (equ32_dma_dreq_spi_tx) and RxFIFO is drained with DREQ 7 (equ32_dma_dreq_spi_rx) on two channels.
+ * The channels are 12 and 13 (lite), taken off the default pool of dma32_submit, because the firmware leaves channels 0x7F35 to ARM.
+ * Channels 2, 4 and 5 of the mask are used by fb32, dma32 and uart32, and channel 14 is used by dmx32.
+ * Start with spi32_spistart (TA), then this function, and spi32_spidmawait before next transfer or spi32_spistop.
+ * DLEN is set by the register, and ADCS is not set, so CS stays asserted between transfers of one command.
+ * The transmit buffer is cleaned, and the receive buffer is cleaned and invalidated here, invalidated again by spi32_spidmawait.
+ * Don't use with the transaction queue at the same time.
+ *
+ * Parameters
+ * r0: Pointer of Data to Be Transferred, 0 as Sending Zeros
+ * r1: Pointer of Data to Be Received, 0 as Discarding
+ * r2: Length (Bytes, Multiple of 4, Up to equ32_spi32_dma_length)
+ *
+ * Return: r0 (0 as Success, 1 and 2 as Error)
+ * Error(1): Length or Alignment of Pointer Is Invalid
+ * Error(2): Previous Transfer Is Not Waited
+ */
+.globl spi32_spidma
+spi32_spidma:
+	/* Auto (Local) Variables, but just Aliases */
+	data_send    .req r0
+	data_receive .req r1
+	length       .req r2
+	addr_spi     .req r3
+	temp         .req r4
+	temp2        .req r5
+
+	push {r4-r5,lr}
+
+	cmp length, #0
+	beq spi32_spidma_error1
+	mov temp, #equ32_spi32_dma_length & 0xFF00
+	orr temp, temp, #equ32_spi32_dma_length & 0xFF
+	cmp length, temp
+	bhi spi32_spidma_error1
+	orr temp, data_send, data_receive
+	orr temp, temp, length
+	tst temp, #0b11
+	bne spi32_spidma_error1
+
+	ldr temp, spi32_spidma_length
+	cmp temp, #0
+	bne spi32_spidma_error2
+
+	str length, spi32_spidma_length
+	str data_receive, spi32_spidma_receive
+
+	/* Start Time for SPI32_DMA_TIME */
+	mov temp, #equ32_peripherals_base
+	add temp, temp, #equ32_systemtimer_base
+	ldr temp, [temp, #equ32_systemtimer_counter_lower]
+	str temp, SPI32_DMA_TIME
+
+	/* Cache Operations, One Range (Start Address, Length) on Stack */
+	cmp data_send, #0
+	beq spi32_spidma_cache
+	push {r0-r3}
+	push {data_send,length}
+	mov r0, sp
+	mov r1, #1
+	mov r2, #1                                @ Clean
+	bl arm32_cache_operation_range
+	add sp, sp, #8
+	pop {r0-r3}
+
+	spi32_spidma_cache:
+		cmp data_receive, #0
+		beq spi32_spidma_spi
+		push {r0-r3}
+		push {data_receive,length}
+		mov r0, sp
+		mov r1, #1
+		mov r2, #2                                @ Clean and Invalidate, Not to Write Back Dirty Lines on Received Data
+		bl arm32_cache_operation_range
+		add sp, sp, #8
+		pop {r0-r3}
+
+	spi32_spidma_spi:
+		mov addr_spi, #equ32_peripherals_base
+		add addr_spi, addr_spi, #equ32_spi0_base_upper
+		add addr_spi, addr_spi, #equ32_spi0_base_lower
+
+		str length, [addr_spi, #equ32_spi0_dlen]
+		ldr temp, [addr_spi, #equ32_spi0_cs]
+		bic temp, temp, #equ32_spi0_cs_adcs|equ32_spi0_cs_intr|equ32_spi0_cs_intd
+		orr temp, temp, #equ32_spi0_cs_dmaen
+		str temp, [addr_spi, #equ32_spi0_cs]
+
+		macro32_dsb ip
+
+	/* Receive First Not to Stall SPI by Full RxFIFO */
+	push {r0-r6}
+	mov r4, length                                          @ Transfer Size
+	mov r3, data_receive
+	mov r0, #equ32_dma32_cb_spi32_rx
+	mov r1, #equ32_dma_dreq_spi_rx<<equ32_dma_ti_permap   @ DREQ Map for SPI Receive
+	orr r1, r1, #equ32_dma_ti_no_wide_bursts
+	orr r1, r1, #equ32_dma_ti_src_dreq                      @ Transfer Information Source
+	orr r1, r1, #equ32_dma_ti_wait_resp
+	cmp r3, #0
+	orrne r1, r1, #equ32_dma_ti_dst_inc                     @ Transfer Information Destination
+	ldreq r3, SPI32_DMA_DUMMY_RX
+	add r3, r3, #equ32_bus_coherence_base                   @ Destination Address
+	mov r2, #equ32_bus_peripherals_base
+	add r2, r2, #equ32_spi0_base_upper
+	add r2, r2, #equ32_spi0_base_lower
+	add r2, r2, #equ32_spi0_fifo                            @ Source Address
+	mov r5, #0                                              @ 2D Stride
+	mvn r6, #0                                              @ Next CB Number, -1 as Nothing
+	push {r4-r6}
+	bl dma32_set_cb
+	add sp, sp, #12
+	pop {r0-r6}
+
+	push {r0-r3}
+	mov r0, #equ32_dma32_channel_spi32_rx
+	mov r1, #equ32_dma32_cb_spi32_rx
+	bl dma32_set_channel
+	pop {r0-r3}
+
+	push {r0-r6}
+	mov r4, length                                          @ Transfer Size
+	mov r2, data_send
+	mov r0, #equ32_dma32_cb_spi32_tx
+	mov r1, #equ32_dma_dreq_spi_tx<<equ32_dma_ti_permap   @ DREQ Map for SPI Transmit
+	orr r1, r1, #equ32_dma_ti_no_wide_bursts
+	orr r1, r1, #equ32_dma_ti_dst_dreq                      @ Transfer Information Destination
+	orr r1, r1, #equ32_dma_ti_wait_resp
+	cmp r2, #0
+	orrne r1, r1, #equ32_dma_ti_src_inc                     @ Transfer Information Source
+	ldreq r2, SPI32_DMA_DUMMY_TX
+	add r2, r2, #equ32_bus_coherence_base                   @ Source Address
+	mov r3, #equ32_bus_peripherals_base
+	add r3, r3, #equ32_spi0_base_upper
+	add r3, r3, #equ32_spi0_base_lower
+	add r3, r3, #equ32_spi0_fifo                            @ Destination Address
+	mov r5, #0                                              @ 2D Stride
+	mvn r6, #0                                              @ Next CB Number, -1 as Nothing
+	push {r4-r6}
+	bl dma32_set_cb
+	add sp, sp, #12
+	pop {r0-r6}
+
+	push {r0-r3}
+	mov r0, #equ32_dma32_channel_spi32_tx
+	mov r1, #equ32_dma32_cb_spi32_tx
+	bl dma32_set_channel
+	pop {r0-r3}
+
+	b spi32_spidma_success
+
+	spi32_spidma_error1:
+		mov r0, #1
+		b spi32_spidma_common
+
+	spi32_spidma_error2:
+		mov r0, #2
+		b spi32_spidma_common
+
+	spi32_spidma_success:
+		mov r0, #0
+
+	spi32_spidma_common:
+		pop {r4-r5,pc}
+
+.unreq data_send
+.unreq data_receive
+.unreq length
+.unreq addr_spi
+.unreq temp
+.unreq temp2
+
+
+/**
+ * function spi32_spidmawait
+ * Wait for Transfer by spi32_spidma
+ * After the receive channel ends, DONE of SPI is checked and DMAEN is cleared. TA stays.
+ * SPI32_DMA_TIME is set to micro seconds from spi32_spidma, and SPI32_DMA_BYTES is accumulated.
+ *
+ * Parameters
+ * r0: Time Out in Turns, for Each of Receive Channel and DONE
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error(1): Time Out of Receive Channel or DONE, Channels Are Cleared
+ */
+.globl spi32_spidmawait
+spi32_spidmawait:
+	/* Auto (Local) Variables, but just Aliases */
+	timeout      .req r0
+	addr_spi     .req r1
+	length       .req r2
+	temp         .req r3
+	turns        .req r4
+
+	push {r4,lr}
+
+	ldr length, spi32_spidma_length
+	cmp length, #0
+	beq spi32_spidmawait_success
+
+	mov turns, timeout
+	mov r1, timeout
+	mov r0, #equ32_dma32_channel_spi32_rx
+	bl dma32_wait_channel
+	ldr length, spi32_spidma_length
+
+	mov addr_spi, #equ32_peripherals_base
+	add addr_spi, addr_spi, #equ32_spi0_base_upper
+	add addr_spi, addr_spi, #equ32_spi0_base_lower
+
+	cmp timeout, #0
+	bne spi32_spidmawait_timeout
+
+	spi32_spidmawait_done:
+		ldr temp, [addr_spi, #equ32_spi0_cs]
+		tst temp, #equ32_spi0_cs_done
+		bne spi32_spidmawait_invalidate
+		subs turns, turns, #1
+		bhs spi32_spidmawait_done
+
+		mov timeout, #1
+		b spi32_spidmawait_timeout
+
+	spi32_spidmawait_invalidate:
+		/* Invalidate Received Data, Prefetched Lines in DMA Are Discarded */
+		ldr temp, spi32_spidma_receive
+		cmp temp, #0
+		beq spi32_spidmawait_metrics
+		push {r0-r3}
+		push {temp,length}
+		mov r0, sp
+		mov r1, #1
+		mov r2, #0                                @ Invalidate
+		bl arm32_cache_operation_range
+		add sp, sp, #8
+		pop {r0-r3}
+
+	spi32_spidmawait_metrics:
+		mov timeout, #equ32_peripherals_base
+		add timeout, timeout, #equ32_systemtimer_base
+		ldr timeout, [timeout, #equ32_systemtimer_counter_lower]
+		ldr temp, SPI32_DMA_TIME
+		sub timeout, timeout, temp
+		str timeout, SPI32_DMA_TIME
+		ldr temp, SPI32_DMA_BYTES
+		add temp, temp, length
+		str temp, SPI32_DMA_BYTES
+
+		mov timeout, #0
+		b spi32_spidmawait_clear
+
+	spi32_spidmawait_timeout:
+		push {r0-r3}
+		mov r0, #equ32_dma32_channel_spi32_tx
+		bl dma32_clear_channel
+		mov r0, #equ32_dma32_channel_spi32_rx
+		bl dma32_clear_channel
+		pop {r0-r3}
+
+	spi32_spidmawait_clear:
+		ldr temp, [addr_spi, #equ32_spi0_cs]
+		bic temp, temp, #equ32_spi0_cs_dmaen
+		str temp, [addr_spi, #equ32_spi0_cs]
+		mov length, #0
+		str length, spi32_spidma_length
+		macro32_dsb ip
+
+		cmp timeout, #0
+		bne spi32_spidmawait_error
+
+		b spi32_spidmawait_success
+
+	spi32_spidmawait_error:
+		mov r0, #1
+		b spi32_spidmawait_common
+
+	spi32_spidmawait_success:
+		mov r0, #0
+
+	spi32_spidmawait_common:
+		pop {r4,pc}
+
+.unreq timeout
+.unreq addr_spi
+.unreq length
+.unreq temp
+.unreq turns
+
+spi32_spidma_length:  .word 0x00 @ Bytes in Transfer, 0 as No Transfer
+spi32_spidma_receive: .word 0x00
+
+.globl SPI32_DMA_TIME
+.globl SPI32_DMA_BYTES
+SPI32_DMA_TIME:       .word 0x00 @ Micro Seconds of Last Transfer, Throughput Is Length / Time
+SPI32_DMA_BYTES:      .word 0x00 @ Sum of Bytes Transferred by DMA
+SPI32_DMA_DUMMY_TX:   .word _SPI32_DMA_DUMMY_TX
+SPI32_DMA_DUMMY_RX:   .word _SPI32_DMA_DUMMY_RX
+
+.section	.data
+.balign 4
+_SPI32_DMA_DUMMY_TX:  .word 0x00 @ Zeros to Be Sent
+_SPI32_DMA_DUMMY_RX:  .word 0x00 @ Discarded Data
+.section	.arm_system32
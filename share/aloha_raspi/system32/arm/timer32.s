@@ -0,0 +1,558 @@
+/**
+ * timer32.s
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * Usage
+ * 1. Place `timer32_init` with the period of one tick (micro seconds) in the privileged mode.
+ * 2. Place `timer32_irq` on IRQ Handler. Compare 3 of the system timer (IRQ 3) is used for ticks.
+ * 3. Allocate a timer entry (equ32_timer32_entry_size bytes) for each task, and place `timer32_add`.
+ * 4. The function of each entry is called in IRQ mode on expiry with r0 as the argument and r1 as the pointer of the entry.
+ * 5. If you want to stop the task, use `timer32_cancel`.
+ *
+ * Entries are hashed into four levels of slots by the tick to expire.
+ * Level 0 has 256 slots of one tick, and level 1-3 have 64 slots of 256, 16384, and 1048576 ticks.
+ * Each time level 0 (or an upper level) wraps, the next slot of the upper level is cascaded to lower levels.
+ * So, adding and canceling are O(1), and only the slot of the current tick is dispatched on each tick.
+ * Entries expire on ticks, in order of ticks; entries in one tick are dispatched together.
+ */
+
+
+/**
+ * function timer32_init
+ * Initialize Timer Wheel
+ * All slots are cleared, so entries added before are dropped.
+ *
+ * Parameters
+ * r0: Period of One Tick (Micro Seconds)
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Period Is Zero
+ */
+.globl timer32_init
+timer32_init:
+	/* Auto (Local) Variables, but just Aliases */
+	period         .req r0
+	memorymap_base .req r1
+	temp           .req r2
+	temp2          .req r3
+	save_cpsr      .req r4
+
+	push {r4}
+
+	cmp period, #0
+	beq timer32_init_error
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	str period, TIMER32_PERIOD
+
+	/* Clear Slots */
+	ldr temp, TIMER32_WHEEL
+	mov temp2, #0
+	mov memorymap_base, #equ32_timer32_level0_slots + equ32_timer32_level_slots * 3
+	timer32_init_clear:
+		subs memorymap_base, memorymap_base, #1
+		str temp2, [temp, memorymap_base, lsl #2]
+		bgt timer32_init_clear
+
+	str temp2, TIMER32_TICK
+	ldr temp, TIMER32_RUNNING
+	str temp2, [temp]
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_systemtimer_base
+
+	ldr temp, [memorymap_base, #equ32_systemtimer_counter_lower]
+	add temp, temp, period
+	str temp, TIMER32_NEXT
+	str temp, [memorymap_base, #equ32_systemtimer_compare3]
+
+	mov temp, #equ32_systemtimer_cs_m3
+	str temp, [memorymap_base, #equ32_systemtimer_control_status]
+
+	macro32_dsb ip
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_interrupt_base
+	mov temp, #equ32_systemtimer_cs_m3                     @ IRQ 3, Same Bit as Match
+	str temp, [memorymap_base, #equ32_interrupt_enable_irqs1]
+
+	macro32_dsb ip
+
+	msr cpsr_c, save_cpsr
+
+	b timer32_init_success
+
+	timer32_init_error:
+		mov r0, #1
+		b timer32_init_common
+
+	timer32_init_success:
+		mov r0, #0
+
+	timer32_init_common:
+		pop {r4}
+		mov pc, lr
+
+.unreq period
+.unreq memorymap_base
+.unreq temp
+.unreq temp2
+.unreq save_cpsr
+
+
+/**
+ * function timer32_add
+ * Add Timer Entry to Timer Wheel
+ * If the entry is pending, the entry is canceled, then added. Statistics of the entry are reset.
+ *
+ * Parameters
+ * r0: Pointer of Timer Entry, equ32_timer32_entry_size Bytes
+ * r1: Delay (Ticks) to First Expiry, 0 as Next Tick
+ * r2: Period (Ticks), 0 as One-shot
+ * r3: Function to Be Called on Expiry
+ * r4: Argument (r0) of Function
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Pointer of Timer Entry Is Null
+ */
+.globl timer32_add
+timer32_add:
+	/* Auto (Local) Variables, but just Aliases */
+	entry          .req r0
+	delay          .req r1
+	period         .req r2
+	function       .req r3
+	argument       .req r4
+	temp           .req r5
+	temp2          .req r6
+	save_cpsr      .req r7
+
+	push {r4-r7,lr}
+
+	add sp, sp, #20                                @ r4-r7 and lr offset 20 bytes
+	pop {argument}                                 @ Get Fifth Argument
+	sub sp, sp, #24
+
+	cmp entry, #0
+	beq timer32_add_error
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	/* Unlink If Pending */
+	ldr temp, [entry, #equ32_timer32_prev]
+	cmp temp, #0
+	beq timer32_add_set
+	ldr temp2, [entry, #equ32_timer32_next]
+	str temp2, [temp, #equ32_timer32_next]
+	cmp temp2, #0
+	strne temp, [temp2, #equ32_timer32_prev]
+
+	timer32_add_set:
+		ldr temp, TIMER32_TICK
+		add temp, temp, delay
+		str temp, [entry, #equ32_timer32_expires]
+		str period, [entry, #equ32_timer32_period]
+		str function, [entry, #equ32_timer32_function]
+		str argument, [entry, #equ32_timer32_argument]
+
+		mov temp, #0
+		str temp, [entry, #equ32_timer32_count]
+		str temp, [entry, #equ32_timer32_latency_last]
+		str temp, [entry, #equ32_timer32_latency_max]
+		str temp, [entry, #equ32_timer32_latency_sum]
+		mvn temp, #0
+		str temp, [entry, #equ32_timer32_latency_min]
+
+		bl timer32_enqueue
+
+		macro32_dsb ip
+
+		msr cpsr_c, save_cpsr
+
+		b timer32_add_success
+
+	timer32_add_error:
+		mov r0, #1
+		b timer32_add_common
+
+	timer32_add_success:
+		mov r0, #0
+
+	timer32_add_common:
+		pop {r4-r7,pc}
+
+.unreq entry
+.unreq delay
+.unreq period
+.unreq function
+.unreq argument
+.unreq temp
+.unreq temp2
+.unreq save_cpsr
+
+
+/**
+ * function timer32_cancel
+ * Cancel Timer Entry on Timer Wheel
+ * Statistics of the entry are kept.
+ *
+ * Parameters
+ * r0: Pointer of Timer Entry
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Timer Entry Is Not Pending
+ */
+.globl timer32_cancel
+timer32_cancel:
+	/* Auto (Local) Variables, but just Aliases */
+	entry          .req r0
+	prev           .req r1
+	next           .req r2
+	save_cpsr      .req r3
+
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	ldr prev, [entry, #equ32_timer32_prev]
+	cmp prev, #0
+	beq timer32_cancel_error
+
+	ldr next, [entry, #equ32_timer32_next]
+	str next, [prev, #equ32_timer32_next]          @ Slot Is Also Regarded as Next
+	cmp next, #0
+	strne prev, [next, #equ32_timer32_prev]
+
+	mov prev, #0
+	str prev, [entry, #equ32_timer32_prev]
+
+	b timer32_cancel_success
+
+	timer32_cancel_error:
+		mov r0, #1
+		b timer32_cancel_common
+
+	timer32_cancel_success:
+		mov r0, #0
+
+	timer32_cancel_common:
+		macro32_dsb ip
+		msr cpsr_c, save_cpsr
+		mov pc, lr
+
+.unreq entry
+.unreq prev
+.unreq next
+.unreq save_cpsr
+
+
+/**
+ * function timer32_irq
+ * Timer Wheel Interrupt Handler
+ * Call this function in IRQ with IRQ 3. Missed ticks are caught up in this function.
+ * Each entry in the slot of the tick is unlinked, and the statistics of latency are updated.
+ * Latency is the time from the scheduled time of the tick to the dispatch of the entry.
+ * A periodic entry is added again with the next expiry (expiry + period) before the function is called,
+ * so the period doesn't drift, and the function can cancel itself.
+ *
+ * Return: r0 (Number of Dispatched Entries)
+ */
+.globl timer32_irq
+timer32_irq:
+	/* Auto (Local) Variables, but just Aliases */
+	memorymap_base .req r4
+	next           .req r5
+	tick           .req r6
+	entry          .req r7
+	running        .req r8
+	temp           .req r9
+	temp2          .req r10
+	count          .req r11
+
+	push {r4-r11,lr}
+
+	mov count, #0
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_systemtimer_base
+
+	ldr temp, [memorymap_base, #equ32_systemtimer_control_status]
+	tst temp, #equ32_systemtimer_cs_m3
+	beq timer32_irq_common
+
+	mov temp, #equ32_systemtimer_cs_m3
+	str temp, [memorymap_base, #equ32_systemtimer_control_status]
+
+	macro32_dsb ip
+
+	ldr running, TIMER32_RUNNING
+
+	timer32_irq_tick:
+		ldr temp, [memorymap_base, #equ32_systemtimer_counter_lower]
+		ldr next, TIMER32_NEXT
+		sub temp, temp, next
+		cmp temp, #0
+		blt timer32_irq_compare                        @ If Scheduled Time Is Not Reached
+
+		ldr tick, TIMER32_TICK
+
+		/* Cascade on Wrapping of Lower Level */
+		ands temp, tick, #equ32_timer32_level0_slots - 1
+		bne timer32_irq_tick_slot
+
+		ldr temp2, TIMER32_WHEEL
+		add temp2, temp2, #4 * equ32_timer32_level0_slots
+		lsr temp, tick, #8
+		and temp, temp, #equ32_timer32_level_slots - 1
+		add r0, temp2, temp, lsl #2
+		bl timer32_cascade
+		cmp temp, #0
+		bne timer32_irq_tick_slot
+
+		add temp2, temp2, #4 * equ32_timer32_level_slots
+		lsr temp, tick, #14
+		and temp, temp, #equ32_timer32_level_slots - 1
+		add r0, temp2, temp, lsl #2
+		bl timer32_cascade
+		cmp temp, #0
+		bne timer32_irq_tick_slot
+
+		add temp2, temp2, #4 * equ32_timer32_level_slots
+		lsr temp, tick, #20
+		and temp, temp, #equ32_timer32_level_slots - 1
+		add r0, temp2, temp, lsl #2
+		bl timer32_cascade
+
+		timer32_irq_tick_slot:
+			/* Move Slot of Current Tick to Running */
+			and temp, tick, #equ32_timer32_level0_slots - 1
+			ldr temp2, TIMER32_WHEEL
+			add temp2, temp2, temp, lsl #2
+			ldr temp, [temp2]
+			mov entry, #0
+			str entry, [temp2]
+			str temp, [running]
+			cmp temp, #0
+			strne running, [temp, #equ32_timer32_prev]
+
+			/* Entries Added in Functions Go to Next Ticks */
+			add tick, tick, #1
+			str tick, TIMER32_TICK
+			ldr temp, TIMER32_PERIOD
+			add temp, next, temp
+			str temp, TIMER32_NEXT
+
+		timer32_irq_tick_dispatch:
+			ldr entry, [running]
+			cmp entry, #0
+			beq timer32_irq_tick
+
+			ldr temp, [entry, #equ32_timer32_next]
+			str temp, [running]
+			cmp temp, #0
+			strne running, [temp, #equ32_timer32_prev]
+			mov temp, #0
+			str temp, [entry, #equ32_timer32_prev]   @ Not Pending
+
+			/* Statistics */
+			ldr temp, [memorymap_base, #equ32_systemtimer_counter_lower]
+			sub temp, temp, next
+			str temp, [entry, #equ32_timer32_latency_last]
+			ldr temp2, [entry, #equ32_timer32_latency_min]
+			cmp temp, temp2
+			strlo temp, [entry, #equ32_timer32_latency_min]
+			ldr temp2, [entry, #equ32_timer32_latency_max]
+			cmp temp, temp2
+			strhi temp, [entry, #equ32_timer32_latency_max]
+			ldr temp2, [entry, #equ32_timer32_latency_sum]
+			add temp2, temp2, temp
+			str temp2, [entry, #equ32_timer32_latency_sum]
+			ldr temp, [entry, #equ32_timer32_count]
+			add temp, temp, #1
+			str temp, [entry, #equ32_timer32_count]
+
+			/* Periodic */
+			ldr temp, [entry, #equ32_timer32_period]
+			cmp temp, #0
+			beq timer32_irq_tick_dispatch_call
+			ldr temp2, [entry, #equ32_timer32_expires]
+			add temp2, temp2, temp
+			str temp2, [entry, #equ32_timer32_expires]
+			mov r0, entry
+			bl timer32_enqueue
+
+			timer32_irq_tick_dispatch_call:
+				macro32_dsb ip
+				ldr r0, [entry, #equ32_timer32_argument]
+				mov r1, entry
+				ldr ip, [entry, #equ32_timer32_function]
+				blx ip
+
+				add count, count, #1
+				b timer32_irq_tick_dispatch
+
+	timer32_irq_compare:
+		str next, [memorymap_base, #equ32_systemtimer_compare3]
+
+		macro32_dsb ip
+
+		/* Compare Matches Only on Equal, So Check Passing of Scheduled Time on Setting */
+		ldr temp, [memorymap_base, #equ32_systemtimer_counter_lower]
+		sub temp, temp, next
+		cmp temp, #0
+		bge timer32_irq_tick
+
+	timer32_irq_common:
+		mov r0, count
+		pop {r4-r11,pc}
+
+.unreq memorymap_base
+.unreq next
+.unreq tick
+.unreq entry
+.unreq running
+.unreq temp
+.unreq temp2
+.unreq count
+
+
+/**
+ * Link Timer Entry to Slot by Expiry, Call with IRQ and FIQ Disabled
+ * If the expiry is beyond level 3, the entry is linked to the last slot of level 3, and is cascaded again afterward.
+ *
+ * Parameters
+ * r0: Pointer of Timer Entry
+ *
+ * Return: r0 (Pointer of Timer Entry)
+ */
+timer32_enqueue:
+	/* Auto (Local) Variables, but just Aliases */
+	entry          .req r0
+	expires        .req r1
+	delta          .req r2
+	slot           .req r3
+	tick           .req ip
+
+	ldr expires, [entry, #equ32_timer32_expires]
+	ldr tick, TIMER32_TICK
+	sub delta, expires, tick
+	ldr slot, TIMER32_WHEEL
+
+	cmp delta, #0
+	movlt expires, tick                             @ If Past, Next Tick
+	blt timer32_enqueue_level0
+
+	cmp delta, #equ32_timer32_level0_slots
+	blo timer32_enqueue_level0
+
+	cmp delta, #0x4000
+	blo timer32_enqueue_level1
+
+	cmp delta, #0x100000
+	blo timer32_enqueue_level2
+
+	cmp delta, #0x4000000
+	mvnhs delta, #0xFC000000                       @ 0x3FFFFFF, Maximum Delta
+	addhs expires, tick, delta
+
+	/* Level 3 */
+	add slot, slot, #4 * (equ32_timer32_level0_slots + equ32_timer32_level_slots * 2)
+	lsr expires, expires, #20
+	b timer32_enqueue_upper
+
+	timer32_enqueue_level2:
+		add slot, slot, #4 * (equ32_timer32_level0_slots + equ32_timer32_level_slots)
+		lsr expires, expires, #14
+		b timer32_enqueue_upper
+
+	timer32_enqueue_level1:
+		add slot, slot, #4 * equ32_timer32_level0_slots
+		lsr expires, expires, #8
+
+	timer32_enqueue_upper:
+		and expires, expires, #equ32_timer32_level_slots - 1
+		add slot, slot, expires, lsl #2
+		b timer32_enqueue_link
+
+	timer32_enqueue_level0:
+		and expires, expires, #equ32_timer32_level0_slots - 1
+		add slot, slot, expires, lsl #2
+
+	timer32_enqueue_link:
+		ldr delta, [slot]                           @ First Entry
+		str delta, [entry, #equ32_timer32_next]
+		str slot, [entry, #equ32_timer32_prev]
+		cmp delta, #0
+		strne entry, [delta, #equ32_timer32_prev]
+		str entry, [slot]
+
+		mov pc, lr
+
+.unreq entry
+.unreq expires
+.unreq delta
+.unreq slot
+.unreq tick
+
+
+/**
+ * Cascade Slot of Upper Level to Lower Levels, Call with IRQ and FIQ Disabled
+ *
+ * Parameters
+ * r0: Pointer of Slot
+ *
+ * Return: r0 (0 as success)
+ */
+timer32_cascade:
+	/* Auto (Local) Variables, but just Aliases */
+	slot           .req r0
+	entry          .req r4
+	next           .req r5
+
+	push {r0-r5,lr}
+
+	ldr next, [slot]
+	mov entry, #0
+	str entry, [slot]
+
+	timer32_cascade_loop:
+		cmp next, #0
+		beq timer32_cascade_common
+
+		mov entry, next
+		ldr next, [entry, #equ32_timer32_next]
+		mov r0, entry
+		bl timer32_enqueue
+		b timer32_cascade_loop
+
+	timer32_cascade_common:
+		pop {r0-r5,lr}
+		mov r0, #0
+		mov pc, lr
+
+.unreq slot
+.unreq entry
+.unreq next
+
+.globl TIMER32_TICK
+.globl TIMER32_PERIOD
+TIMER32_TICK:         .word 0x00 @ Next Tick to Be Dispatched
+TIMER32_NEXT:         .word 0x00 @ Scheduled Time (Lower 32 Bits of System Timer) of Next Tick
+TIMER32_PERIOD:       .word 0x00 @ Micro Seconds per Tick
+TIMER32_RUNNING:      .word timer32_running
+TIMER32_WHEEL:        .word timer32_wheel
+.section	.data
+timer32_running:      .word 0x00 @ Head of Entries in Dispatching, Regarded as Slot
+timer32_wheel:        .space 4 * (equ32_timer32_level0_slots + equ32_timer32_level_slots * 3), 0x00
+.section	.arm_system32
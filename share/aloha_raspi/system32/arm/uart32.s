@@ -108,6 +108,7 @@ uart32_uartbreak:
  * r0: Test Data On(1), Off(0)
  * r1: Tx On(1), Off(0)
  * r2: Rx On(1), Off(0)
+ * r3: Loopback (UARTTXD to UARTRXD Internally) On(1), Off(0)
  *
  * Return: r0 (0 as Success)
  */
@@ -117,10 +118,11 @@ uart32_uartsettest:
 	tdr_on         .req r0
 	tx_on          .req r1
 	rx_on          .req r2
-	addr_uart      .req r3
-	temp           .req r4
+	loopback       .req r3
+	addr_uart      .req r4
+	temp           .req r5
 
-	push {r4}
+	push {r4-r5}
 
 	mov addr_uart, #equ32_peripherals_base
 	add addr_uart, addr_uart, #equ32_uart0_base_upper
@@ -148,18 +150,23 @@ uart32_uartsettest:
 	orrne temp, temp, #equ32_uart0_cr_rxe
 	biceq temp, temp, #equ32_uart0_cr_rxe
 
+	tst loopback, #1
+	orrne temp, temp, #equ32_uart0_cr_lbe
+	biceq temp, temp, #equ32_uart0_cr_lbe
+
 	str temp, [addr_uart, #equ32_uart0_cr]
 
 	macro32_dsb ip
 
 	uart32_uartsettest_common:
-		pop {r4}
+		pop {r4-r5}
 		mov r0, #0
 		mov pc, lr
 
 .unreq tdr_on
 .unreq tx_on
 .unreq rx_on
+.unreq loopback
 .unreq addr_uart
 .unreq temp
 
@@ -410,6 +417,410 @@ macro32_debug temp, 0, 100
 .unreq addr_uart
 
 
+/**
+ * function uart32_uarttxmalloc
+ * Make Ring Buffer for UART Transmit Queue
+ * Bytes queued by uart32_uarttxqueue are transmitted by the Tx interrupt through uart32_uarttxint.
+ * If the staging buffer for DMA is made, a long transfer to the empty queue is transmitted by DMA.
+ * Each byte occupies one word in the staging buffer, because DMA writes 32-bit words to DR and only Bit[7:0] is transmitted.
+ *
+ * Parameters
+ * r0: Size of Ring Buffer (Words), Rounded Down to Power of 2
+ * r1: Size of Staging Buffer for DMA (Words, Equals Maximum Bytes to Transmit by DMA), 0 as No DMA
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error(1): Memory Allocation Is Not Succeeded
+ */
+.globl uart32_uarttxmalloc
+uart32_uarttxmalloc:
+	/* Auto (Local) Variables, but just Aliases */
+	words_ring   .req r0
+	words_dma    .req r1
+	ring         .req r2
+	buffer_dma   .req r3
+
+	push {lr}
+
+	cmp words_ring, #0
+	beq uart32_uarttxmalloc_error
+
+	clz buffer_dma, words_ring
+	mov words_ring, #0x80000000
+	lsr words_ring, words_ring, buffer_dma   @ Round Down to Power of 2
+
+	push {r0-r1}
+	bl heap32_malloc
+	mov ring, r0
+	pop {r0-r1}
+
+	cmp ring, #0
+	beq uart32_uarttxmalloc_error
+
+	mov buffer_dma, #0
+	cmp words_dma, #0
+	beq uart32_uarttxmalloc_success
+
+	push {r0-r2}
+	mov r0, words_dma
+	bl heap32_malloc_noncache
+	mov buffer_dma, r0
+	pop {r0-r2}
+
+	cmp buffer_dma, #0
+	bne uart32_uarttxmalloc_success
+
+	push {r0-r3}
+	mov r0, ring
+	bl heap32_mfree
+	pop {r0-r3}
+
+	uart32_uarttxmalloc_error:
+		mov r0, #1
+		b uart32_uarttxmalloc_common
+
+	uart32_uarttxmalloc_success:
+		str buffer_dma, UART32_UARTTX_DMABUFFER
+		cmp buffer_dma, #0
+		moveq words_dma, #0
+		str words_dma, UART32_UARTTX_DMALENGTH
+
+		lsl words_ring, words_ring, #2          @ Substitution of Multiplication by 4
+		sub words_ring, words_ring, #1
+		str words_ring, UART32_UARTTX_MASK
+
+		mov buffer_dma, #0
+		str buffer_dma, UART32_UARTTX_HEAD
+		str buffer_dma, UART32_UARTTX_TAIL
+		str buffer_dma, UART32_UARTTX_HIGHWATER
+		str buffer_dma, UART32_UARTTX_BACKPRESSURE
+		str buffer_dma, UART32_UARTTX_DMACOUNT
+		str buffer_dma, uart32_uarttx_dmabusy
+
+		macro32_dsb ip
+
+		str ring, UART32_UARTTX_RING            @ Activate Queue at Last
+		mov r0, #0
+
+	uart32_uarttxmalloc_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq words_ring
+.unreq words_dma
+.unreq ring
+.unreq buffer_dma
+
+
+/**
+ * function uart32_uarttxqueue
+ * UART Transmit through Queue
+ * Bytes are copied to the ring buffer and transmitted by the Tx interrupt, i.e., this function doesn't wait for transmission.
+ * If the queue is empty, the transfer size is equal to or more than equ32_uart32_uarttx_dmathres,
+ * and the transfer fits with the staging buffer, the transfer is done by DMA instead of the ring buffer.
+ * If the ring buffer is not made by uart32_uarttxmalloc, this function transmits by uart32_uarttx.
+ * The Tx interrupt is enabled in this function while bytes are pending. Route the UART IRQ to uart32_uarttxint.
+ *
+ * Parameters
+ * r0: Heap for Transmit Data
+ * r1: Transfer Size (Bytes)
+ *
+ * Return: r0 (Size (Bytes) Not Queued Because of Full Ring Buffer, 0 as success)
+ */
+.globl uart32_uarttxqueue
+uart32_uarttxqueue:
+	/* Auto (Local) Variables, but just Aliases */
+	heap         .req r0
+	size_tx      .req r1
+	ring         .req r2
+	head         .req r3
+	tail         .req r4
+	mask         .req r5
+	temp         .req r6
+	save_cpsr    .req r7
+	byte         .req r8
+
+	ldr ring, UART32_UARTTX_RING
+	cmp ring, #0
+	beq uart32_uarttx                        @ If No Ring Buffer, Transmit Directly
+
+	push {r4-r8,lr}
+
+	macro32_dsb ip                           @ Ensure Completion of Instructions Before
+
+	/* For Atomic Procedure, Set FIQ and IRQ Disable to CPSR */
+	mrs save_cpsr, cpsr
+	orr ip, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, ip
+
+	cmp size_tx, #0
+	ble uart32_uarttxqueue_success
+
+	ldr head, UART32_UARTTX_HEAD
+	ldr tail, UART32_UARTTX_TAIL
+
+	/* DMA If Queue Is Empty and Transfer Is Long Enough */
+	cmp head, tail
+	bne uart32_uarttxqueue_ring
+	cmp size_tx, #equ32_uart32_uarttx_dmathres
+	blo uart32_uarttxqueue_ring
+	ldr temp, UART32_UARTTX_DMALENGTH
+	cmp size_tx, temp
+	bhi uart32_uarttxqueue_ring
+	ldr temp, uart32_uarttx_dmabusy
+	cmp temp, #0
+	bne uart32_uarttxqueue_ring
+
+	/* Expand Bytes to Words in Staging Buffer (Non-cache) */
+	ldr temp, UART32_UARTTX_DMABUFFER
+	mov mask, #0
+	uart32_uarttxqueue_dma:
+		ldrb byte, [heap, mask]
+		str byte, [temp, mask, lsl #2]
+		add mask, mask, #1
+		cmp mask, size_tx
+		blo uart32_uarttxqueue_dma
+
+	macro32_dsb ip
+
+	/* Enable Tx DMA on UART */
+	mov mask, #equ32_peripherals_base
+	add mask, mask, #equ32_uart0_base_upper
+	add mask, mask, #equ32_uart0_base_lower
+	ldr byte, [mask, #equ32_uart0_dmacr]
+	orr byte, byte, #equ32_uart0_dmacr_txdmae
+	str byte, [mask, #equ32_uart0_dmacr]
+
+	macro32_dsb ip
+
+	push {r0-r6}
+	mov r0, #equ32_dma32_cb_uart32_tx
+	mov r1, #equ32_dma_dreq_uart_tx<<equ32_dma_ti_permap  @ DREQ Map for UART Transmit
+	bic r1, r1, #equ32_dma_ti_no_wide_bursts
+	orr r1, r1, #0<<equ32_dma_ti_waits
+	orr r1, r1, #0<<equ32_dma_ti_burst_length
+	orr r1, r1, #equ32_dma_ti_src_inc                       @ Transfer Information Source
+	orr r1, r1, #equ32_dma_ti_dst_dreq                      @ Transfer Information Destination
+	orr r1, r1, #equ32_dma_ti_wait_resp
+	add r2, temp, #equ32_bus_coherence_base                 @ Source Address
+	mov r3, #equ32_bus_peripherals_base
+	add r3, r3, #equ32_uart0_base_upper
+	add r3, r3, #equ32_uart0_base_lower
+	add r3, r3, #equ32_uart0_dr                             @ Destination Address
+	lsl r4, size_tx, #2                                     @ Transfer Size, One Word per One Byte
+	mov r5, #0                                              @ 2D Stride
+	mvn r6, #0                                              @ Next CB Number, -1 as Nothing
+	push {r4-r6}
+	bl dma32_set_cb
+	add sp, sp, #12
+	pop {r0-r6}
+
+	push {r0-r3}
+	mov r0, #equ32_dma32_channel_uart32
+	mov r1, #equ32_dma32_cb_uart32_tx
+	bl dma32_set_channel
+	pop {r0-r3}
+
+	mov temp, #1
+	str temp, uart32_uarttx_dmabusy
+	ldr temp, UART32_UARTTX_DMACOUNT
+	add temp, temp, #1
+	str temp, UART32_UARTTX_DMACOUNT
+
+	mov size_tx, #0
+	b uart32_uarttxqueue_kick
+
+	uart32_uarttxqueue_ring:
+		ldr mask, UART32_UARTTX_MASK
+
+		uart32_uarttxqueue_ring_loop:
+			cmp size_tx, #0
+			ble uart32_uarttxqueue_ring_common
+
+			sub temp, head, tail
+			cmp temp, mask
+			bhi uart32_uarttxqueue_ring_full     @ If Pending Bytes Reach Size of Ring
+
+			ldrb byte, [heap]
+			and temp, head, mask
+			strb byte, [ring, temp]
+
+			add heap, heap, #1
+			add head, head, #1
+			sub size_tx, size_tx, #1
+			b uart32_uarttxqueue_ring_loop
+
+		uart32_uarttxqueue_ring_full:
+			ldr temp, UART32_UARTTX_BACKPRESSURE
+			add temp, temp, size_tx
+			str temp, UART32_UARTTX_BACKPRESSURE
+
+		uart32_uarttxqueue_ring_common:
+			macro32_dsb ip
+			str head, UART32_UARTTX_HEAD
+
+			/* High-watermark */
+			sub temp, head, tail
+			ldr byte, UART32_UARTTX_HIGHWATER
+			cmp temp, byte
+			strhi temp, UART32_UARTTX_HIGHWATER
+
+	uart32_uarttxqueue_kick:
+		push {r0-r3}
+		bl uart32_uarttxint                      @ Fill TxFIFO and Enable Tx Interrupt If Pending
+		pop {r0-r3}
+
+	uart32_uarttxqueue_success:
+		mov r0, size_tx
+
+	uart32_uarttxqueue_common:
+		/* Return CPSR */
+		msr cpsr_c, save_cpsr
+		macro32_dsb ip                           @ Ensure Completion of Instructions Before
+		pop {r4-r8,pc}
+
+.unreq heap
+.unreq size_tx
+.unreq ring
+.unreq head
+.unreq tail
+.unreq mask
+.unreq temp
+.unreq save_cpsr
+.unreq byte
+
+
+/**
+ * function uart32_uarttxint
+ * UART Transmit Interrupt Handler for Queue
+ * Fill TxFIFO from the ring buffer made by uart32_uarttxmalloc.
+ * The Tx interrupt is masked if no byte is pending, and is unmasked if bytes are pending or DMA is active.
+ * Call this function in IRQ with the UART interrupt, and uart32_uartintrouter calls this function.
+ *
+ * Return: r0 (0 as success)
+ */
+.globl uart32_uarttxint
+uart32_uarttxint:
+	/* Auto (Local) Variables, but just Aliases */
+	ring         .req r0
+	head         .req r1
+	tail         .req r2
+	mask         .req r3
+	temp         .req r4
+	byte         .req r5
+	addr_uart    .req r6
+
+	push {r4-r6}
+
+	ldr ring, UART32_UARTTX_RING
+	cmp ring, #0
+	beq uart32_uarttxint_success
+
+	mov addr_uart, #equ32_peripherals_base
+	add addr_uart, addr_uart, #equ32_uart0_base_upper
+	add addr_uart, addr_uart, #equ32_uart0_base_lower
+
+	/* Clear Tx Interrupt at First, Next Crossing of FIFO Level Will Be Caught */
+	mov temp, #equ32_uart0_intr_tx
+	str temp, [addr_uart, #equ32_uart0_icr]
+
+	macro32_dsb ip
+
+	ldr temp, uart32_uarttx_dmabusy
+	cmp temp, #0
+	beq uart32_uarttxint_fifo
+
+	/* Check DMA Channel */
+	mov temp, #equ32_peripherals_base
+	add temp, temp, #equ32_dma_base
+	add temp, temp, #equ32_dma32_channel_uart32 * equ32_dma_channel_offset
+	ldr temp, [temp, #equ32_dma_cs]
+	tst temp, #equ32_dma_cs_active
+	bne uart32_uarttxint_pending                @ If DMA Is Still Active
+
+	/* DMA Completed */
+	ldr temp, [addr_uart, #equ32_uart0_dmacr]
+	bic temp, temp, #equ32_uart0_dmacr_txdmae
+	str temp, [addr_uart, #equ32_uart0_dmacr]
+	mov temp, #0
+	str temp, uart32_uarttx_dmabusy
+
+	macro32_dsb ip
+
+	uart32_uarttxint_fifo:
+		ldr head, UART32_UARTTX_HEAD
+		ldr tail, UART32_UARTTX_TAIL
+		ldr mask, UART32_UARTTX_MASK
+
+		uart32_uarttxint_fifo_loop:
+			cmp tail, head
+			beq uart32_uarttxint_empty
+
+			ldr temp, [addr_uart, #equ32_uart0_fr]
+			tst temp, #equ32_uart0_fr_txff
+			bne uart32_uarttxint_fifo_common     @ If TxFIFO Is Full
+
+			and temp, tail, mask
+			ldrb byte, [ring, temp]
+			str byte, [addr_uart, #equ32_uart0_dr]
+
+			add tail, tail, #1
+			b uart32_uarttxint_fifo_loop
+
+		uart32_uarttxint_fifo_common:
+			str tail, UART32_UARTTX_TAIL
+			b uart32_uarttxint_pending
+
+	uart32_uarttxint_empty:
+		str tail, UART32_UARTTX_TAIL
+
+		/* Mask Tx Interrupt */
+		ldr temp, [addr_uart, #equ32_uart0_imsc]
+		bic temp, temp, #equ32_uart0_intr_tx
+		str temp, [addr_uart, #equ32_uart0_imsc]
+
+		b uart32_uarttxint_success
+
+	uart32_uarttxint_pending:
+		/* Unmask Tx Interrupt */
+		ldr temp, [addr_uart, #equ32_uart0_imsc]
+		orr temp, temp, #equ32_uart0_intr_tx
+		str temp, [addr_uart, #equ32_uart0_imsc]
+
+	uart32_uarttxint_success:
+		macro32_dsb ip
+		mov r0, #0
+
+	uart32_uarttxint_common:
+		pop {r4-r6}
+		mov pc, lr
+
+.unreq ring
+.unreq head
+.unreq tail
+.unreq mask
+.unreq temp
+.unreq byte
+.unreq addr_uart
+
+.globl UART32_UARTTX_RING
+.globl UART32_UARTTX_HEAD
+.globl UART32_UARTTX_TAIL
+.globl UART32_UARTTX_HIGHWATER
+.globl UART32_UARTTX_BACKPRESSURE
+.globl UART32_UARTTX_DMACOUNT
+.balign 4
+UART32_UARTTX_RING:          .word 0x00
+UART32_UARTTX_MASK:          .word 0x00 @ Size of Ring Buffer (Bytes) - 1
+UART32_UARTTX_HEAD:          .word 0x00 @ Free-running Index, Incremented by uart32_uarttxqueue Only
+UART32_UARTTX_TAIL:          .word 0x00 @ Free-running Index, Incremented by uart32_uarttxint Only
+UART32_UARTTX_HIGHWATER:     .word 0x00 @ Maximum Bytes Pending in Ring Buffer
+UART32_UARTTX_BACKPRESSURE:  .word 0x00 @ Total Bytes Not Queued Because of Full Ring Buffer
+UART32_UARTTX_DMABUFFER:     .word 0x00
+UART32_UARTTX_DMALENGTH:     .word 0x00
+UART32_UARTTX_DMACOUNT:      .word 0x00 @ Number of Transfers by DMA
+uart32_uarttx_dmabusy:       .word 0x00
+
+
 /**
  * function uart32_uartrx
  * UART Receive and Wait for Reaching Sufficient Size
@@ -523,9 +934,181 @@ uart32_uartclrrx:
 .unreq addr_uart
 
 
+/**
+ * function uart32_uartrxmalloc
+ * Make Ring Buffer for UART Receive
+ * If the ring buffer is made, uart32_uartintrouter only calls uart32_uartrxint, which moves all bytes in RxFIFO to the ring buffer.
+ * Then call uart32_uartline out of IRQ to edit lines (host mode) or to push bytes to UART32_UARTINT_CLIENT_FIFO (client mode).
+ *
+ * Parameters
+ * r0: Size of Ring Buffer (Words), Rounded Down to Power of 2
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error(1): Memory Allocation Is Not Succeeded
+ */
+.globl uart32_uartrxmalloc
+uart32_uartrxmalloc:
+	/* Auto (Local) Variables, but just Aliases */
+	words       .req r0
+	ring        .req r1
+	temp        .req r2
+
+	push {lr}
+
+	ldr ring, UART32_UARTRX_RING
+	cmp ring, #0
+	bne uart32_uartrxmalloc_error           @ If Already Made
+
+	bl heap32_mringmalloc
+	mov ring, r0
+
+	cmp ring, #0
+	beq uart32_uartrxmalloc_error
+
+	mov temp, #0
+	str temp, UART32_UARTRX_OVERRUN
+	str temp, UART32_UARTRX_ERROR
+
+	macro32_dsb ip
+
+	str ring, UART32_UARTRX_RING            @ Activate Ring Buffer at Last
+
+	b uart32_uartrxmalloc_success
+
+	uart32_uartrxmalloc_error:
+		mov r0, #1
+		b uart32_uartrxmalloc_common
+
+	uart32_uartrxmalloc_success:
+		mov r0, #0
+
+	uart32_uartrxmalloc_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq words
+.unreq ring
+.unreq temp
+
+
+/**
+ * function uart32_uartrxint
+ * UART Receive Interrupt Handler for Ring Buffer
+ * Move all bytes in RxFIFO to the ring buffer made by uart32_uartrxmalloc (producer side).
+ * CTRL characters are flagged on UART32_UARTINT_CTRL in this function to be detected immediately.
+ * Bytes with UART errors are dropped and counted on UART32_UARTRX_ERROR.
+ * Bytes which can't be stored because of the full ring buffer are dropped and counted on UART32_UARTRX_OVERRUN.
+ *
+ * Return: r0 (0 as success)
+ */
+.globl uart32_uartrxint
+uart32_uartrxint:
+	/* Auto (Local) Variables, but just Aliases */
+	ring        .req r0
+	head        .req r1
+	tail        .req r2
+	mask        .req r3
+	temp        .req r4
+	byte        .req r5
+	addr_uart   .req r6
+	ctrl        .req r7
+
+	push {r4-r7}
+
+	ldr ring, UART32_UARTRX_RING
+	cmp ring, #0
+	beq uart32_uartrxint_success
+
+	mov addr_uart, #equ32_peripherals_base
+	add addr_uart, addr_uart, #equ32_uart0_base_upper
+	add addr_uart, addr_uart, #equ32_uart0_base_lower
+
+	ldr head, [ring, #equ32_heap32_mring_head]
+	ldr tail, [ring, #equ32_heap32_mring_tail]
+	ldr mask, [ring, #equ32_heap32_mring_mask]
+	ldr ctrl, UART32_UARTINT_CTRL
+
+	macro32_dsb ip
+
+	uart32_uartrxint_fifo:
+		ldr temp, [addr_uart, #equ32_uart0_fr]
+		tst temp, #equ32_uart0_fr_rxfe
+		bne uart32_uartrxint_fifo_common        @ If Empty on RxFIFO
+
+		ldr byte, [addr_uart, #equ32_uart0_dr]  @ 12-bit Word, Bit[11:8] Is Errors
+		tst byte, #equ32_uart0_dr_oe|equ32_uart0_dr_be|equ32_uart0_dr_pe|equ32_uart0_dr_fe
+		bne uart32_uartrxint_fifo_error
+
+		and byte, byte, #0xFF
+
+		/* Check CTRL Characters */
+		cmp byte, #0x20
+		movlo temp, #1
+		orrlo ctrl, ctrl, temp, lsl byte
+
+		sub temp, head, tail
+		cmp temp, mask
+		bhi uart32_uartrxint_fifo_overrun       @ If Full
+
+		and temp, head, mask
+		add temp, temp, #equ32_heap32_mring_data
+		strb byte, [ring, temp]
+		add head, head, #1
+
+		b uart32_uartrxint_fifo
+
+		uart32_uartrxint_fifo_error:
+			strb temp, [addr_uart, #equ32_uart0_rsrecr] @ Clear by Write Any
+			ldr temp, UART32_UARTRX_ERROR
+			add temp, temp, #1
+			str temp, UART32_UARTRX_ERROR
+			b uart32_uartrxint_fifo
+
+		uart32_uartrxint_fifo_overrun:
+			ldr temp, UART32_UARTRX_OVERRUN
+			add temp, temp, #1
+			str temp, UART32_UARTRX_OVERRUN
+			b uart32_uartrxint_fifo
+
+		uart32_uartrxint_fifo_common:
+			str ctrl, UART32_UARTINT_CTRL
+			macro32_dsb ip                      @ Ensure Completion of Writing Data Before Publishing Head
+			str head, [ring, #equ32_heap32_mring_head]
+
+			mov temp, #equ32_uart0_intr_rt|equ32_uart0_intr_rx
+			str temp, [addr_uart, #equ32_uart0_icr]
+
+	uart32_uartrxint_success:
+		macro32_dsb ip
+		mov r0, #0
+
+	uart32_uartrxint_common:
+		pop {r4-r7}
+		mov pc, lr
+
+.unreq ring
+.unreq head
+.unreq tail
+.unreq mask
+.unreq temp
+.unreq byte
+.unreq addr_uart
+.unreq ctrl
+
+.globl UART32_UARTRX_RING
+.globl UART32_UARTRX_OVERRUN
+.globl UART32_UARTRX_ERROR
+.balign 4
+UART32_UARTRX_RING:          .word 0x00
+UART32_UARTRX_OVERRUN:       .word 0x00 @ Number of Bytes Dropped Because of Full Ring Buffer
+UART32_UARTRX_ERROR:         .word 0x00 @ Number of Bytes Dropped Because of UART Errors
+
+
 /**
  * function uart32_uartint
  * UART Interrupt Handler
+ * If the ring buffer is made by uart32_uartrxmalloc, this function gets one byte from the ring buffer instead of RxFIFO,
+ * and it's not an interrupt handler but a line editor called by uart32_uartline.
  *
  * Parameters
  * r0: Mirror Data to Teletype (1) or Send ACK (0)
@@ -560,6 +1143,10 @@ uart32_uartint:
 
 	ldr flag_escape, uart32_flag_escape
 
+	ldr temp, UART32_UARTRX_RING
+	cmp temp, #0
+	bne uart32_uartint_ring          @ If Bytes Are Received on Ring Buffer by uart32_uartrxint
+
 	push {r0-r3}
 	ldr r0, uart32_uartint_buffer
 	mov r1, #1                       @ 1 Bytes
@@ -591,6 +1178,8 @@ uart32_uartint:
 	tst temp, #0x1
 	bne uart32_uartint_error         @ If Busy
 
+	uart32_uartint_received:
+
 	/* If Succeed to Receive */
 
 	cmp flag_mirror, #0
@@ -600,7 +1189,7 @@ uart32_uartint:
 	push {r0-r3}
 	ldr r0, uart32_uartint_buffer
 	mov r1, #1                       @ 1 Bytes
-	bl uart32_uarttx
+	bl uart32_uarttxqueue
 	pop {r0-r3}
 
 	b uart32_uartint_verify
@@ -611,7 +1200,7 @@ uart32_uartint:
 		push {r0-r3}
 		ldr r0, uart32_uartint_ack
 		mov r1, #1
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 	uart32_uartint_verify:
@@ -662,25 +1251,25 @@ uart32_uartint:
 		push {r0-r3}
 		ldr r0, uart32_uartint_esc_left
 		mov r1, #3
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		push {r0-r3}
 		ldr r0, uart32_uartint_esc_left
 		mov r1, #3
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		push {r0-r3}
 		ldr r0, uart32_uartint_esc_clrline
 		mov r1, #3
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		push {r0-r3}
 		ldr r0, uart32_uartint_buffer
 		mov r1, #1                       @ 1 Bytes
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		b uart32_uartint_success
@@ -707,7 +1296,7 @@ uart32_uartint:
 			push {r0-r3}
 			ldr r0, uart32_uartint_esc_down
 			mov r1, #3
-			bl uart32_uarttx
+			bl uart32_uarttxqueue
 			pop {r0-r3}
 
 			b uart32_uartint_escseq_clear
@@ -718,7 +1307,7 @@ uart32_uartint:
 			push {r0-r3}
 			ldr r0, uart32_uartint_esc_up
 			mov r1, #3
-			bl uart32_uarttx
+			bl uart32_uarttxqueue
 			pop {r0-r3}
 
 			b uart32_uartint_escseq_clear
@@ -746,7 +1335,7 @@ uart32_uartint:
 				push {r0-r3}
 				ldr r0, uart32_uartint_esc_left
 				mov r1, #3
-				bl uart32_uarttx
+				bl uart32_uarttxqueue
 				pop {r0-r3}
 
 				b uart32_uartint_escseq_clear
@@ -766,7 +1355,7 @@ uart32_uartint:
 			push {r0-r3}
 			ldr r0, uart32_uartint_esc_right
 			mov r1, #3
-			bl uart32_uarttx
+			bl uart32_uarttxqueue
 			pop {r0-r3}
 
 		uart32_uartint_escseq_clear:
@@ -787,7 +1376,7 @@ uart32_uartint:
 		push {r0-r3}
 		ldr r0, uart32_uartint_esc_right
 		mov r1, #3
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		b uart32_uartint_success
@@ -819,14 +1408,14 @@ uart32_uartint:
 			push {r0-r3}
 			ldr r0, uart32_uartint_esc_clrline
 			mov r1, #3
-			bl uart32_uarttx
+			bl uart32_uarttxqueue
 			pop {r0-r3}
 
 			/* Reflect New Characters */
 			push {r0-r3}
 			add r0, heap, count
 			mov r1, temp 
-			bl uart32_uarttx
+			bl uart32_uarttxqueue
 			pop {r0-r3}
 
 			/* Move Cursor Left Because of Renewed Back Half */
@@ -837,7 +1426,7 @@ uart32_uartint:
 				push {r0-r3}
 				ldr r0, uart32_uartint_esc_left
 				mov r1, #3
-				bl uart32_uarttx
+				bl uart32_uarttxqueue
 				pop {r0-r3}
 
 				sub temp, temp, #1
@@ -914,7 +1503,7 @@ uart32_uartint:
 		push {r0-r3}
 		ldr r0, uart32_uartint_esc_clrline
 		mov r1, #3
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		/* Reflect New Characters */
@@ -922,7 +1511,7 @@ uart32_uartint:
 		add r0, heap, count
 		add r0, r0, #1
 		mov r1, temp 
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		/* Move Cursor Left Because of Renewed Back Half */
@@ -933,7 +1522,7 @@ uart32_uartint:
 			push {r0-r3}
 			ldr r0, uart32_uartint_esc_left
 			mov r1, #3
-			bl uart32_uarttx
+			bl uart32_uarttxqueue
 			pop {r0-r3}
 
 			sub temp, temp, #1
@@ -947,6 +1536,28 @@ uart32_uartint:
 
 			b uart32_uartint_success
 
+	uart32_uartint_ring:
+		/* CTRL Characters Are Already Checked by uart32_uartrxint */
+		ldr temp2, UART32_UARTINT_BUSY
+		tst temp2, #0x1
+		bne uart32_uartint_success       @ If Busy, Leave Bytes on Ring Buffer
+
+		push {r0-r3}
+		mov r0, temp
+		ldr r1, uart32_uartint_buffer
+		mov r2, #1                       @ 1 Bytes
+		bl heap32_mringread
+		mov temp, r0
+		pop {r0-r3}
+
+		cmp temp, #0
+		beq uart32_uartint_success       @ If No Receive
+
+		ldr byte, uart32_uartint_buffer
+		ldrb byte, [byte]
+
+		b uart32_uartint_received
+
 	uart32_uartint_error:
 		/* If No Heap, Overrun, or Busy to Receive */
 		push {r0-r3}
@@ -957,7 +1568,7 @@ uart32_uartint:
 		push {r0-r3}
 		ldr r0, uart32_uartint_nak
 		mov r1, #1
-		bl uart32_uarttx
+		bl uart32_uarttxqueue
 		pop {r0-r3}
 
 		mov r0, #1
@@ -1324,9 +1935,106 @@ uart32_uartclient:
 UART32_UARTCLIENT_MODE: .word 0x00
 
 
+/**
+ * function uart32_uartline
+ * Process Bytes on Ring Buffer for UART Receive (Consumer Side)
+ * In host mode, bytes are edited to lines through uart32_uartint until UART32_UARTINT_BUSY is set.
+ * In client mode, bytes are pushed to UART32_UARTINT_CLIENT_FIFO until the FIFO is full.
+ * Bytes which are not processed remain on the ring buffer. Call this function repeatedly out of IRQ.
+ *
+ * Parameters
+ * r0: Mirror Data to Teletype (1) or Send ACK (0)
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error(1): No Ring Buffer, or No FIFO in Client Mode
+ */
+.globl uart32_uartline
+uart32_uartline:
+	/* Auto (Local) Variables, but just Aliases */
+	flag_mirror .req r0
+	ring        .req r1
+	temp        .req r2
+
+	push {lr}
+
+	ldr ring, UART32_UARTRX_RING
+	cmp ring, #0
+	beq uart32_uartline_error
+
+	ldr temp, UART32_UARTCLIENT_MODE
+	cmp temp, #1
+	beq uart32_uartline_client
+
+	uart32_uartline_host:
+		ldr temp, UART32_UARTINT_BUSY
+		tst temp, #0x1
+		bne uart32_uartline_success      @ If Busy
+
+		ldr temp, [ring, #equ32_heap32_mring_head]
+		ldr ip, [ring, #equ32_heap32_mring_tail]
+		cmp temp, ip
+		beq uart32_uartline_success      @ If Empty
+
+		push {r0-r3}
+		bl uart32_uartint
+		pop {r0-r3}
+
+		b uart32_uartline_host
+
+	uart32_uartline_client:
+		ldr temp, [ring, #equ32_heap32_mring_head]
+		ldr ip, [ring, #equ32_heap32_mring_tail]
+		cmp temp, ip
+		beq uart32_uartline_success      @ If Empty
+
+		ldr temp, UART32_UARTINT_CLIENT_FIFO
+		cmp temp, #0
+		beq uart32_uartline_error        @ If No FIFO
+		ldr ip, [temp, #-4]              @ Maximum Size of Allocated Space (Bytes)
+		sub ip, ip, #8                   @ Same Limitation as heap32_mpush
+		ldr temp, [temp]                 @ Current Length (Bytes)
+		cmp temp, ip
+		bhs uart32_uartline_success      @ If FIFO Is Full
+
+		/* Pop from Ring Buffer */
+		push {r0-r3}
+		mov r0, ring
+		ldr r1, uart32_uartint_buffer
+		mov r2, #1                       @ 1 Bytes
+		bl heap32_mringread
+		pop {r0-r3}
+
+		/* Push to Buffer (FIFO Stack) */
+		push {r0-r3}
+		ldr r0, UART32_UARTINT_CLIENT_FIFO
+		ldr r1, uart32_uartint_buffer
+		ldrb r1, [r1]
+		mov r2, #0
+		bl heap32_mpush
+		pop {r0-r3}
+
+		b uart32_uartline_client
+
+	uart32_uartline_error:
+		mov r0, #1
+		b uart32_uartline_common
+
+	uart32_uartline_success:
+		mov r0, #0
+
+	uart32_uartline_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq flag_mirror
+.unreq ring
+.unreq temp
+
+
 /**
  * function uart32_uartintrouter
  * Route UART Interrupt to Host Mode or Client Mode
+ * If the ring buffer is made by uart32_uartrxmalloc, route UART interrupt to uart32_uartrxint for both modes.
  *
  * Parameters
  * r0: Mirror Data to Teletype (1) or Send ACK (0)
@@ -1341,6 +2049,14 @@ uart32_uartintrouter:
 
 	push {lr}
 
+	push {r0-r3}
+	bl uart32_uarttxint
+	pop {r0-r3}
+
+	ldr mode, UART32_UARTRX_RING
+	cmp mode, #0
+	bne uart32_uartintrouter_ring
+
 	ldr mode, UART32_UARTCLIENT_MODE
 	cmp mode, #1
 	beq uart32_uartintrouter_client
@@ -1353,6 +2069,13 @@ uart32_uartintrouter:
 
 		bl uart32_uartint_client
 
+		b uart32_uartintrouter_common
+
+	uart32_uartintrouter_ring:
+
+		/* Both Modes Are Processed by uart32_uartline */
+		bl uart32_uartrxint
+
 	uart32_uartintrouter_common:
 		pop {pc}
 
@@ -20,14 +20,34 @@
 .equ equ32_bcm32_alpha,                        16
 .equ equ32_arm32_random_value,                 0xFF       @ Initial Value to Be Shuffled
 .equ equ32_arm32_clockmanager_divisor_limiter, 0x2000     @ Minimum Limiter of Divisor, 2 on Integer Places and .0 on Decimal Places
+.equ equ32_arm32_l2table_offset,               0xC000     @ Offset of Second Level Page Tables in Descriptors of Each Core
+.equ equ32_arm32_l2table_number,               16         @ Number of Second Level Page Tables (1K Bytes) for Each Core
+.ifdef __ARMV6
+.equ equ32_arm32_cache_line,                   32         @ Bytes of Data Cache Line
+.equ equ32_arm32_cache_crossover,              0x8000     @ Default Crossover from Lines to Whole Cache, Set by arm32_cache_calibrate
+.else
+.equ equ32_arm32_cache_line,                   64         @ Bytes of Data Cache Line, Updated by arm32_cache_calibrate
+.equ equ32_arm32_cache_crossover,              0x20000    @ Default Crossover from Lines to Whole Cache, Set by arm32_cache_calibrate
+.endif
+.equ equ32_arm32_perf_markers,                 16         @ Number of Markers on arm32_perf_begin and arm32_perf_end
+.equ equ32_arm32_perf_entry_shift,             7          @ 128 Bytes per Marker
+.equ equ32_arm32_perf_count,                   0x00       @ Offset of Number of Measurements on Marker
+.equ equ32_arm32_perf_start_cycles,            0x04       @ Offset of Cycle Counter on arm32_perf_begin
+.equ equ32_arm32_perf_start_event0,            0x08       @ Offset of Event Counter 0 on arm32_perf_begin
+.equ equ32_arm32_perf_start_event1,            0x0C       @ Offset of Event Counter 1 on arm32_perf_begin
+.equ equ32_arm32_perf_cycles,                  0x10       @ Offset of Statistics of Cycles (Sum Lower, Sum Upper, Min, Max)
+.equ equ32_arm32_perf_event0,                  0x20       @ Offset of Statistics of Event 0 (Sum Lower, Sum Upper, Min, Max)
+.equ equ32_arm32_perf_event1,                  0x30       @ Offset of Statistics of Event 1 (Sum Lower, Sum Upper, Min, Max)
+.equ equ32_arm32_perf_histogram,               0x40       @ Offset of Histogram of Cycles, 16 Words, Bucket N Is 4^N to 4^(N+1) - 1
 .equ equ32_i2c32_timeout,                      0x00FF0000
+.equ equ32_i2c32_chain_timeout,                0x00010000 @ Loops to Wait for TA on Repeated Start
 .equ equ32_fb32_image_16bit_tp_color,          0x0000     @ Assigned 16-bit Color Code as Full Transparent
 .equ equ32_print32_font_color,                 0xFFFFFFFF @ Default Font Color
 .equ equ32_print32_font_backcolor,             0xFF000000 @ Default Background Color
 .equ equ32_print32_hexa_length_max,            0x00000FF0
 .equ equ32_print32_string_tab_length,          4
 .equ equ32_print32_string_buffer_size,         16
-.equ equ32_dma32_cb_max,                       0x1400     @ Decimal 5120
+.equ equ32_dma32_cb_max,                       0x1500     @ Decimal 5376
 .equ equ32_dma32_cb_snd32_start,               0
 .equ equ32_dma32_cb_snd32_size,                0x1000     @ Decimal 4096
 .equ equ32_dma32_cb_fb32,                      0x1000
@@ -35,9 +55,58 @@
 .equ equ32_dma32_channel_snd32,                7          @ 0-14 (7-14 16-bit length), VideoCore Resereves Channels, Check by Mail
 .equ equ32_dma32_channel_fb32,                 2          @ 0-14 (7-14 16-bit length), VideoCore Resereves Channels, Check by Mail
 .equ equ32_dma32_channel_dma32,                4          @ 0-14 (7-14 16-bit length), VideoCore Resereves Channels, Check by Mail
+.equ equ32_dma32_cb_uart32_tx,                 0x1200
+.equ equ32_dma32_channel_uart32,               5          @ 0-14 (7-14 16-bit length), VideoCore Resereves Channels, Check by Mail
+.equ equ32_dma32_cb_dmx32_tx,                  0x1280     @ Uses equ32_dma32_channel_uart32
+.equ equ32_dma32_cb_dmx32_rx,                  0x12C0
+.equ equ32_dma32_channel_dmx32_rx,             14         @ 0-14 (7-14 16-bit length), VideoCore Resereves Channels, Check by Mail
+.equ equ32_dma32_cb_spi32_tx,                  0x1300
+.equ equ32_dma32_cb_spi32_rx,                  0x1380
+.equ equ32_dma32_channel_spi32_tx,             12         @ Taken from Pool (0x7F35 by Mail for ARM), Lite Is Enough for DLEN
+.equ equ32_dma32_channel_spi32_rx,             13         @ Taken from Pool (0x7F35 by Mail for ARM), Lite Is Enough for DLEN
+.equ equ32_dma32_cb_pool_start,                0x1400     @ CBs for dma32_submit, Allocated Dynamically
+.equ equ32_dma32_cb_pool_size,                 0x100      @ Decimal 256, Multiple of 32
+.equ equ32_dma32_pool_channel,                 0x0F01     @ Channels for dma32_submit, Bit[14:0], 0 and 8-11 as Default, Check by Mail
+.equ equ32_dma32_pool_ring_size,               16         @ Number of Tickets in Completion Queue, Power of 2
+.equ equ32_dma32_pool_error_size,              8          @ Number of Tickets with DMA Error Recorded for dma32_poll, Power of 2
+.equ equ32_uart32_uarttx_dmathres,             64         @ Minimum Bytes to Transmit by DMA on uart32_uarttxqueue
+.equ equ32_heap32_mring_head,                  0x0        @ Offset of Head Index on Ring Buffer, Incremented by Producer Only
+.equ equ32_heap32_mring_tail,                  0x4        @ Offset of Tail Index on Ring Buffer, Incremented by Consumer Only
+.equ equ32_heap32_mring_mask,                  0x8        @ Offset of Mask (Size of Data Space in Bytes - 1) on Ring Buffer
+.equ equ32_heap32_mring_data,                  0xC        @ Offset of Data Space on Ring Buffer
+.equ equ32_heap32_mcopy_dmathres,              0x40000    @ Minimum Bytes to Copy by DMA on heap32_mcopy in Privileged Mode
+.equ equ32_timer32_next,                       0x00       @ Offset of Next Entry on Timer Entry
+.equ equ32_timer32_prev,                       0x04       @ Offset of Previous Entry or Slot on Timer Entry, 0 as Not Pending
+.equ equ32_timer32_expires,                    0x08       @ Offset of Tick to Expire on Timer Entry
+.equ equ32_timer32_period,                     0x0C       @ Offset of Period (Ticks) on Timer Entry, 0 as One-shot
+.equ equ32_timer32_function,                   0x10       @ Offset of Function on Timer Entry
+.equ equ32_timer32_argument,                   0x14       @ Offset of Argument (r0) on Timer Entry
+.equ equ32_timer32_count,                      0x18       @ Offset of Number of Dispatches on Timer Entry
+.equ equ32_timer32_latency_last,               0x1C       @ Offset of Latency (Micro Seconds) on Last Dispatch on Timer Entry
+.equ equ32_timer32_latency_min,                0x20       @ Offset of Minimum Latency on Timer Entry
+.equ equ32_timer32_latency_max,                0x24       @ Offset of Maximum Latency on Timer Entry, Jitter Is Maximum - Minimum
+.equ equ32_timer32_latency_sum,                0x28       @ Offset of Sum of Latencies on Timer Entry, Lower 32 Bits
+.equ equ32_timer32_entry_size,                 0x30       @ Bytes of Timer Entry
+.equ equ32_timer32_level0_slots,               256        @ Slots of One Tick
+.equ equ32_timer32_level_slots,                64         @ Slots of Level 1-3, 256/16384/1048576 Ticks Each
+.equ equ32_trans32_next,                       0x00       @ Offset of Next Entry on Transaction Entry of i2c32/spi32 Queue
+.equ equ32_trans32_address,                    0x04       @ Offset of Device Address (I2C) or Value of CS Register (SPI) on Transaction Entry
+.equ equ32_trans32_tx,                         0x08       @ Offset of Pointer of Write Buffer on Transaction Entry
+.equ equ32_trans32_tx_length,                  0x0C       @ Offset of Bytes to Write on Transaction Entry
+.equ equ32_trans32_rx,                         0x10       @ Offset of Pointer of Read Buffer on Transaction Entry
+.equ equ32_trans32_rx_length,                  0x14       @ Offset of Bytes to Read on Transaction Entry
+.equ equ32_trans32_status,                     0x18       @ Offset of Status on Transaction Entry, -1 as Pending, 0 as Success, 1 and More as Error
+.equ equ32_trans32_count_tx,                   0x1C       @ Offset of Bytes Written (Clocked on SPI) on Transaction Entry
+.equ equ32_trans32_count_rx,                   0x20       @ Offset of Bytes Read (Clocked on SPI) on Transaction Entry
+.equ equ32_trans32_time,                       0x24       @ Offset of Time on Transaction Entry, Start Time, Then Micro Seconds to Complete
+.equ equ32_trans32_callback,                   0x28       @ Offset of Function Called on Completion with r0 as Pointer of Entry, 0 as No Callback
+.equ equ32_trans32_entry_size,                 0x2C       @ Bytes of Transaction Entry
+.equ equ32_trans32_duplex,                     0x80000000 @ Bit[31] of Address on SPI, Read While Writing, Otherwise Read after Writing
 .equ equ32_gpio32_lane_max,                    4
 .equ equ32_gpio32_gpiomask,                    0x0FFFFFFC @ GPIO 2-27 in Raspberry Pi (Except Earlier Version)
 .equ equ32_pwm32_maxchannel,                   2          @ Number of Available PWM Channels
+.equ equ32_dmx32_break,                        92         @ Micro Seconds of Break on dmx32_dmx512dma_tx (88 and Over)
+.equ equ32_dmx32_mab,                          12         @ Micro Seconds of Mark After Break on dmx32_dmx512dma_tx (8 and Over)
 .equ equ32_cvt32_int32_to_string_bin_false,    0x30
 .equ equ32_cvt32_int32_to_string_bin_true,     0x31
 .equ equ32_cvt32_float32_to_string_min_expo,   1
@@ -53,6 +122,10 @@
 .equ equ32_sts32_synthemidi_release,           512        @ Default Release Time (Beats) (64^2)/8
 .equ equ32_sts32_synthemidi_volume,            20         @ Default Volume Multiplier
 .equ equ32_sts32_synthemidi_presets,           7          @ Maximum Index of Presets (Number of Presets - 1)
+.equ equ32_sts32_synthemidi_latency,           64         @ Delay (Samples) from Receiving MIDI Message to Applying Event, 2ms on 32000Hz
+.equ equ32_sts32_synthemidi_steal_oldest,      0x1        @ Steal Voice Turned On at Oldest If All Voices Are Used
+.equ equ32_sts32_synthemidi_steal_quietest,    0x2        @ Steal Voice with Quietest Main Amplitude If All Voices Are Used, Prior to Oldest
+.equ equ32_sts32_synthemidi_steal_retrigger,   0x4        @ Retrigger Voice Sounding Same Note
 .equ equ32_sts32_mul_pwm,                      1          @ Multiplier to Make Clock Divisor on PWM, with Value in Header, etc.
 .equ equ32_sts32_mul_pcm,                      6          @ Multiplier to Make Clock Divisor on PCM, with Value in Header, etc.
 .equ equ32_sts32_range,                        0x400      @ Default Freq. Range on Modulation, +-(This Value * equ32_sts32_mul_*)
@@ -91,14 +164,29 @@
 .equ equ32_snd32_range,                        0x400      @ Default Freq. Range on Modulation, +-(This Value * equ32_snd32_mul_*)
 .equ equ32_snd32_neutraldiv_pwm,               0xCA04     @ Neutral Clock Divisor on Pitch Bend on PWM Mode, Already Multiplied
 .equ equ32_snd32_neutraldiv_pcm,               0x12F06    @ Neutral Clock Divisor on Pitch Bend on PCM Mode, Already Multiplied
+.equ equ32_rom32_page_size,                    32         @ Page Size of I2C EEPROM in Bytes, Power of Two, e.g., 32 for 24LC32A/24LC64, 64 for 24LC256
+.equ equ32_rom32_poll_count,                   0x200      @ Maximum Count of ACK Polling for Write Cycle of I2C EEPROM
+.equ equ32_rom32_poll_interval,                10         @ Interval of ACK Polling in Microseconds
+.equ equ32_rom32_cache_line,                   32         @ Bytes per Line of Read Cache of I2C EEPROM, Power of Two
+.equ equ32_rom32_cache_lines,                  8          @ Number of Lines of Read Cache of I2C EEPROM, Power of Two
 .equ equ32_lcd32_time_clock,                   1          @ Wait Time for Command Clock in Microseconds
 .equ equ32_lcd32_time_reset1,                  0x9C00     @ Wait Time after Rise of VCC in Microseconds, 39936 in Decimal
 .equ equ32_lcd32_time_reset2,                  0x1300     @ Wait Time after First Function Set in Microseconds, 4864 in Decimal
 .equ equ32_lcd32_time_reset3,                  200        @ Wait Time after Second Function Set in Microseconds
 .equ equ32_lcd32_time_execution1,              40         @ Wait Time after Normal Execution in Microseconds
 .equ equ32_lcd32_time_execution2,              2000       @ Wait Time after Clear Display or Retrun Home in Microseconds
+.equ equ32_lcd32_queue_size,                   256        @ Entries of Command Queue for Asynchronous Functions, Power of Two
+.equ equ32_lcd32_queue_data,                   0x100      @ Flag of Entry in Command Queue to Set RS as Data
 .equ equ32_tft32_cs,                           0          @ Chip Select Number (0 or 1) of SPI
 .equ equ32_tft32_deviceid,                     0          @ Device ID (0 or 1) Set by IM[0], An External Pin on Type 1
+.equ equ32_tft32_dma_pixels,                   0x400      @ Pixels per DMA Transfer of Image, Even, Two Staging Buffers
+.equ equ32_tft32_dma_timeout,                  0x10000000 @ Time Out in Turns of Waiting for DMA of Image
+.equ equ32_tft32_band,                         16         @ Rows per Band to Detect Dirty Rectangles of Shadow
+.equ equ32_tft32_window_overhead,              11         @ Cost of One Window in Pixels, 3 Registers (18 Bytes) and GRAM Write (4 Bytes)
+.equ equ32_tft32_window_x,                     0x44       @ Register of Horizontal RAM Address Position, End Bit[15:8] and Start Bit[7:0]
+.equ equ32_tft32_window_y,                     0x45       @ Register of Vertical RAM Address Position, End Bit[15:8] and Start Bit[7:0]
+.equ equ32_tft32_gram,                         0x21       @ Register of GRAM Address Set, Vertical Bit[15:8] and Horizontal Bit[7:0]
+.equ equ32_spi32_dma_length,                   0xFFFC     @ Maximum Bytes per DMA Transfer (DLEN Is 16-bit), Multiple of 4
 
 .equ equ32_bus_peripherals_base,               0x7E000000 @ Peripheral Address in View of Peripheral, DMA, and VideoCore (Bus Address)
 .equ equ32_bus_l2allocate_base,                0x40000000 @ L2 Allocate in View of Bus Address
@@ -183,6 +271,11 @@
 .equ equ32_systemtimer_compare2,         0x14
 .equ equ32_systemtimer_compare3,         0x18
 
+.equ equ32_systemtimer_cs_m0,             0x01 @ Match on Compare 0, Used by VideoCore, Write 1 to Clear
+.equ equ32_systemtimer_cs_m1,             0x02 @ Match on Compare 1, IRQ 1, Write 1 to Clear
+.equ equ32_systemtimer_cs_m2,             0x04 @ Match on Compare 2, Used by VideoCore, Write 1 to Clear
+.equ equ32_systemtimer_cs_m3,             0x08 @ Match on Compare 3, IRQ 3, Write 1 to Clear
+
 .equ equ32_interrupt_pending_basic_irqs, 0x00
 .equ equ32_interrupt_pending_irqs1,      0x04
 .equ equ32_interrupt_pending_irqs2,      0x08
@@ -350,7 +443,7 @@
 .equ equ32_uart0_ris,       0x3C      @ Raw Interrupt Status
 .equ equ32_uart0_mis,       0x40      @ Masked Interrupt Status
 .equ equ32_uart0_icr,       0x44      @ Interrupt Clear by Set (1)
-.equ equ32_uart0_dmacr,     0x48      @ DMA Control, N/A
+.equ equ32_uart0_dmacr,     0x48      @ DMA Control
 .equ equ32_uart0_tcr,       0x80      @ Test Control
 .equ equ32_uart0_itip,      0x84      @ Integration Test Input Read/ Set
 .equ equ32_uart0_itop,      0x88      @ Integration Test Output Read/ Set
@@ -415,8 +508,8 @@
 .equ equ32_uart0_intr_rim,      0x001 @ RI, N/A
 
 .equ equ32_uart0_dmacr_dmaonerr, 0x04 @ Stops DMA When UART Error, N/A
-.equ equ32_uart0_dmacr_txdmae,   0x02 @ Tx DMA Enable, N/A
-.equ equ32_uart0_dmacr_rxdmae,   0x01 @ Rx DMA Enable, N/A
+.equ equ32_uart0_dmacr_txdmae,   0x02 @ Tx DMA Enable, DREQ 12 (equ32_dma_dreq_uart_tx)
+.equ equ32_uart0_dmacr_rxdmae,   0x01 @ Rx DMA Enable, DREQ 14 (equ32_dma_dreq_uart_rx)
 
 .equ equ32_uart0_tcr_sirtest,    0x04 @ N/A
 .equ equ32_uart0_tcr_testfifo,   0x02 @ Test FIFO Enable, Direct Write/Read through equ32_uart0_tdr
@@ -650,6 +743,22 @@
 .equ equ32_dma_ti_tdmode,             0x00000002 @ Enable 2D mode
 .equ equ32_dma_ti_inten,              0x00000001 @ Enable Interrupts
 
+/* Peripheral Mapping (DREQ) Numbers, Use with `LSL #equ32_dma_ti_permap` */
+.equ equ32_dma_dreq_none,             0
+.equ equ32_dma_dreq_dsi,              1
+.equ equ32_dma_dreq_pcm_tx,           2
+.equ equ32_dma_dreq_pcm_rx,           3
+.equ equ32_dma_dreq_smi,              4
+.equ equ32_dma_dreq_pwm,              5
+.equ equ32_dma_dreq_spi_tx,           6
+.equ equ32_dma_dreq_spi_rx,           7
+.equ equ32_dma_dreq_bsc_tx,           8
+.equ equ32_dma_dreq_bsc_rx,           9
+.equ equ32_dma_dreq_emmc,             11
+.equ equ32_dma_dreq_uart_tx,          12
+.equ equ32_dma_dreq_sdhost,           13
+.equ equ32_dma_dreq_uart_rx,          14
+
 .equ equ32_cm_gp0ctl,          0x00000070 @ Clock Manager General Purpose 0 (GPO) Clock Control
 .equ equ32_cm_gp0div,          0x00000074 @ Clock Manager General Purpose 0 (GPO) Clock Divisor
 .equ equ32_cm_gp1ctl,          0x00000078 @ Clock Manager General Purpose 1 (GP1) Clock Control
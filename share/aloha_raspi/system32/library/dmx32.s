@@ -126,6 +126,602 @@ dmx32_dmx512doublebuffer_tx:
 .unreq temp2
 
 
+/**
+ * function dmx32_dmx512dma_init
+ * Initialize DMX512 Double Buffer Transmitter by DMA
+ * DMX32_BUFFER_FRONT and DMX32_BUFFER_BACK are allocated by dmx32_dmx512doublebuffer_init,
+ * and a buffer for DMA is allocated in non-cache memory, one word per one slot.
+ *
+ * Parameters
+ * r0: Length of Buffer (Channel Slots Plus 1 Slot for Start Code)
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Memory Allocation Fails or Length Is Zero
+ */
+.globl dmx32_dmx512dma_init
+dmx32_dmx512dma_init:
+	/* Auto (Local) Variables, but just Aliases */
+	num_data       .req r0
+	temp           .req r1
+
+	push {lr}
+
+	cmp num_data, #0
+	beq dmx32_dmx512dma_init_error
+
+	push {r0}
+	bl dmx32_dmx512doublebuffer_init
+	mov temp, r0
+	pop {r0}
+
+	cmp temp, #0
+	bne dmx32_dmx512dma_init_error
+
+	push {r0}
+	bl heap32_malloc_noncache               @ One Word per One Slot
+	mov temp, r0
+	pop {r0}
+
+	cmp temp, #0
+	beq dmx32_dmx512dma_init_error
+
+	str temp, DMX32_DMA_BUFFER
+
+	mov temp, #0
+	str temp, dmx32_dmx512dma_busy
+
+	b dmx32_dmx512dma_init_success
+
+	dmx32_dmx512dma_init_error:
+		mov r0, #1
+		b dmx32_dmx512dma_init_common
+
+	dmx32_dmx512dma_init_success:
+		mov r0, #0
+
+	dmx32_dmx512dma_init_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq num_data
+.unreq temp
+
+
+/**
+ * function dmx32_dmx512dma_tx
+ * DMX512 Double Buffer Transmitter by DMA
+ * A whole packet in DMX32_BUFFER_FRONT is sent by DMA to TxFIFO of UART, i.e., no call per slot.
+ * Call this function repeatedly, e.g., in a loop or with a timer. While the last packet is sent, this function returns 1 immediately.
+ * Otherwise, this function sends the Break and the Mark After Break (MAB) with uart32_uartbreak, then starts DMA for the next packet.
+ * The Break and the MAB are waited with arm32_sleep (equ32_dmx32_break and equ32_dmx32_mab), slots are copied to the buffer for DMA in the Break.
+ * 513 slots at 250K baud take appx. 22.7 milli seconds, so calling this function on every 1 milli second or less makes appx. 44 packets per second.
+ * Caution! The DMA channel of uart32 is used, so don't use DMA of uart32_uarttxqueue together.
+ *
+ * Parameters
+ * r0: 0 as Send FRONT, 1 as Swap FRONT/BACK on End of Packet, Then Send FRONT
+ *
+ * Return: r0 (0 as success, 1 as busy, 2 as error)
+ * Error(2): Not Initialized by dmx32_dmx512dma_init
+ */
+.globl dmx32_dmx512dma_tx
+dmx32_dmx512dma_tx:
+	/* Auto (Local) Variables, but just Aliases */
+	swap           .req r0
+	data_point     .req r1
+	num_data       .req r2
+	buffer_dma     .req r3
+	memorymap_base .req r4
+	temp           .req r5
+	temp2          .req r6
+
+	push {r4-r6,lr}
+
+	ldr buffer_dma, DMX32_DMA_BUFFER
+	cmp buffer_dma, #0
+	beq dmx32_dmx512dma_tx_error
+
+	ldr temp, dmx32_dmx512dma_busy
+	cmp temp, #0
+	beq dmx32_dmx512dma_tx_break
+
+	/* Check DMA Channel */
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_dma_base
+	add memorymap_base, memorymap_base, #equ32_dma32_channel_uart32 * equ32_dma_channel_offset
+	ldr temp, [memorymap_base, #equ32_dma_cs]
+	tst temp, #equ32_dma_cs_active
+	bne dmx32_dmx512dma_tx_busy                @ If DMA Is Still Active
+
+	/* Wait for Last Slots in TxFIFO and Shift Register */
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_uart0_base_upper
+	add memorymap_base, memorymap_base, #equ32_uart0_base_lower
+	ldr temp, [memorymap_base, #equ32_uart0_fr]
+	tst temp, #equ32_uart0_fr_busy
+	bne dmx32_dmx512dma_tx_busy
+
+	/* End of Packet */
+	ldr temp, [memorymap_base, #equ32_uart0_dmacr]
+	bic temp, temp, #equ32_uart0_dmacr_txdmae
+	str temp, [memorymap_base, #equ32_uart0_dmacr]
+	mov temp, #0
+	str temp, dmx32_dmx512dma_busy
+
+	macro32_dsb ip
+
+	cmp swap, #0
+	beq dmx32_dmx512dma_tx_break
+
+	/* Flip Front/Back */
+
+	ldr temp, DMX32_BUFFER_FRONT
+	ldr temp2, DMX32_BUFFER_BACK
+
+	str temp2, DMX32_BUFFER_FRONT
+	str temp, DMX32_BUFFER_BACK
+
+	macro32_dsb ip
+
+	dmx32_dmx512dma_tx_break:
+		push {r0-r3}
+		mov r0, #1
+		bl uart32_uartbreak
+		pop {r0-r3}
+
+		/* Expand Slots to Words in Buffer for DMA (Non-cache) in Break */
+		ldr data_point, DMX32_BUFFER_FRONT
+		ldr num_data, DMX32_BUFFER_LENGTH
+		mov temp, #0
+		dmx32_dmx512dma_tx_break_loop:
+			ldrb temp2, [data_point, temp]
+			str temp2, [buffer_dma, temp, lsl #2]
+			add temp, temp, #1
+			cmp temp, num_data
+			blo dmx32_dmx512dma_tx_break_loop
+
+		macro32_dsb ip
+
+		push {r0-r3}
+		mov r0, #equ32_dmx32_break
+		bl arm32_sleep
+		mov r0, #0
+		bl uart32_uartbreak
+		mov r0, #equ32_dmx32_mab
+		bl arm32_sleep
+		pop {r0-r3}
+
+		/* Enable Tx DMA on UART */
+		mov memorymap_base, #equ32_peripherals_base
+		add memorymap_base, memorymap_base, #equ32_uart0_base_upper
+		add memorymap_base, memorymap_base, #equ32_uart0_base_lower
+		ldr temp, [memorymap_base, #equ32_uart0_dmacr]
+		orr temp, temp, #equ32_uart0_dmacr_txdmae
+		str temp, [memorymap_base, #equ32_uart0_dmacr]
+
+		macro32_dsb ip
+
+		push {r0-r6}
+		lsl r4, num_data, #2                                    @ Transfer Size, One Word per One Slot
+		mov r5, #0                                              @ 2D Stride
+		mvn r6, #0                                              @ Next CB Number, -1 as Nothing
+		mov r0, #equ32_dma32_cb_dmx32_tx
+		mov r1, #equ32_dma_dreq_uart_tx<<equ32_dma_ti_permap  @ DREQ Map for UART Transmit
+		orr r1, r1, #equ32_dma_ti_src_inc                       @ Transfer Information Source
+		orr r1, r1, #equ32_dma_ti_dst_dreq                      @ Transfer Information Destination
+		orr r1, r1, #equ32_dma_ti_wait_resp
+		add r2, buffer_dma, #equ32_bus_coherence_base           @ Source Address
+		mov r3, #equ32_bus_peripherals_base
+		add r3, r3, #equ32_uart0_base_upper
+		add r3, r3, #equ32_uart0_base_lower
+		add r3, r3, #equ32_uart0_dr                             @ Destination Address
+		push {r4-r6}
+		bl dma32_set_cb
+		add sp, sp, #12
+		pop {r0-r6}
+
+		push {r0-r3}
+		mov r0, #equ32_dma32_channel_uart32
+		mov r1, #equ32_dma32_cb_dmx32_tx
+		bl dma32_set_channel
+		pop {r0-r3}
+
+		mov temp, #1
+		str temp, dmx32_dmx512dma_busy
+		ldr temp, DMX32_DMA_COUNT
+		add temp, temp, #1
+		str temp, DMX32_DMA_COUNT
+
+		macro32_dsb ip
+
+		b dmx32_dmx512dma_tx_success
+
+	dmx32_dmx512dma_tx_error:
+		mov r0, #2
+		b dmx32_dmx512dma_tx_common
+
+	dmx32_dmx512dma_tx_busy:
+		mov r0, #1
+		b dmx32_dmx512dma_tx_common
+
+	dmx32_dmx512dma_tx_success:
+		mov r0, #0
+
+	dmx32_dmx512dma_tx_common:
+		pop {r4-r6,pc}
+
+.unreq swap
+.unreq data_point
+.unreq num_data
+.unreq buffer_dma
+.unreq memorymap_base
+.unreq temp
+.unreq temp2
+
+.globl DMX32_DMA_BUFFER
+DMX32_DMA_BUFFER:           .word 0x00
+.globl DMX32_DMA_COUNT
+DMX32_DMA_COUNT:            .word 0x00 @ Number of Packets Sent by DMA
+dmx32_dmx512dma_busy:       .word 0x00
+
+
+/**
+ * function dmx32_dmx512dma_rxinit
+ * Initialize DMX512 Double Buffer Receiver by DMA
+ * DMX32_BUFFER_LENGTH is set by dmx32_dmx512doublebuffer_init (or dmx32_dmx512dma_init) in advance,
+ * and a buffer for DMA is allocated in non-cache memory, one word per one slot with error bits of UART.
+ * DMX32_DMA_RXFRONT and DMX32_DMA_RXBACK are allocated for the receiver, apart from DMX32_BUFFER_FRONT and DMX32_BUFFER_BACK of the transmitter,
+ * so the receiver never overwrites the source of dmx32_dmx512dma_tx on the loopback of UART.
+ * Only the break error interrupt is unmasked on UART, so dmx32_dmx512dma_rx is called once per packet.
+ *
+ * Parameters
+ * r0: 0 as Polling (IRQ Is Disabled), 1 as IRQ (UART IRQ #57)
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Memory Allocation Fails or Not Initialized by dmx32_dmx512doublebuffer_init
+ */
+.globl dmx32_dmx512dma_rxinit
+dmx32_dmx512dma_rxinit:
+	/* Auto (Local) Variables, but just Aliases */
+	flag_irq       .req r0
+	temp           .req r1
+	temp2          .req r2
+
+	push {lr}
+
+	ldr temp, DMX32_BUFFER_FRONT
+	cmp temp, #0
+	beq dmx32_dmx512dma_rxinit_error
+
+	ldr temp, DMX32_DMA_RXBUFFER
+	cmp temp, #0
+	bne dmx32_dmx512dma_rxinit_uart
+
+	ldr temp2, DMX32_BUFFER_LENGTH
+	lsr temp2, temp2, #2                    @ Divide by 4
+	add temp2, temp2, #1                    @ Complement for Remainder
+
+	push {r0-r3}
+	mov r0, temp2
+	bl heap32_malloc
+	str r0, DMX32_DMA_RXFRONT
+	pop {r0-r3}
+
+	push {r0-r3}
+	mov r0, temp2
+	bl heap32_malloc
+	str r0, DMX32_DMA_RXBACK
+	pop {r0-r3}
+
+	ldr temp, DMX32_DMA_RXFRONT
+	cmp temp, #0
+	beq dmx32_dmx512dma_rxinit_error
+	ldr temp, DMX32_DMA_RXBACK
+	cmp temp, #0
+	beq dmx32_dmx512dma_rxinit_error
+
+	push {r0}
+	ldr r0, DMX32_BUFFER_LENGTH
+	bl heap32_malloc_noncache               @ One Word per One Slot
+	mov temp, r0
+	pop {r0}
+
+	cmp temp, #0
+	beq dmx32_dmx512dma_rxinit_error
+
+	str temp, DMX32_DMA_RXBUFFER
+
+	dmx32_dmx512dma_rxinit_uart:
+		mov temp, #0
+		str temp, dmx32_dmx512dma_rxbusy
+		str temp, DMX32_DMA_RXCOUNT
+		str temp, DMX32_DMA_RXERROR
+		str temp, DMX32_DMA_RXSLOTS
+		str temp, DMX32_DMA_RXTIME
+
+		push {r0-r3}
+		mov r0, #equ32_dma32_channel_dmx32_rx
+		bl dma32_clear_channel
+		pop {r0-r3}
+
+		mov temp2, #equ32_peripherals_base
+		add temp2, temp2, #equ32_uart0_base_upper
+		add temp2, temp2, #equ32_uart0_base_lower
+
+		ldr temp, [temp2, #equ32_uart0_dmacr]
+		bic temp, temp, #equ32_uart0_dmacr_rxdmae
+		str temp, [temp2, #equ32_uart0_dmacr]
+
+		mov temp, #0x700
+		orr temp, temp, #0xFF
+		str temp, [temp2, #equ32_uart0_icr]     @ Clear All Interrupts
+		mov temp, #equ32_uart0_intr_be
+		str temp, [temp2, #equ32_uart0_imsc]    @ Mask All Except Break Error
+
+		macro32_dsb ip
+
+		mov temp, #1<<25                        @ UART IRQ #57
+		mov temp2, #equ32_peripherals_base
+		add temp2, temp2, #equ32_interrupt_base
+		cmp flag_irq, #0
+		strne temp, [temp2, #equ32_interrupt_enable_irqs2]
+		streq temp, [temp2, #equ32_interrupt_disable_irqs2]
+
+		b dmx32_dmx512dma_rxinit_success
+
+	dmx32_dmx512dma_rxinit_error:
+		mov r0, #1
+		b dmx32_dmx512dma_rxinit_common
+
+	dmx32_dmx512dma_rxinit_success:
+		mov r0, #0
+
+	dmx32_dmx512dma_rxinit_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq flag_irq
+.unreq temp
+.unreq temp2
+
+
+/**
+ * function dmx32_dmx512dma_rx
+ * DMX512 Double Buffer Receiver by DMA
+ * Call this function on the UART IRQ, or repeatedly for polling. Nothing is done until the break error of UART.
+ * On the break, DMA of the last packet is stopped, and received slots are packed to DMX32_DMA_RXFRONT, then RXFRONT/RXBACK is flipped.
+ * So, DMX32_DMA_RXBACK holds the last packet. After that, DMA for the next packet is started from RxFIFO of UART.
+ * The last packet is completed by the next break because DMX512 allows a packet which is shorter than DMX32_BUFFER_LENGTH.
+ * Slots after the last received slot in DMX32_DMA_RXBACK are not updated, check DMX32_DMA_RXSLOTS.
+ * A packet with the overrun, parity, or framing error is discarded without flipping.
+ * DMX32_DMA_RXTIME accumulates micro seconds in this function on each break, i.e., CPU load is its increase divided by elapsed time.
+ * To measure packets per second and CPU load without any other device, set loopback by uart32_uartsettest (Tx On, Rx On, Loopback On),
+ * and send packets by dmx32_dmx512dma_tx, which uses another DMA channel and another pair of buffers.
+ * The loopback test is in os_debug of dmx512_rx_test (__LOOPBACK).
+ *
+ * Return: r0 (slots of the last packet including the start code, 0 as no packet, -1 as no break, -2 and -3 as error)
+ * Error(-2): Overrun, Parity Error, Framing Error on the Last Packet
+ * Error(-3): Not Initialized by dmx32_dmx512dma_rxinit
+ */
+.globl dmx32_dmx512dma_rx
+dmx32_dmx512dma_rx:
+	/* Auto (Local) Variables, but just Aliases */
+	result         .req r0
+	data_point     .req r1
+	num_data       .req r2
+	buffer_dma     .req r3
+	memorymap_base .req r4
+	temp           .req r5
+	temp2          .req r6
+	slots          .req r7
+	time_start     .req r8
+	flag_break     .req r9
+
+	push {r4-r9,lr}
+
+	ldr buffer_dma, DMX32_DMA_RXBUFFER
+	cmp buffer_dma, #0
+	beq dmx32_dmx512dma_rx_error
+
+	mov temp, #equ32_peripherals_base
+	add temp, temp, #equ32_systemtimer_base
+	ldr time_start, [temp, #equ32_systemtimer_counter_lower]
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_uart0_base_upper
+	add memorymap_base, memorymap_base, #equ32_uart0_base_lower
+
+	ldr temp, [memorymap_base, #equ32_uart0_ris]
+	tst temp, #equ32_uart0_intr_be
+	beq dmx32_dmx512dma_rx_nobreak
+
+	mov temp, #equ32_uart0_intr_be
+	str temp, [memorymap_base, #equ32_uart0_icr]
+
+	/* Stop Rx DMA on UART */
+	ldr temp, [memorymap_base, #equ32_uart0_dmacr]
+	bic temp, temp, #equ32_uart0_dmacr_rxdmae
+	str temp, [memorymap_base, #equ32_uart0_dmacr]
+
+	macro32_dsb ip
+
+	mov slots, #0
+	mov flag_break, #0
+	ldr num_data, DMX32_BUFFER_LENGTH
+
+	ldr temp, dmx32_dmx512dma_rxbusy
+	cmp temp, #0
+	beq dmx32_dmx512dma_rx_drain
+
+	/* Received Slots from Remaining Length of DMA, Zero If Completed */
+	mov temp2, #equ32_peripherals_base
+	add temp2, temp2, #equ32_dma_base
+	add temp2, temp2, #equ32_dma32_channel_dmx32_rx * equ32_dma_channel_offset
+	ldr temp, [temp2, #equ32_dma_cs]
+	tst temp, #equ32_dma_cs_active
+	moveq temp, #0
+	ldrne temp, [temp2, #equ32_dma_txfr_len]
+	sub slots, num_data, temp, lsr #2
+
+	push {r0-r3}
+	mov r0, #equ32_dma32_channel_dmx32_rx
+	bl dma32_clear_channel
+	pop {r0-r3}
+
+	mov temp, #0
+	str temp, dmx32_dmx512dma_rxbusy
+
+	/* Pack Words to Slots, the Break (Zero with Break Error) Ends the Packet */
+	ldr data_point, DMX32_DMA_RXFRONT
+	mov result, #0
+	mov temp, #0
+	dmx32_dmx512dma_rx_pack:
+		cmp temp, slots
+		bhs dmx32_dmx512dma_rx_pack_end
+		ldr temp2, [buffer_dma, temp, lsl #2]
+		tst temp2, #equ32_uart0_dr_be
+		bne dmx32_dmx512dma_rx_pack_break
+		orr result, result, temp2
+		strb temp2, [data_point, temp]
+		add temp, temp, #1
+		b dmx32_dmx512dma_rx_pack
+
+	dmx32_dmx512dma_rx_pack_break:
+		mov flag_break, #1
+
+	dmx32_dmx512dma_rx_pack_end:
+		mov slots, temp
+		tst result, #equ32_uart0_dr_oe|equ32_uart0_dr_pe|equ32_uart0_dr_fe
+		bne dmx32_dmx512dma_rx_packerror
+		cmp slots, #0
+		beq dmx32_dmx512dma_rx_drain
+
+		/* Flip Front/Back of Receiver */
+
+		ldr temp, DMX32_DMA_RXFRONT
+		ldr temp2, DMX32_DMA_RXBACK
+
+		str temp2, DMX32_DMA_RXFRONT
+		str temp, DMX32_DMA_RXBACK
+
+		str slots, DMX32_DMA_RXSLOTS
+		ldr temp, DMX32_DMA_RXCOUNT
+		add temp, temp, #1
+		str temp, DMX32_DMA_RXCOUNT
+
+		macro32_dsb ip
+
+		b dmx32_dmx512dma_rx_drain
+
+	dmx32_dmx512dma_rx_packerror:
+		ldr temp, DMX32_DMA_RXERROR
+		add temp, temp, #1
+		str temp, DMX32_DMA_RXERROR
+		mvn slots, #1                          @ -2
+
+	/* Discard Slots in RxFIFO until the Break If DMA Didn't Take the Break */
+	dmx32_dmx512dma_rx_drain:
+		cmp flag_break, #0
+		bne dmx32_dmx512dma_rx_start
+
+		dmx32_dmx512dma_rx_drain_loop:
+			ldr temp, [memorymap_base, #equ32_uart0_fr]
+			tst temp, #equ32_uart0_fr_rxfe
+			bne dmx32_dmx512dma_rx_start
+			ldr temp, [memorymap_base, #equ32_uart0_dr]
+			tst temp, #equ32_uart0_dr_be
+			beq dmx32_dmx512dma_rx_drain_loop
+
+	dmx32_dmx512dma_rx_start:
+		/* Enable Rx DMA on UART */
+		ldr temp, [memorymap_base, #equ32_uart0_dmacr]
+		orr temp, temp, #equ32_uart0_dmacr_rxdmae
+		str temp, [memorymap_base, #equ32_uart0_dmacr]
+
+		macro32_dsb ip
+
+		push {r0-r6}
+		lsl r4, num_data, #2                                    @ Transfer Size, One Word per One Slot
+		mov r5, #0                                              @ 2D Stride
+		mvn r6, #0                                              @ Next CB Number, -1 as Nothing
+		mov r0, #equ32_dma32_cb_dmx32_rx
+		mov r1, #equ32_dma_dreq_uart_rx<<equ32_dma_ti_permap  @ DREQ Map for UART Receive
+		orr r1, r1, #equ32_dma_ti_src_dreq                      @ Transfer Information Source
+		orr r1, r1, #equ32_dma_ti_dst_inc                       @ Transfer Information Destination
+		orr r1, r1, #equ32_dma_ti_wait_resp
+		mov r2, #equ32_bus_peripherals_base
+		add r2, r2, #equ32_uart0_base_upper
+		add r2, r2, #equ32_uart0_base_lower
+		add r2, r2, #equ32_uart0_dr                             @ Source Address
+		add r3, buffer_dma, #equ32_bus_coherence_base           @ Destination Address
+		push {r4-r6}
+		bl dma32_set_cb
+		add sp, sp, #12
+		pop {r0-r6}
+
+		push {r0-r3}
+		mov r0, #equ32_dma32_channel_dmx32_rx
+		mov r1, #equ32_dma32_cb_dmx32_rx
+		bl dma32_set_channel
+		pop {r0-r3}
+
+		mov temp, #1
+		str temp, dmx32_dmx512dma_rxbusy
+
+		/* Micro Seconds in This Function */
+		mov temp, #equ32_peripherals_base
+		add temp, temp, #equ32_systemtimer_base
+		ldr temp, [temp, #equ32_systemtimer_counter_lower]
+		sub temp, temp, time_start
+		ldr temp2, DMX32_DMA_RXTIME
+		add temp2, temp2, temp
+		str temp2, DMX32_DMA_RXTIME
+
+		macro32_dsb ip
+
+		b dmx32_dmx512dma_rx_success
+
+	dmx32_dmx512dma_rx_error:
+		mvn r0, #2                             @ -3
+		b dmx32_dmx512dma_rx_common
+
+	dmx32_dmx512dma_rx_nobreak:
+		mvn r0, #0                             @ -1
+		b dmx32_dmx512dma_rx_common
+
+	dmx32_dmx512dma_rx_success:
+		mov r0, slots
+
+	dmx32_dmx512dma_rx_common:
+		pop {r4-r9,pc}
+
+.unreq result
+.unreq data_point
+.unreq num_data
+.unreq buffer_dma
+.unreq memorymap_base
+.unreq temp
+.unreq temp2
+.unreq slots
+.unreq time_start
+.unreq flag_break
+
+.globl DMX32_DMA_RXBUFFER
+DMX32_DMA_RXBUFFER:         .word 0x00
+.globl DMX32_DMA_RXFRONT
+DMX32_DMA_RXFRONT:          .word 0x00 @ Packet in Progress of Receiver
+.globl DMX32_DMA_RXBACK
+DMX32_DMA_RXBACK:           .word 0x00 @ Last Packet of Receiver
+.globl DMX32_DMA_RXCOUNT
+DMX32_DMA_RXCOUNT:          .word 0x00 @ Number of Packets Received by DMA
+.globl DMX32_DMA_RXERROR
+DMX32_DMA_RXERROR:          .word 0x00 @ Number of Packets Discarded by Errors
+.globl DMX32_DMA_RXSLOTS
+DMX32_DMA_RXSLOTS:          .word 0x00 @ Slots of the Last Packet in DMX32_DMA_RXBACK
+.globl DMX32_DMA_RXTIME
+DMX32_DMA_RXTIME:           .word 0x00 @ Micro Seconds Spent in dmx32_dmx512dma_rx
+dmx32_dmx512dma_rxbusy:     .word 0x00
+
+
 /**
  * function dmx32_dmx512transmitter
  * DMX512 Transmitter
@@ -331,14 +331,16 @@ geo32_wire3d:
 	beq geo32_wire3d_error1
 
 	push {r0-r3}
-	mov r0, #4
+	mov r0, #8                    @ Vector and Result of Multiplication
 	bl heap32_malloc
 	mov vector_xyzw, r0
 	pop {r0-r3}
 
-	cmp heap_xy, #0
+	cmp vector_xyzw, #0
 	beq geo32_wire3d_error1
 
+	add result, vector_xyzw, #16  @ Result of Multiplication
+
 	/* W of Vector, Just 1.0 */
 	mov temp, #0x3F000000
 	orr temp, temp, #0x00800000   @ 1.0 in Hexadecimal of Single Precision Floating Point
@@ -370,13 +372,10 @@ geo32_wire3d:
 		mov r0, matrix
 		mov r1, vector_xyzw
 		mov r2, #4
-		bl mtx32_multiply_vec
-		mov result, r0
+		mov r3, result
+		bl mtx32_multiply_vec_into
 		pop {r0-r3}
 
-		cmp result, #0
-		beq geo32_wire3d_error1
-
 		/* Use X, Y, and W */
 		vldr vfp_x, [result]
 		vldr vfp_y, [result, #4]
@@ -397,11 +396,6 @@ geo32_wire3d:
 		sub i, i, #4
 		lsr i, i, #3                         @ Substitute of Division by 8
 
-		push {r0-r3}
-		mov r0, result
-		bl heap32_mfree
-		pop {r0-r3}
-
 		add i, i, #1
 		b geo32_wire3d_transfer
 
@@ -653,6 +647,332 @@ geo32_fill3d:
 .unreq i
 .unreq temp
 
+/**
+ * function geo32_shade3d
+ * Make Shaded Vertices for V3D (NV Shader State) from Triangles
+ * Transfers vertices with the matrix, divides X, Y, and Z by W, maps them to the viewport, and culls flip side triangles.
+ * Vertices are in structure of arrays; all X, all Y, all Z, all S, all T, and all Index of Images.
+ * Each shaded vertex is six words; X and Y (12.4 Fixed Point by Signed Half Word, Lower is X), Z, W (1.0), S, T, and Index.
+ * On ARMv7 and later, four vertices are processed at once by NEON, and the rest is processed by VFP.
+ * Caution! This Function Needs to Make VFP/NEON Registers and Instructions Enable
+ *
+ * Parameters
+ * r0: Pointer of Vertices; Arrays of X, Y, Z, S, T, and Index by Single Precision Float, Each Array Has Number of Vertices
+ * r1: Number of Vertices, Must Be Multiple of 3 (Triangles)
+ * r2: Pointer of 4 by 4 Matrix to Be Used for Transferring (Projection, View, and Model)
+ * r3: Pointer of Shaded Vertices to Be Written, Needs Number of Vertices by 6 Words (ARM Side of GPU Memory)
+ * r4: Width of Framebuffer in Pixels
+ * r5: Height of Framebuffer in Pixels
+ * r6: Front Rotation, Counter Clockwise(0), Clockwise(1), or Both(2) to Be Written
+ *
+ * Return: r0 (Number of Shaded Vertices Written)
+ */
+.globl geo32_shade3d
+geo32_shade3d:
+	/* Auto (Local) Variables, but just Aliases */
+	heap_vertices   .req r0
+	number_vertices .req r1
+	matrix          .req r2
+	heap_shaded     .req r3
+	width           .req r4
+	height          .req r5
+	rotation        .req r6
+	stride          .req r7
+	pointer_shaded  .req r8
+	value_s         .req r9
+	value_t         .req r10
+	value_index     .req r11
+	pointer_array   .req r12
+	count           .req lr
+
+	/* Aliases to Be Stored as Shaded Vertex */
+	value_xy        .req r2
+	value_z         .req r4
+	value_w         .req r5
+
+	/**
+	 * VFP Registers
+	 * s0-s2: X, Y, and Z of Vertex, Then Coordinates on Viewport
+	 * s4-s7: X, Y, Z, and W Transferred
+	 * s12: Half of Width by 16 (12.4 Fixed Point)
+	 * s13: Half of Height by 16 (12.4 Fixed Point)
+	 * s14: 0.5
+	 * s15: 1.0
+	 * s16-s31: Matrix, s16-s19 as Row 0, s20-s23 as Row 1, s24-s27 as Row 2, s28-s31 as Row 3
+	 * On NEON, q0-q2 as X, Y, and Z of Four Vertices, q3 as Constants (d6[0] Is s12, etc.),
+	 * q4-q7 as Matrix (d8[0] Is s16, etc.), q8-q11 as Transferred, q12 as Reciprocal of W, q13 as Temporary
+	 */
+
+	push {r4-r11,lr}
+
+	add sp, sp, #36
+	pop {width,height,rotation}
+	sub sp, sp, #48
+
+	vpush {s0-s15}
+	vpush {s16-s31}
+.ifndef __ARMV6
+.fpu neon
+	vpush {d16-d31}
+.fpu vfp
+.endif
+
+	lsl stride, number_vertices, #2          @ Substitute of Multiplication by 4, Bytes of Each Array
+
+	vldmia matrix, {s16-s31}
+
+	/* Constants, Multiplied by 8 (16 / 2) for 12.4 Fixed Point from -1.0 to 1.0 Coordinate */
+	vmov s12, width
+	vcvt.f32.u32 s12, s12
+	vmov s13, height
+	vcvt.f32.u32 s13, s13
+	mov value_s, #0x41000000                 @ 8.0 in Hexadecimal of Single Precision Floating Point
+	vmov s14, value_s
+	vmul.f32 s12, s12, s14
+	vmul.f32 s13, s13, s14
+	mov value_s, #0x3F000000                 @ 0.5
+	vmov s14, value_s
+	orr value_s, value_s, #0x00800000        @ 1.0
+	vmov s15, value_s
+
+	mov pointer_shaded, heap_shaded
+	mov count, number_vertices
+
+.ifndef __ARMV6
+.fpu neon
+
+	geo32_shade3d_batch:
+		cmp count, #4
+		blo geo32_shade3d_single
+
+		mov pointer_array, heap_vertices
+		vld1.32 {d0-d1}, [pointer_array], stride  @ X
+		vld1.32 {d2-d3}, [pointer_array], stride  @ Y
+		vld1.32 {d4-d5}, [pointer_array], stride  @ Z
+
+		/* Multiply Matrix by Vectors, W of Vectors Is 1.0 */
+		vdup.32 q8, d9[1]
+		vmla.f32 q8, q0, d8[0]
+		vmla.f32 q8, q1, d8[1]
+		vmla.f32 q8, q2, d9[0]
+		vdup.32 q9, d11[1]
+		vmla.f32 q9, q0, d10[0]
+		vmla.f32 q9, q1, d10[1]
+		vmla.f32 q9, q2, d11[0]
+		vdup.32 q10, d13[1]
+		vmla.f32 q10, q0, d12[0]
+		vmla.f32 q10, q1, d12[1]
+		vmla.f32 q10, q2, d13[0]
+		vdup.32 q11, d15[1]
+		vmla.f32 q11, q0, d14[0]
+		vmla.f32 q11, q1, d14[1]
+		vmla.f32 q11, q2, d15[0]
+
+		/* Reciprocal of W, Estimate and Two Steps of Newton-Raphson */
+		vrecpe.f32 q12, q11
+		vrecps.f32 q13, q11, q12
+		vmul.f32 q12, q12, q13
+		vrecps.f32 q13, q11, q12
+		vmul.f32 q12, q12, q13
+
+		/* -1.0 to 1.0 Coordinate to Pixels in 12.4 Fixed Point, Flip Y and Z Coordinate */
+		vmul.f32 q13, q8, q12
+		vdup.32 q0, d6[0]
+		vmla.f32 q0, q13, d6[0]
+		vmul.f32 q13, q9, q12
+		vdup.32 q1, d6[1]
+		vmls.f32 q1, q13, d6[1]
+		vmul.f32 q13, q10, q12
+		vdup.32 q2, d7[0]
+		vmls.f32 q2, q13, d7[0]
+
+		/* Pack X and Y to Signed Half Words with Saturation */
+		vcvt.s32.f32 q0, q0
+		vcvt.s32.f32 q1, q1
+		vqmovn.s32 d0, q0
+		vqmovn.s32 d1, q1
+		vzip.16 d0, d1
+
+		vld1.32 {d16-d17}, [pointer_array], stride @ S
+		vld1.32 {d18-d19}, [pointer_array], stride @ T
+		vld1.32 {d20-d21}, [pointer_array]         @ Index
+		vdup.32 q11, d7[1]                          @ W, 1.0
+
+		/* Make Pairs; XY and Z, W and S, T and Index */
+		vzip.32 q0, q2
+		vzip.32 q11, q8
+		vzip.32 q9, q10
+
+		vst1.32 {d0}, [pointer_shaded]!
+		vst1.32 {d22}, [pointer_shaded]!
+		vst1.32 {d18}, [pointer_shaded]!
+		vst1.32 {d1}, [pointer_shaded]!
+		vst1.32 {d23}, [pointer_shaded]!
+		vst1.32 {d19}, [pointer_shaded]!
+		vst1.32 {d4}, [pointer_shaded]!
+		vst1.32 {d16}, [pointer_shaded]!
+		vst1.32 {d20}, [pointer_shaded]!
+		vst1.32 {d5}, [pointer_shaded]!
+		vst1.32 {d17}, [pointer_shaded]!
+		vst1.32 {d21}, [pointer_shaded]!
+
+		add heap_vertices, heap_vertices, #16
+		sub count, count, #4
+		b geo32_shade3d_batch
+
+.fpu vfp
+.endif
+
+	geo32_shade3d_single:
+		cmp count, #0
+		beq geo32_shade3d_cull
+
+		mov pointer_array, heap_vertices
+		vldr s0, [pointer_array]
+		add pointer_array, pointer_array, stride
+		vldr s1, [pointer_array]
+		add pointer_array, pointer_array, stride
+		vldr s2, [pointer_array]
+
+		/* Multiply Matrix by Vector, W of Vector Is 1.0 */
+		vmov.f32 s4, s19
+		vmla.f32 s4, s16, s0
+		vmla.f32 s4, s17, s1
+		vmla.f32 s4, s18, s2
+		vmov.f32 s5, s23
+		vmla.f32 s5, s20, s0
+		vmla.f32 s5, s21, s1
+		vmla.f32 s5, s22, s2
+		vmov.f32 s6, s27
+		vmla.f32 s6, s24, s0
+		vmla.f32 s6, s25, s1
+		vmla.f32 s6, s26, s2
+		vmov.f32 s7, s31
+		vmla.f32 s7, s28, s0
+		vmla.f32 s7, s29, s1
+		vmla.f32 s7, s30, s2
+
+		/* Divide X, Y, and Z by W (Weight) to Normalize */
+		vdiv.f32 s7, s15, s7
+		vmul.f32 s4, s4, s7
+		vmul.f32 s5, s5, s7
+		vmul.f32 s6, s6, s7
+
+		/* -1.0 to 1.0 Coordinate to Pixels in 12.4 Fixed Point, Flip Y and Z Coordinate */
+		vmov.f32 s0, s12
+		vmla.f32 s0, s4, s12
+		vmov.f32 s1, s13
+		vmls.f32 s1, s5, s13
+		vmov.f32 s2, s14
+		vmls.f32 s2, s6, s14
+		vcvt.s32.f32 s0, s0
+		vcvt.s32.f32 s1, s1
+
+		/* Pack X and Y to Signed Half Words with Saturation */
+		vmov value_xy, s0
+		vmov value_z, s1
+		ssat value_xy, #16, value_xy
+		ssat value_z, #16, value_z
+		pkhbt value_xy, value_xy, value_z, lsl #16
+
+		vmov value_z, s2
+		vmov value_w, s15
+		ldr value_s, [pointer_array, stride]!
+		ldr value_t, [pointer_array, stride]!
+		ldr value_index, [pointer_array, stride]
+		stmia pointer_shaded!, {value_xy,value_z,value_w,value_s-value_index}
+
+		add heap_vertices, heap_vertices, #4
+		sub count, count, #1
+		b geo32_shade3d_single
+
+	geo32_shade3d_cull:
+		cmp rotation, #2
+		moveq r0, number_vertices
+		beq geo32_shade3d_common
+
+		/* Reuse Registers; heap_vertices as Pointer to Read, pointer_shaded as Pointer to Write, stride as Number Written */
+		mov heap_vertices, heap_shaded
+		mov pointer_shaded, heap_shaded
+		mov count, number_vertices
+		mov stride, #0
+
+		geo32_shade3d_cull_loop:
+			cmp count, #3
+			blo geo32_shade3d_success
+			sub count, count, #3
+
+			/* Signed Area by Cross Product of Two Edges on Viewport (Y Is Downward) */
+			ldr value_xy, [heap_vertices]
+			ldr value_z, [heap_vertices, #24]
+			ldr value_w, [heap_vertices, #48]
+			ssub16 value_z, value_z, value_xy      @ X1 - X0 (Lower) and Y1 - Y0 (Upper)
+			ssub16 value_w, value_w, value_xy      @ X2 - X0 (Lower) and Y2 - Y0 (Upper)
+			smulbt value_s, value_z, value_w       @ (X1 - X0) * (Y2 - Y0)
+			smultb value_t, value_z, value_w       @ (Y1 - Y0) * (X2 - X0)
+
+			/* If Area is Zero */
+			cmp value_s, value_t
+			beq geo32_shade3d_cull_loop_flip
+
+			movlt value_s, #0                      @ Counter Clockwise
+			movgt value_s, #1                      @ Clockwise
+
+			/* If Flip */
+			cmp value_s, rotation
+			bne geo32_shade3d_cull_loop_flip
+
+			/* If Front, Compact Shaded Vertices */
+			add stride, stride, #3
+			cmp heap_vertices, pointer_shaded
+			addeq heap_vertices, heap_vertices, #72
+			addeq pointer_shaded, pointer_shaded, #72
+			beq geo32_shade3d_cull_loop
+
+			ldmia heap_vertices!, {value_xy,value_z,value_w,value_s-value_index}
+			stmia pointer_shaded!, {value_xy,value_z,value_w,value_s-value_index}
+			ldmia heap_vertices!, {value_xy,value_z,value_w,value_s-value_index}
+			stmia pointer_shaded!, {value_xy,value_z,value_w,value_s-value_index}
+			ldmia heap_vertices!, {value_xy,value_z,value_w,value_s-value_index}
+			stmia pointer_shaded!, {value_xy,value_z,value_w,value_s-value_index}
+			b geo32_shade3d_cull_loop
+
+			geo32_shade3d_cull_loop_flip:
+				add heap_vertices, heap_vertices, #72
+				b geo32_shade3d_cull_loop
+
+	geo32_shade3d_success:
+		mov r0, stride
+
+	geo32_shade3d_common:
+.ifndef __ARMV6
+.fpu neon
+		vpop {d16-d31}
+.fpu vfp
+.endif
+		vpop {s16-s31}
+		vpop {s0-s15}
+		pop {r4-r11,pc}
+
+.unreq heap_vertices
+.unreq number_vertices
+.unreq matrix
+.unreq heap_shaded
+.unreq width
+.unreq height
+.unreq rotation
+.unreq stride
+.unreq pointer_shaded
+.unreq value_s
+.unreq value_t
+.unreq value_index
+.unreq pointer_array
+.unreq count
+.unreq value_xy
+.unreq value_z
+.unreq value_w
+
+
 geo32_FB32:        .word FB32_ADDR
 geo32_FB32_WIDTH:  .word FB32_WIDTH
 geo32_FB32_HEIGHT: .word FB32_HEIGHT
@@ -34,6 +34,19 @@
   *   GPIO pins to be used are needed to be set as output.
   */
 
+/**
+ * Usage of Asynchronous Functions
+ * Functions above lcd32_lcdchargenerator wait for the LCD controller with arm32_sleep, i.e., block the caller.
+ * Asynchronous functions write characters to the shadow of DDRAM/CGRAM, and lcd32_lcdupdate queues only changed cells.
+ * lcd32_lcdtick, called on each tick of a timer (e.g., FIQ or timer32), clocks out one step of the command queue.
+ * 1. Initialize the LCD with lcd32_lcdinit and other functions as usual, then call lcd32_lcdasyncinit with the period of the tick.
+ * 2. Call lcd32_lcdtick on each tick. The period of the tick needs to be 1 microseconds and more.
+ * 3. Write characters with lcd32_lcdshadow and lcd32_lcdshadowcg, then call lcd32_lcdupdate.
+ * Note:
+ *   Don't use blocking functions after lcd32_lcdasyncinit. Use lcd32_lcdqueue instead.
+ *   The shadow assumes the entry mode of increment without display shift, and all spaces in DDRAM after lcd32_lcdinit.
+ */
+
 /**
  * function lcd32_lcdput4
  * Put Instruction or Data in 4-bit Operation
@@ -594,3 +607,572 @@ lcd32_lcdchargenerator:
 
 .unreq addr_cgram
 
+
+
+/**
+ * function lcd32_lcdasyncinit
+ * Initialization for Asynchronous Functions
+ * Command queue is emptied. Shadow of DDRAM becomes spaces, and shadow of CGRAM becomes unused.
+ * Call this function when lcd32_lcdtick is not running, e.g., before the timer is started.
+ *
+ * Parameters
+ * r0: Period of Tick in Microseconds to Call lcd32_lcdtick
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Period Is Zero
+ */
+.globl lcd32_lcdasyncinit
+lcd32_lcdasyncinit:
+	/* Auto (Local) Variables, but just Aliases */
+	tick     .req r0
+	shadow   .req r1
+	value    .req r2
+	i        .req r3
+	tick_dup .req r4
+
+	push {r4,lr}
+
+	cmp tick, #0
+	beq lcd32_lcdasyncinit_error
+
+	mov tick_dup, tick
+
+	/* Ticks to Wait for Execution, Rounded Up */
+
+	add r0, tick_dup, #equ32_lcd32_time_execution1
+	sub r0, r0, #1
+	mov r1, tick_dup
+	bl arm32_udiv
+	str r0, lcd32_async_wait1
+
+	add r0, tick_dup, #equ32_lcd32_time_execution2
+	sub r0, r0, #1
+	mov r1, tick_dup
+	bl arm32_udiv
+	str r0, lcd32_async_wait2
+
+	mov value, #0
+	str value, lcd32_async_head
+	str value, lcd32_async_tail
+	str value, lcd32_async_phase
+	str value, lcd32_async_wait
+	str value, lcd32_async_current
+	mov value, #0x80                          @ Address Counter Is Unknown
+	str value, lcd32_async_address
+
+	/* Shadow and Sent Image of DDRAM (Spaces), Then CGRAM (Unused) */
+
+	ldr shadow, LCD32_SHADOW_DDRAM
+	mov value, #0x20
+	orr value, value, value, lsl #8
+	orr value, value, value, lsl #16
+	mov i, #0
+
+	lcd32_lcdasyncinit_loop:
+		cmp i, #256
+		mvneq value, #0
+		cmp i, #384
+		bhs lcd32_lcdasyncinit_success
+		str value, [shadow, i]
+		add i, i, #4
+		b lcd32_lcdasyncinit_loop
+
+	lcd32_lcdasyncinit_error:
+		mov r0, #1
+		b lcd32_lcdasyncinit_common
+
+	lcd32_lcdasyncinit_success:
+		macro32_dsb ip
+		mov r0, #0
+
+	lcd32_lcdasyncinit_common:
+		pop {r4,pc}
+
+.unreq tick
+.unreq shadow
+.unreq value
+.unreq i
+.unreq tick_dup
+
+
+/**
+ * function lcd32_lcdqueue
+ * Queue Instruction or Data to Be Clocked Out by lcd32_lcdtick
+ * The address counter of DDRAM is predicted to omit setting the address by lcd32_lcdupdate.
+ *
+ * Parameters
+ * r0: Character to Be Set
+ * r1: 0 as Instruction, 1 as Data
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Command Queue Is Full
+ */
+.globl lcd32_lcdqueue
+lcd32_lcdqueue:
+	/* Auto (Local) Variables, but just Aliases */
+	character .req r0
+	flag_data .req r1
+	queue     .req r2
+	tail      .req r3
+	temp      .req r4
+	address   .req r5
+
+	push {r4-r5,lr}
+
+	and character, character, #0xFF
+
+	ldr tail, lcd32_async_tail
+	ldr temp, lcd32_async_head
+	add tail, tail, #1
+	and tail, tail, #equ32_lcd32_queue_size - 1
+	cmp tail, temp
+	beq lcd32_lcdqueue_error
+
+	ldr address, lcd32_async_address
+
+	cmp flag_data, #0
+	beq lcd32_lcdqueue_instruction
+
+	/* Data Increments Address Counter, Unknown Beyond End of Line */
+	orr character, character, #equ32_lcd32_queue_data
+	cmp address, #0x80
+	addlo address, address, #1
+	and temp, address, #0x3F
+	cmp temp, #0x28
+	movhs address, #0x80
+	b lcd32_lcdqueue_store
+
+	lcd32_lcdqueue_instruction:
+		/* Set DDRAM Address */
+		tst character, #0x80
+		andne address, character, #0x7F
+		bne lcd32_lcdqueue_store
+
+		/* Clear Display, All in DDRAM Become Spaces */
+		cmp character, #0x01
+		beq lcd32_lcdqueue_clear
+
+		/* Return Home, Otherwise Unknown (e.g., CGRAM Address, Cursor Shift) */
+		bic temp, character, #0x01
+		cmp temp, #0x02
+		moveq address, #0
+		movne address, #0x80
+		b lcd32_lcdqueue_store
+
+	lcd32_lcdqueue_clear:
+		mov address, #0
+		ldr queue, LCD32_SENT_DDRAM
+		mov temp, #0x20
+		orr temp, temp, temp, lsl #8
+		orr temp, temp, temp, lsl #16
+		mov flag_data, #0
+
+		lcd32_lcdqueue_clear_loop:
+			str temp, [queue, flag_data]
+			add flag_data, flag_data, #4
+			cmp flag_data, #128
+			blo lcd32_lcdqueue_clear_loop
+
+	lcd32_lcdqueue_store:
+		str address, lcd32_async_address
+		ldr queue, LCD32_ASYNC_QUEUE
+		ldr temp, lcd32_async_tail
+		str character, [queue, temp, lsl #2]
+		macro32_dsb ip
+		str tail, lcd32_async_tail
+		macro32_dsb ip
+		b lcd32_lcdqueue_success
+
+	lcd32_lcdqueue_error:
+		mov r0, #1
+		b lcd32_lcdqueue_common
+
+	lcd32_lcdqueue_success:
+		mov r0, #0
+
+	lcd32_lcdqueue_common:
+		pop {r4-r5,pc}
+
+.unreq character
+.unreq flag_data
+.unreq queue
+.unreq tail
+.unreq temp
+.unreq address
+
+
+/**
+ * function lcd32_lcdshadow
+ * Write String to Shadow of DDRAM, Characters Beyond Address 0x7F Are Ignored
+ *
+ * Parameters
+ * r0: Display Position, i.e., Address for Data Display RAM
+ * r1: Pointer of Array of String
+ * r2: Length of Array of String (Bytes)
+ *
+ * Return: r0 (0 as success)
+ */
+.globl lcd32_lcdshadow
+lcd32_lcdshadow:
+	/* Auto (Local) Variables, but just Aliases */
+	position      .req r0
+	string_point  .req r1
+	string_length .req r2
+	shadow        .req r3
+	byte          .req r4
+
+	push {r4,lr}
+
+	and position, position, #0x7F
+	ldr shadow, LCD32_SHADOW_DDRAM
+
+	lcd32_lcdshadow_loop:
+		cmp string_length, #0
+		beq lcd32_lcdshadow_common
+		cmp position, #0x80
+		bhs lcd32_lcdshadow_common
+
+		ldrb byte, [string_point], #1
+		strb byte, [shadow, position]
+
+		add position, position, #1
+		sub string_length, string_length, #1
+		b lcd32_lcdshadow_loop
+
+	lcd32_lcdshadow_common:
+		mov r0, #0
+		pop {r4,pc}
+
+.unreq position
+.unreq string_point
+.unreq string_length
+.unreq shadow
+.unreq byte
+
+
+/**
+ * function lcd32_lcdshadowcg
+ * Write Rows of Characters to Shadow of CGRAM, Rows Beyond Address 0x3F Are Ignored
+ *
+ * Parameters
+ * r0: Address for Character Generator RAM
+ * r1: Pointer of Array of Rows, Bit[4:0] of Each Byte Is Used
+ * r2: Length of Array of Rows (Bytes)
+ *
+ * Return: r0 (0 as success)
+ */
+.globl lcd32_lcdshadowcg
+lcd32_lcdshadowcg:
+	/* Auto (Local) Variables, but just Aliases */
+	addr_cgram  .req r0
+	row_point   .req r1
+	row_length  .req r2
+	shadow      .req r3
+	byte        .req r4
+
+	push {r4,lr}
+
+	and addr_cgram, addr_cgram, #0x3F
+	ldr shadow, LCD32_SHADOW_CGRAM
+
+	lcd32_lcdshadowcg_loop:
+		cmp row_length, #0
+		beq lcd32_lcdshadowcg_common
+		cmp addr_cgram, #0x40
+		bhs lcd32_lcdshadowcg_common
+
+		ldrb byte, [row_point], #1
+		and byte, byte, #0x1F
+		strb byte, [shadow, addr_cgram]
+
+		add addr_cgram, addr_cgram, #1
+		sub row_length, row_length, #1
+		b lcd32_lcdshadowcg_loop
+
+	lcd32_lcdshadowcg_common:
+		mov r0, #0
+		pop {r4,pc}
+
+.unreq addr_cgram
+.unreq row_point
+.unreq row_length
+.unreq shadow
+.unreq byte
+
+
+/**
+ * function lcd32_lcdupdate
+ * Queue Changed Cells of Shadow of CGRAM, Then DDRAM
+ * Setting address is omitted if the address counter is predicted to point the cell.
+ * If the command queue becomes full, the rest of cells are left to the next call.
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error: Command Queue Is Full, Call Again Later
+ */
+.globl lcd32_lcdupdate
+lcd32_lcdupdate:
+	/* Auto (Local) Variables, but just Aliases */
+	shadow     .req r4
+	sent       .req r5
+	i          .req r6
+	value      .req r7
+	value_sent .req r8
+	next       .req r9
+	length     .req r10
+
+	push {r4-r10,lr}
+
+	ldr shadow, LCD32_SHADOW_CGRAM
+	ldr sent, LCD32_SENT_CGRAM
+	mov length, #0x40
+	mov i, #0
+	mvn next, #0
+
+	lcd32_lcdupdate_loop:
+		cmp i, length
+		bhs lcd32_lcdupdate_loop_common
+
+		/* Skip Four Cells If Unchanged */
+		tst i, #0b11
+		bne lcd32_lcdupdate_loop_byte
+		ldr value, [shadow, i]
+		ldr value_sent, [sent, i]
+		cmp value, value_sent
+		addeq i, i, #4
+		beq lcd32_lcdupdate_loop
+
+		lcd32_lcdupdate_loop_byte:
+			ldrb value, [shadow, i]
+			ldrb value_sent, [sent, i]
+			cmp value, value_sent
+			beq lcd32_lcdupdate_loop_next
+
+			/* Address of DDRAM Is Predicted by lcd32_lcdqueue */
+			cmp length, #0x80
+			ldreq next, lcd32_async_address
+
+			bl lcd32_async_space
+			cmp i, next
+			movne r1, #2
+			moveq r1, #1
+			cmp r0, r1
+			blo lcd32_lcdupdate_error
+
+			cmp i, next
+			beq lcd32_lcdupdate_loop_data
+
+			cmp length, #0x80
+			orreq r0, i, #0x80                  @ Set DDRAM Address
+			orrne r0, i, #0x40                  @ Set CGRAM Address
+			mov r1, #0
+			bl lcd32_lcdqueue
+
+		lcd32_lcdupdate_loop_data:
+			mov r0, value
+			mov r1, #1
+			bl lcd32_lcdqueue
+			strb value, [sent, i]
+			add next, i, #1
+
+		lcd32_lcdupdate_loop_next:
+			add i, i, #1
+			b lcd32_lcdupdate_loop
+
+		lcd32_lcdupdate_loop_common:
+			cmp length, #0x80
+			beq lcd32_lcdupdate_success
+
+			ldr shadow, LCD32_SHADOW_DDRAM
+			ldr sent, LCD32_SENT_DDRAM
+			mov length, #0x80
+			mov i, #0
+			b lcd32_lcdupdate_loop
+
+	lcd32_lcdupdate_error:
+		mov r0, #1
+		b lcd32_lcdupdate_common
+
+	lcd32_lcdupdate_success:
+		mov r0, #0
+
+	lcd32_lcdupdate_common:
+		pop {r4-r10,pc}
+
+.unreq shadow
+.unreq sent
+.unreq i
+.unreq value
+.unreq value_sent
+.unreq next
+.unreq length
+
+
+/**
+ * function lcd32_lcdtick
+ * Clock Out One Step of Command Queue, Intended to Be Called on Each Tick of Timer, e.g., in FIQ
+ * One entry takes five ticks for two nibbles, then ticks to wait for execution.
+ * r0 and r1 are ignored to be used as a function of timer32_add.
+ *
+ * Return: r0 (0 as idle, 1 as busy)
+ */
+.globl lcd32_lcdtick
+lcd32_lcdtick:
+	/* Auto (Local) Variables, but just Aliases */
+	memorymap_base .req r0
+	offset         .req r1
+	current        .req r2
+	temp           .req r3
+	phase          .req r4
+
+	push {r4,lr}
+
+	ldr temp, lcd32_async_wait
+	cmp temp, #0
+	subne temp, temp, #1
+	strne temp, lcd32_async_wait
+	bne lcd32_lcdtick_busy
+
+	mov memorymap_base, #equ32_peripherals_base
+	add memorymap_base, memorymap_base, #equ32_gpio_base
+	ldr offset, lcd32_offset
+	ldr current, lcd32_async_current
+	ldr phase, lcd32_async_phase
+
+	cmp phase, #1
+	beq lcd32_lcdtick_phase1
+	cmp phase, #2
+	beq lcd32_lcdtick_phase2
+	cmp phase, #3
+	beq lcd32_lcdtick_phase3
+	cmp phase, #4
+	beq lcd32_lcdtick_phase4
+
+	/* Phase 0: Take Next Entry */
+	ldr temp, lcd32_async_head
+	ldr phase, lcd32_async_tail
+	cmp temp, phase
+	beq lcd32_lcdtick_idle
+
+	ldr phase, LCD32_ASYNC_QUEUE
+	ldr current, [phase, temp, lsl #2]
+	str current, lcd32_async_current
+	add temp, temp, #1
+	and temp, temp, #equ32_lcd32_queue_size - 1
+	str temp, lcd32_async_head
+
+	/* Clear RS, EN, and DB7 - DB4, Then Set RS as Data If Flag Is Set */
+	mov temp, #0b111111
+	lsl temp, temp, offset
+	str temp, [memorymap_base, #equ32_gpio_gpclr0]
+	macro32_dsb ip
+	tst current, #equ32_lcd32_queue_data
+	movne temp, #0b100000
+	lslne temp, temp, offset
+	strne temp, [memorymap_base, #equ32_gpio_gpset0]
+
+	mov phase, #1
+	b lcd32_lcdtick_next
+
+	lcd32_lcdtick_phase1:
+		/* Set EN and DB7 - DB4 for MSBs */
+		lsr temp, current, #4
+		and temp, temp, #0b1111
+		orr temp, temp, #0b010000
+		lsl temp, temp, offset
+		str temp, [memorymap_base, #equ32_gpio_gpset0]
+		mov phase, #2
+		b lcd32_lcdtick_next
+
+	lcd32_lcdtick_phase2:
+		/* Clear EN */
+		mov temp, #0b010000
+		lsl temp, temp, offset
+		str temp, [memorymap_base, #equ32_gpio_gpclr0]
+		mov phase, #3
+		b lcd32_lcdtick_next
+
+	lcd32_lcdtick_phase3:
+		/* Clear DB7 - DB4 for MSBs, Then Set EN and DB7 - DB4 for LSBs */
+		mov temp, #0b001111
+		lsl temp, temp, offset
+		str temp, [memorymap_base, #equ32_gpio_gpclr0]
+		macro32_dsb ip
+		and temp, current, #0b1111
+		orr temp, temp, #0b010000
+		lsl temp, temp, offset
+		str temp, [memorymap_base, #equ32_gpio_gpset0]
+		mov phase, #4
+		b lcd32_lcdtick_next
+
+	lcd32_lcdtick_phase4:
+		/* Clear EN, Then Wait for Execution, Longer on Clear Display and Return Home */
+		mov temp, #0b010000
+		lsl temp, temp, offset
+		str temp, [memorymap_base, #equ32_gpio_gpclr0]
+
+		ldr temp, lcd32_async_wait1
+		tst current, #equ32_lcd32_queue_data
+		bne lcd32_lcdtick_phase4_wait
+		and phase, current, #0xFF
+		cmp phase, #0x04
+		ldrlo temp, lcd32_async_wait2
+
+		lcd32_lcdtick_phase4_wait:
+			str temp, lcd32_async_wait
+			mov phase, #0
+
+	lcd32_lcdtick_next:
+		str phase, lcd32_async_phase
+		macro32_dsb ip
+
+	lcd32_lcdtick_busy:
+		mov r0, #1
+		b lcd32_lcdtick_common
+
+	lcd32_lcdtick_idle:
+		mov r0, #0
+
+	lcd32_lcdtick_common:
+		pop {r4,pc}
+
+.unreq memorymap_base
+.unreq offset
+.unreq current
+.unreq temp
+.unreq phase
+
+
+/**
+ * Free Entries of Command Queue
+ *
+ * Return: r0 (Number of Free Entries)
+ */
+lcd32_async_space:
+	ldr r0, lcd32_async_head
+	ldr r1, lcd32_async_tail
+	sub r0, r0, r1
+	sub r0, r0, #1
+	and r0, r0, #equ32_lcd32_queue_size - 1
+	mov pc, lr
+
+lcd32_async_head:    .word 0x00 @ Index to Be Taken by lcd32_lcdtick
+lcd32_async_tail:    .word 0x00 @ Index to Be Put by lcd32_lcdqueue
+lcd32_async_phase:   .word 0x00 @ Step of Current Entry
+lcd32_async_wait:    .word 0x00 @ Remaining Ticks for Execution
+lcd32_async_current: .word 0x00 @ Current Entry
+lcd32_async_address: .word 0x80 @ Predicted Address Counter of DDRAM, 0x80 as Unknown
+lcd32_async_wait1:   .word 0x00 @ Ticks for equ32_lcd32_time_execution1
+lcd32_async_wait2:   .word 0x00 @ Ticks for equ32_lcd32_time_execution2
+LCD32_ASYNC_QUEUE:   .word lcd32_async_queue
+LCD32_SHADOW_DDRAM:  .word lcd32_shadow_ddram
+LCD32_SENT_DDRAM:    .word lcd32_sent_ddram
+LCD32_SHADOW_CGRAM:  .word lcd32_shadow_cgram
+LCD32_SENT_CGRAM:    .word lcd32_sent_cgram
+.section	.data
+.balign 4
+lcd32_async_queue:   .space 4 * equ32_lcd32_queue_size, 0x00
+lcd32_shadow_ddram:  .space 128, 0x20 @ Shadow and Sent Image Are Sequential, See lcd32_lcdasyncinit
+lcd32_sent_ddram:    .space 128, 0x20
+lcd32_shadow_cgram:  .space 64, 0xFF  @ 0xFF as Unused
+lcd32_sent_cgram:    .space 64, 0xFF
+.section	.library_system32
@@ -27,9 +27,58 @@ mtx32_multiply:
 	matrix1     .req r0
 	matrix2     .req r1
 	number_mat  .req r2
-	temp        .req r3
-	temp2       .req r4
-	matrix_ret  .req r5
+	matrix_ret  .req r3
+
+	push {lr}
+
+	mul matrix_ret, number_mat, number_mat
+
+	push {r0-r2}
+	mov r0, matrix_ret
+	bl heap32_malloc
+	mov matrix_ret, r0
+	pop {r0-r2}
+
+	cmp matrix_ret, #0
+	beq mtx32_multiply_common
+
+	push {r3}
+	bl mtx32_multiply_into
+	pop {r3}
+
+	mtx32_multiply_common:
+		mov r0, matrix_ret
+		pop {pc}
+
+.unreq matrix1
+.unreq matrix2
+.unreq number_mat
+.unreq matrix_ret
+
+
+/**
+ * function mtx32_multiply_into
+ * Multiplies Two Matrix with Single Precision Float into Memory Space of Caller
+ * 4 by 4 and 3 by 3 are calculated by unrolled functions, mtx32_multiply4_into and mtx32_multiply3_into.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Matrix1 with Single Precision Float
+ * r1: Matrix2 with Single Precision Float
+ * r2: Number of Rows and Columns
+ * r3: Matrix to Be Calculated, Must Not Be Same as Matrix1 and Matrix2 Except 4 by 4 and 3 by 3
+ *
+ * Return: r0 (Matrix to Be Calculated)
+ */
+.globl mtx32_multiply_into
+mtx32_multiply_into:
+	/* Auto (Local) Variables, but just Aliases */
+	matrix1     .req r0
+	matrix2     .req r1
+	number_mat  .req r2
+	matrix_ret  .req r3
+	temp        .req r4
+	temp2       .req r5
 	index       .req r6
 	column      .req r7
 	row         .req r8
@@ -41,48 +90,43 @@ mtx32_multiply:
 	vfp_value2  .req s1
 	vfp_sum     .req s2
 
+	cmp number_mat, #4
+	moveq number_mat, matrix_ret
+	beq mtx32_multiply4_into
+	cmp number_mat, #3
+	moveq number_mat, matrix_ret
+	beq mtx32_multiply3_into
+
 	push {r4-r9,lr}
 	vpush {s0-s2}
 
-	mul temp, number_mat, number_mat
-
-	push {r0-r3}
-	mov r0, temp
-	bl heap32_malloc
-	mov matrix_ret, r0
-	pop {r0-r3}
-
-	cmp matrix_ret, #0
-	beq mtx32_multiply_common
-
 	mov index, #0
 
 	/* for ( uint32 row = 0; row < number_mat; row++ ) { */
 	mov row, #0
-	mtx32_multiply_row:
+	mtx32_multiply_into_row:
 		cmp row, number_mat
-		bhs mtx32_multiply_common
+		bhs mtx32_multiply_into_common
 
 		/* for ( uint32 column = 0; column < number_mat; column++ ) { */
 		mov column, #0
-		mtx32_multiply_row_column:
+		mtx32_multiply_into_row_column:
 			cmp column, number_mat
-			bhs mtx32_multiply_row_column_common
+			bhs mtx32_multiply_into_row_column_common
 
 			mov temp, #0
 			vmov vfp_sum, temp
-			/*vcvt.f32.s32 vfp_sum, vfp_sum*/
 
 			/* for ( uint32 i = 0; i < number_mat; i++ ) { */
 			mov i, #0
-			mtx32_multiply_row_column_i:
+			mtx32_multiply_into_row_column_i:
 				cmp i, number_mat
-				bhs mtx32_multiply_row_column_i_common
+				bhs mtx32_multiply_into_row_column_i_common
 
 				mul temp, row, number_mat
 				add temp, temp, i
 				ldr temp, [matrix1, temp, lsl #2]           @ Substitution of Multiplication by 4
-				
+
 				mul temp2, i, number_mat
 				add temp2, temp2, column
 				ldr temp2, [matrix2, temp2, lsl #2]         @ Substitution of Multiplication by 4
@@ -91,25 +135,25 @@ mtx32_multiply:
 				vmla.f32 vfp_sum, vfp_value1, vfp_value2    @ Multiply and Accumulate
 
 				add i, i, #1
-				b mtx32_multiply_row_column_i
-	
+				b mtx32_multiply_into_row_column_i
+
 			/* } */
-				mtx32_multiply_row_column_i_common:
+				mtx32_multiply_into_row_column_i_common:
 					vmov temp, vfp_sum
 					str temp, [matrix_ret, index]
 					add index, index, #4
 
 					add column, column, #1
-					b mtx32_multiply_row_column
+					b mtx32_multiply_into_row_column
 
 		/* } */
-			mtx32_multiply_row_column_common:
+			mtx32_multiply_into_row_column_common:
 
 				add row, row, #1
-				b mtx32_multiply_row
+				b mtx32_multiply_into_row
 
 	/* } */
-	mtx32_multiply_common:
+	mtx32_multiply_into_common:
 		mov r0, matrix_ret
 		vpop {s0-s2}
 		pop {r4-r9,pc}
@@ -117,9 +161,9 @@ mtx32_multiply:
 .unreq matrix1
 .unreq matrix2
 .unreq number_mat
+.unreq matrix_ret
 .unreq temp
 .unreq temp2
-.unreq matrix_ret
 .unreq index
 .unreq column
 .unreq row
@@ -130,6 +174,219 @@ mtx32_multiply:
 .unreq vfp_sum
 
 
+/**
+ * function mtx32_multiply4_into
+ * Multiplies Two 4 by 4 Matrix with Single Precision Float into Memory Space of Caller, Unrolled
+ * Whole Matrix2 is held in VFP registers, and each row of Matrix1 is loaded before storing the row of the result.
+ * So the result can be stored to the same memory space as Matrix1 or Matrix2.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Matrix1 with Single Precision Float
+ * r1: Matrix2 with Single Precision Float
+ * r2: Matrix to Be Calculated
+ *
+ * Return: r0 (Matrix to Be Calculated)
+ */
+.globl mtx32_multiply4_into
+mtx32_multiply4_into:
+	/* Auto (Local) Variables, but just Aliases */
+	matrix1     .req r0
+	matrix2     .req r1
+	matrix_ret  .req r2
+	pointer_ret .req r3
+
+	/**
+	 * VFP Registers
+	 * s0-s3: Row of Matrix1
+	 * s4-s7: Row of Result
+	 * s16-s31: Matrix2, s16-s19 as Row 0, s20-s23 as Row 1, s24-s27 as Row 2, s28-s31 as Row 3
+	 */
+
+	vpush {s0-s7}
+	vpush {s16-s31}
+
+	vldmia matrix2, {s16-s31}
+	mov pointer_ret, matrix_ret
+
+	/* Row 0 */
+	vldmia matrix1!, {s0-s3}
+	vmul.f32 s4, s0, s16
+	vmul.f32 s5, s0, s17
+	vmul.f32 s6, s0, s18
+	vmul.f32 s7, s0, s19
+	vmla.f32 s4, s1, s20
+	vmla.f32 s5, s1, s21
+	vmla.f32 s6, s1, s22
+	vmla.f32 s7, s1, s23
+	vmla.f32 s4, s2, s24
+	vmla.f32 s5, s2, s25
+	vmla.f32 s6, s2, s26
+	vmla.f32 s7, s2, s27
+	vmla.f32 s4, s3, s28
+	vmla.f32 s5, s3, s29
+	vmla.f32 s6, s3, s30
+	vmla.f32 s7, s3, s31
+	vstmia pointer_ret!, {s4-s7}
+
+	/* Row 1 */
+	vldmia matrix1!, {s0-s3}
+	vmul.f32 s4, s0, s16
+	vmul.f32 s5, s0, s17
+	vmul.f32 s6, s0, s18
+	vmul.f32 s7, s0, s19
+	vmla.f32 s4, s1, s20
+	vmla.f32 s5, s1, s21
+	vmla.f32 s6, s1, s22
+	vmla.f32 s7, s1, s23
+	vmla.f32 s4, s2, s24
+	vmla.f32 s5, s2, s25
+	vmla.f32 s6, s2, s26
+	vmla.f32 s7, s2, s27
+	vmla.f32 s4, s3, s28
+	vmla.f32 s5, s3, s29
+	vmla.f32 s6, s3, s30
+	vmla.f32 s7, s3, s31
+	vstmia pointer_ret!, {s4-s7}
+
+	/* Row 2 */
+	vldmia matrix1!, {s0-s3}
+	vmul.f32 s4, s0, s16
+	vmul.f32 s5, s0, s17
+	vmul.f32 s6, s0, s18
+	vmul.f32 s7, s0, s19
+	vmla.f32 s4, s1, s20
+	vmla.f32 s5, s1, s21
+	vmla.f32 s6, s1, s22
+	vmla.f32 s7, s1, s23
+	vmla.f32 s4, s2, s24
+	vmla.f32 s5, s2, s25
+	vmla.f32 s6, s2, s26
+	vmla.f32 s7, s2, s27
+	vmla.f32 s4, s3, s28
+	vmla.f32 s5, s3, s29
+	vmla.f32 s6, s3, s30
+	vmla.f32 s7, s3, s31
+	vstmia pointer_ret!, {s4-s7}
+
+	/* Row 3 */
+	vldmia matrix1!, {s0-s3}
+	vmul.f32 s4, s0, s16
+	vmul.f32 s5, s0, s17
+	vmul.f32 s6, s0, s18
+	vmul.f32 s7, s0, s19
+	vmla.f32 s4, s1, s20
+	vmla.f32 s5, s1, s21
+	vmla.f32 s6, s1, s22
+	vmla.f32 s7, s1, s23
+	vmla.f32 s4, s2, s24
+	vmla.f32 s5, s2, s25
+	vmla.f32 s6, s2, s26
+	vmla.f32 s7, s2, s27
+	vmla.f32 s4, s3, s28
+	vmla.f32 s5, s3, s29
+	vmla.f32 s6, s3, s30
+	vmla.f32 s7, s3, s31
+	vstmia pointer_ret!, {s4-s7}
+
+	mtx32_multiply4_into_common:
+		mov r0, matrix_ret
+		vpop {s16-s31}
+		vpop {s0-s7}
+		mov pc, lr
+
+.unreq matrix1
+.unreq matrix2
+.unreq matrix_ret
+.unreq pointer_ret
+
+
+/**
+ * function mtx32_multiply3_into
+ * Multiplies Two 3 by 3 Matrix with Single Precision Float into Memory Space of Caller, Unrolled
+ * Whole Matrix2 is held in VFP registers, and each row of Matrix1 is loaded before storing the row of the result.
+ * So the result can be stored to the same memory space as Matrix1 or Matrix2.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Matrix1 with Single Precision Float
+ * r1: Matrix2 with Single Precision Float
+ * r2: Matrix to Be Calculated
+ *
+ * Return: r0 (Matrix to Be Calculated)
+ */
+.globl mtx32_multiply3_into
+mtx32_multiply3_into:
+	/* Auto (Local) Variables, but just Aliases */
+	matrix1     .req r0
+	matrix2     .req r1
+	matrix_ret  .req r2
+	pointer_ret .req r3
+
+	/**
+	 * VFP Registers
+	 * s0-s2: Row of Matrix1
+	 * s4-s6: Row of Result
+	 * s16-s24: Matrix2, s16-s18 as Row 0, s19-s21 as Row 1, s22-s24 as Row 2
+	 */
+
+	vpush {s0-s6}
+	vpush {s16-s24}
+
+	vldmia matrix2, {s16-s24}
+	mov pointer_ret, matrix_ret
+
+	/* Row 0 */
+	vldmia matrix1!, {s0-s2}
+	vmul.f32 s4, s0, s16
+	vmul.f32 s5, s0, s17
+	vmul.f32 s6, s0, s18
+	vmla.f32 s4, s1, s19
+	vmla.f32 s5, s1, s20
+	vmla.f32 s6, s1, s21
+	vmla.f32 s4, s2, s22
+	vmla.f32 s5, s2, s23
+	vmla.f32 s6, s2, s24
+	vstmia pointer_ret!, {s4-s6}
+
+	/* Row 1 */
+	vldmia matrix1!, {s0-s2}
+	vmul.f32 s4, s0, s16
+	vmul.f32 s5, s0, s17
+	vmul.f32 s6, s0, s18
+	vmla.f32 s4, s1, s19
+	vmla.f32 s5, s1, s20
+	vmla.f32 s6, s1, s21
+	vmla.f32 s4, s2, s22
+	vmla.f32 s5, s2, s23
+	vmla.f32 s6, s2, s24
+	vstmia pointer_ret!, {s4-s6}
+
+	/* Row 2 */
+	vldmia matrix1!, {s0-s2}
+	vmul.f32 s4, s0, s16
+	vmul.f32 s5, s0, s17
+	vmul.f32 s6, s0, s18
+	vmla.f32 s4, s1, s19
+	vmla.f32 s5, s1, s20
+	vmla.f32 s6, s1, s21
+	vmla.f32 s4, s2, s22
+	vmla.f32 s5, s2, s23
+	vmla.f32 s6, s2, s24
+	vstmia pointer_ret!, {s4-s6}
+
+	mtx32_multiply3_into_common:
+		mov r0, matrix_ret
+		vpop {s16-s24}
+		vpop {s0-s6}
+		mov pc, lr
+
+.unreq matrix1
+.unreq matrix2
+.unreq matrix_ret
+.unreq pointer_ret
+
+
 /**
  * function mtx32_identity
  * Get Identity of Matrix
@@ -145,27 +402,67 @@ mtx32_multiply:
 mtx32_identity:
 	/* Auto (Local) Variables, but just Aliases */
 	number_mat  .req r0
-	one         .req r1
+	matrix      .req r1
+
+	push {lr}
+
+	mul matrix, number_mat, number_mat
+
+	push {r0}
+	mov r0, matrix
+	bl heap32_malloc
+	mov matrix, r0
+	pop {r0}
+
+	cmp matrix, #0
+	beq mtx32_identity_common
+
+	push {r1}
+	bl mtx32_identity_into
+	pop {r1}
+
+	mtx32_identity_common:
+		mov r0, matrix
+		pop {pc}
+
+.unreq number_mat
+.unreq matrix
+
+
+/**
+ * function mtx32_identity_into
+ * Get Identity of Matrix into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Number of Rows and Columns
+ * r1: Matrix to Have Identity
+ *
+ * Return: r0 (Matrix to Have Identity)
+ */
+.globl mtx32_identity_into
+mtx32_identity_into:
+	/* Auto (Local) Variables, but just Aliases */
+	number_mat  .req r0
+	matrix      .req r1
 	offset      .req r2
 	i           .req r3
-	matrix      .req r4
+	one         .req r4
 
 	/* VFP Registers */
 	vfp_one     .req s0
 
-	push {r4,lr}
+	push {r4}
 	vpush {s0}
 
+	/* Clear All */
 	mul i, number_mat, number_mat
+	mov one, #0
 
-	push {r0-r3}
-	mov r0, i
-	bl heap32_malloc
-	mov matrix, r0
-	pop {r0-r3}
-
-	cmp matrix, #0
-	beq mtx32_identity_common
+	mtx32_identity_into_clear:
+		subs i, i, #1
+		strge one, [matrix, i, lsl #2]    @ Substitution of Multiplication by 4
+		bgt mtx32_identity_into_clear
 
 	mov one, #1
 	vmov vfp_one, one
@@ -177,26 +474,27 @@ mtx32_identity:
 
 	mov offset, #0
 
-	mtx32_identity_loop:
+	mtx32_identity_into_loop:
 		cmp i, #0
-		ble mtx32_identity_common
+		ble mtx32_identity_into_common
 
 		str one, [matrix, offset, lsl #2] @ Substitution of Multiplication by 4
 
 		add offset, offset, number_mat
 		sub i, i, #1
-		b mtx32_identity_loop
+		b mtx32_identity_into_loop
 
-	mtx32_identity_common:
+	mtx32_identity_into_common:
 		mov r0, matrix
 		vpop {s0}
-		pop {r4,pc}
+		pop {r4}
+		mov pc, lr
 
 .unreq number_mat
-.unreq one
+.unreq matrix
 .unreq offset
 .unreq i
-.unreq matrix
+.unreq one
 .unreq vfp_one
 
 
@@ -219,13 +517,60 @@ mtx32_multiply_vec:
 	matrix         .req r0
 	vector         .req r1
 	number_vec     .req r2
-	value1         .req r3
-	value2         .req r4
-	temp1          .req r5
-	temp2          .req r6
-	i              .req r7
-	offset         .req r8
-	vector_result  .req r9
+	vector_result  .req r3
+
+	push {lr}
+
+	push {r0-r2}
+	mov r0, number_vec
+	bl heap32_malloc
+	mov vector_result, r0
+	pop {r0-r2}
+
+	cmp vector_result, #0
+	beq mtx32_multiply_vec_common
+
+	push {r3}
+	bl mtx32_multiply_vec_into
+	pop {r3}
+
+	mtx32_multiply_vec_common:
+		mov r0, vector_result
+		pop {pc}
+
+.unreq matrix
+.unreq vector
+.unreq number_vec
+.unreq vector_result
+
+
+/**
+ * function mtx32_multiply_vec_into
+ * Square Matrix and Column Vector Multiplication (Row Order) into Memory Space of Caller
+ * Vector size 4 is calculated by unrolled function, mtx32_transform_vec4_array.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Matrix
+ * r1: Vector
+ * r2: Number of Vector Size
+ * r3: Vector to Have Been Multiplied, Must Not Be Same as Vector Except Vector Size 4
+ *
+ * Return: r0 (Vector to Have Been Multiplied)
+ */
+.globl mtx32_multiply_vec_into
+mtx32_multiply_vec_into:
+	/* Auto (Local) Variables, but just Aliases */
+	matrix         .req r0
+	vector         .req r1
+	number_vec     .req r2
+	vector_result  .req r3
+	value1         .req r4
+	value2         .req r5
+	temp1          .req r6
+	temp2          .req r7
+	i              .req r8
+	offset         .req r9
 
 	/* VFP Registers */
 	vfp_value     .req d0
@@ -233,37 +578,32 @@ mtx32_multiply_vec:
 	vfp_value2    .req s1
 	vfp_result    .req s2
 
+	cmp number_vec, #4
+	moveq number_vec, vector_result
+	moveq vector_result, #1
+	beq mtx32_transform_vec4_array
+
 	push {r4-r9,lr}
 	vpush {s0-s3}
 
-	push {r0-r3}
-	mov r0, number_vec
-	bl heap32_malloc
-	mov vector_result, r0
-	pop {r0-r3}
-
-	cmp vector_result, #0
-	beq mtx32_multiply_vec_common
-
 	mov offset, #0
 	mov i, #0
 
-	mtx32_multiply_vec_row:
+	mtx32_multiply_vec_into_row:
 		cmp i, number_vec
-		bge mtx32_multiply_vec_common
+		bge mtx32_multiply_vec_into_common
 
 		mov temp1, #0
 		vmov vfp_result, temp1
-		/*vcvt.f32.s32 vfp_result, vfp_result*/
 
 		mov temp1, number_vec
 		sub temp1, temp1, #1
 
 		add temp2, offset, temp1
 
-		mtx32_multiply_vec_row_column:
+		mtx32_multiply_vec_into_row_column:
 			cmp temp1, #0
-			blt mtx32_multiply_vec_row_common
+			blt mtx32_multiply_vec_into_row_common
 
 			ldr value1, [matrix, temp2, lsl #2]         @ Substitution of Multiplication by 4
 			ldr value2, [vector, temp1, lsl #2]         @ Substitution of Multiplication by 4
@@ -272,17 +612,17 @@ mtx32_multiply_vec:
 
 			sub temp1, temp1, #1
 			sub temp2, temp2, #1
-			b mtx32_multiply_vec_row_column
+			b mtx32_multiply_vec_into_row_column
 
-		mtx32_multiply_vec_row_common:
+		mtx32_multiply_vec_into_row_common:
 			vmov value1, vfp_result
 			str value1, [vector_result, i, lsl #2]      @ Substitution of Multiplication by 4
 			add offset, offset, number_vec
 			add i, i, #1
 
-			b mtx32_multiply_vec_row
+			b mtx32_multiply_vec_into_row
 
-	mtx32_multiply_vec_common:
+	mtx32_multiply_vec_into_common:
 		mov r0, vector_result
 		vpop {s0-s3}
 		pop {r4-r9,pc}
@@ -290,19 +630,95 @@ mtx32_multiply_vec:
 .unreq matrix
 .unreq vector
 .unreq number_vec
+.unreq vector_result
 .unreq value1
 .unreq value2
 .unreq temp1
 .unreq temp2
 .unreq i
 .unreq offset
-.unreq vector_result
 .unreq vfp_value
 .unreq vfp_value1
 .unreq vfp_value2
 .unreq vfp_result
 
 
+/**
+ * function mtx32_transform_vec4_array
+ * 4 by 4 Square Matrix and Column Vectors Multiplication (Row Order), Unrolled
+ * Transforms an array of vectors (X, Y, Z, and W) by one matrix in one call.
+ * Whole matrix is held in VFP registers, and each vector is loaded before storing the result.
+ * So the result can be stored to the same memory space as the array of vectors.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: 4 by 4 Square Matrix
+ * r1: Array of Vectors, Each Vector Must Be Four of Vector Size
+ * r2: Array of Vectors to Have Been Multiplied
+ * r3: Number of Vectors
+ *
+ * Return: r0 (Array of Vectors to Have Been Multiplied)
+ */
+.globl mtx32_transform_vec4_array
+mtx32_transform_vec4_array:
+	/* Auto (Local) Variables, but just Aliases */
+	matrix         .req r0
+	vector         .req r1
+	vector_result  .req r2
+	number_vec     .req r3
+	pointer_result .req r12
+
+	/**
+	 * VFP Registers
+	 * s0-s3: Vector
+	 * s4-s7: Result
+	 * s16-s31: Matrix, s16-s19 as Row 0, s20-s23 as Row 1, s24-s27 as Row 2, s28-s31 as Row 3
+	 */
+
+	vpush {s0-s7}
+	vpush {s16-s31}
+
+	vldmia matrix, {s16-s31}
+	mov pointer_result, vector_result
+
+	mtx32_transform_vec4_array_loop:
+		subs number_vec, number_vec, #1
+		blt mtx32_transform_vec4_array_common
+
+		vldmia vector!, {s0-s3}
+		vmul.f32 s4, s16, s0
+		vmul.f32 s5, s20, s0
+		vmul.f32 s6, s24, s0
+		vmul.f32 s7, s28, s0
+		vmla.f32 s4, s17, s1
+		vmla.f32 s5, s21, s1
+		vmla.f32 s6, s25, s1
+		vmla.f32 s7, s29, s1
+		vmla.f32 s4, s18, s2
+		vmla.f32 s5, s22, s2
+		vmla.f32 s6, s26, s2
+		vmla.f32 s7, s30, s2
+		vmla.f32 s4, s19, s3
+		vmla.f32 s5, s23, s3
+		vmla.f32 s6, s27, s3
+		vmla.f32 s7, s31, s3
+		vstmia pointer_result!, {s4-s7}
+
+		b mtx32_transform_vec4_array_loop
+
+	mtx32_transform_vec4_array_common:
+		mov r0, vector_result
+		vpop {s16-s31}
+		vpop {s0-s7}
+		mov pc, lr
+
+.unreq matrix
+.unreq vector
+.unreq vector_result
+.unreq number_vec
+.unreq pointer_result
+
+
 /**
  * function mtx32_normalize
  * Normalize Vector
@@ -582,19 +998,55 @@ mtx32_translate3d:
 	/* Auto (Local) Variables, but just Aliases */
 	vector        .req r0
 	matrix_result .req r1
-	value         .req r2
 
 	push {lr}
 
 	push {r0}
-	mov r0, #4
-	bl mtx32_identity
+	mov r0, #16
+	bl heap32_malloc
 	mov matrix_result, r0
 	pop {r0}
 
 	cmp matrix_result, #0
 	beq mtx32_translate3d_common
 
+	push {r1}
+	bl mtx32_translate3d_into
+	pop {r1}
+
+	mtx32_translate3d_common:
+		mov r0, matrix_result
+		pop {pc}
+
+.unreq vector
+.unreq matrix_result
+
+
+/**
+ * function mtx32_translate3d_into
+ * Make 4 by 4 Square Matrix (Row Order) with Vector of 3D Translation into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Vector, Must Be Three of Vector Size, X, Y, and Z
+ * r1: 4 by 4 Square Matrix to Be Calculated
+ *
+ * Return: r0 (4 by 4 Square Matrix to Be Calculated)
+ */
+.globl mtx32_translate3d_into
+mtx32_translate3d_into:
+	/* Auto (Local) Variables, but just Aliases */
+	vector        .req r0
+	matrix_result .req r1
+	value         .req r2
+
+	push {lr}
+
+	push {r0-r1}
+	mov r0, #4
+	bl mtx32_identity_into
+	pop {r0-r1}
+
 	ldr value, [vector]
 	str value, [matrix_result, #12] @ Matrix_result[3], X
 	ldr value, [vector, #4]
@@ -602,7 +1054,7 @@ mtx32_translate3d:
 	ldr value, [vector, #8]
 	str value, [matrix_result, #44] @ Matrix_result[11], Z
 
-	mtx32_translate3d_common:
+	mtx32_translate3d_into_common:
 		mov r0, matrix_result
 		pop {pc}
 
@@ -627,25 +1079,21 @@ mtx32_scale3d:
 	/* Auto (Local) Variables, but just Aliases */
 	vector        .req r0
 	matrix_result .req r1
-	value         .req r2
 
 	push {lr}
 
 	push {r0}
-	mov r0, #4
-	bl mtx32_identity
+	mov r0, #16
+	bl heap32_malloc
 	mov matrix_result, r0
 	pop {r0}
 
 	cmp matrix_result, #0
 	beq mtx32_scale3d_common
 
-	ldr value, [vector]
-	str value, [matrix_result]      @ Matrix_result[0], X
-	ldr value, [vector, #4]
-	str value, [matrix_result, #20] @ Matrix_result[5], Y
-	ldr value, [vector, #8]
-	str value, [matrix_result, #40] @ Matrix_result[10], Z
+	push {r1}
+	bl mtx32_scale3d_into
+	pop {r1}
 
 	mtx32_scale3d_common:
 		mov r0, matrix_result
@@ -653,7 +1101,47 @@ mtx32_scale3d:
 
 .unreq vector
 .unreq matrix_result
-.unreq value
+
+
+/**
+ * function mtx32_scale3d_into
+ * Make 4 by 4 Square Matrix (Row Order) with Vector of 3D Scale into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Vector, Must Be Three of Vector Size, X, Y, and Z
+ * r1: 4 by 4 Square Matrix to Be Calculated
+ *
+ * Return: r0 (4 by 4 Square Matrix to Be Calculated)
+ */
+.globl mtx32_scale3d_into
+mtx32_scale3d_into:
+	/* Auto (Local) Variables, but just Aliases */
+	vector        .req r0
+	matrix_result .req r1
+	value         .req r2
+
+	push {lr}
+
+	push {r0-r1}
+	mov r0, #4
+	bl mtx32_identity_into
+	pop {r0-r1}
+
+	ldr value, [vector]
+	str value, [matrix_result]      @ Matrix_result[0], X
+	ldr value, [vector, #4]
+	str value, [matrix_result, #20] @ Matrix_result[5], Y
+	ldr value, [vector, #8]
+	str value, [matrix_result, #40] @ Matrix_result[10], Z
+
+	mtx32_scale3d_into_common:
+		mov r0, matrix_result
+		pop {pc}
+
+.unreq vector
+.unreq matrix_result
+.unreq value
 
 
 /**
@@ -672,26 +1160,65 @@ mtx32_rotatex3d:
 	/* Auto (Local) Variables, but just Aliases */
 	degree        .req r0
 	matrix_result .req r1
+
+	push {lr}
+
+	push {r0}
+	mov r0, #16
+	bl heap32_malloc
+	mov matrix_result, r0
+	pop {r0}
+
+	cmp matrix_result, #0
+	beq mtx32_rotatex3d_common
+
+	push {r1}
+	bl mtx32_rotatex3d_into
+	pop {r1}
+
+	mtx32_rotatex3d_common:
+		mov r0, matrix_result
+		pop {pc}
+
+.unreq degree
+.unreq matrix_result
+
+
+/**
+ * function mtx32_rotatex3d_into
+ * Make 4 by 4 Square Matrix (Row Order) with Vector of 3D Rotate X, Clock Wise into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Value of Degrees, Must Be Single Precision Float
+ * r1: 4 by 4 Square Matrix to Be Calculated
+ *
+ * Return: r0 (4 by 4 Square Matrix to Be Calculated)
+ */
+.globl mtx32_rotatex3d_into
+mtx32_rotatex3d_into:
+	/* Auto (Local) Variables, but just Aliases */
+	degree        .req r0
 	value         .req r2
+	matrix_result .req r4
 
 	/* VFP Registers */
 	vfp_value     .req s0
 
-	push {lr}
+	push {r4,lr}
 	vpush {s0}
 
-	bl math32_degree_to_radian
-	.unreq degree
-	radian .req r0
+	mov matrix_result, r1
 
 	push {r0}
 	mov r0, #4
-	bl mtx32_identity
-	mov matrix_result, r0
+	mov r1, matrix_result
+	bl mtx32_identity_into
 	pop {r0}
 
-	cmp matrix_result, #0
-	beq mtx32_rotatex3d_common
+	bl math32_degree_to_radian
+	.unreq degree
+	radian .req r0
 
 	push {r0}
 	bl math32_cos
@@ -712,10 +1239,10 @@ mtx32_rotatex3d:
 	vmov value, vfp_value
 	str value, [matrix_result, #24] @ Matrix_result[6], -sin
 
-	mtx32_rotatex3d_common:
+	mtx32_rotatex3d_into_common:
 		mov r0, matrix_result
 		vpop {s0}
-		pop {pc}
+		pop {r4,pc}
 
 .unreq radian
 .unreq matrix_result
@@ -739,26 +1266,65 @@ mtx32_rotatey3d:
 	/* Auto (Local) Variables, but just Aliases */
 	degree        .req r0
 	matrix_result .req r1
+
+	push {lr}
+
+	push {r0}
+	mov r0, #16
+	bl heap32_malloc
+	mov matrix_result, r0
+	pop {r0}
+
+	cmp matrix_result, #0
+	beq mtx32_rotatey3d_common
+
+	push {r1}
+	bl mtx32_rotatey3d_into
+	pop {r1}
+
+	mtx32_rotatey3d_common:
+		mov r0, matrix_result
+		pop {pc}
+
+.unreq degree
+.unreq matrix_result
+
+
+/**
+ * function mtx32_rotatey3d_into
+ * Make 4 by 4 Square Matrix (Row Order) with Vector of 3D Rotate Y, Clock Wise into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Value of Degrees, Must Be Single Precision Float
+ * r1: 4 by 4 Square Matrix to Be Calculated
+ *
+ * Return: r0 (4 by 4 Square Matrix to Be Calculated)
+ */
+.globl mtx32_rotatey3d_into
+mtx32_rotatey3d_into:
+	/* Auto (Local) Variables, but just Aliases */
+	degree        .req r0
 	value         .req r2
+	matrix_result .req r4
 
 	/* VFP Registers */
 	vfp_value     .req s0
 
-	push {lr}
+	push {r4,lr}
 	vpush {s0}
 
-	bl math32_degree_to_radian
-	.unreq degree
-	radian .req r0
+	mov matrix_result, r1
 
 	push {r0}
 	mov r0, #4
-	bl mtx32_identity
-	mov matrix_result, r0
+	mov r1, matrix_result
+	bl mtx32_identity_into
 	pop {r0}
 
-	cmp matrix_result, #0
-	beq mtx32_rotatey3d_common
+	bl math32_degree_to_radian
+	.unreq degree
+	radian .req r0
 
 	push {r0}
 	bl math32_cos
@@ -779,10 +1345,10 @@ mtx32_rotatey3d:
 	vmov value, vfp_value
 	str value, [matrix_result, #32] @ Matrix_result[8], -sin
 
-	mtx32_rotatey3d_common:
+	mtx32_rotatey3d_into_common:
 		mov r0, matrix_result
 		vpop {s0}
-		pop {pc}
+		pop {r4,pc}
 
 .unreq radian
 .unreq matrix_result
@@ -806,26 +1372,65 @@ mtx32_rotatez3d:
 	/* Auto (Local) Variables, but just Aliases */
 	degree        .req r0
 	matrix_result .req r1
+
+	push {lr}
+
+	push {r0}
+	mov r0, #16
+	bl heap32_malloc
+	mov matrix_result, r0
+	pop {r0}
+
+	cmp matrix_result, #0
+	beq mtx32_rotatez3d_common
+
+	push {r1}
+	bl mtx32_rotatez3d_into
+	pop {r1}
+
+	mtx32_rotatez3d_common:
+		mov r0, matrix_result
+		pop {pc}
+
+.unreq degree
+.unreq matrix_result
+
+
+/**
+ * function mtx32_rotatez3d_into
+ * Make 4 by 4 Square Matrix (Row Order) with Vector of 3D Rotate Z, Clock Wise into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Value of Degrees, Must Be Single Precision Float
+ * r1: 4 by 4 Square Matrix to Be Calculated
+ *
+ * Return: r0 (4 by 4 Square Matrix to Be Calculated)
+ */
+.globl mtx32_rotatez3d_into
+mtx32_rotatez3d_into:
+	/* Auto (Local) Variables, but just Aliases */
+	degree        .req r0
 	value         .req r2
+	matrix_result .req r4
 
 	/* VFP Registers */
 	vfp_value     .req s0
 
-	push {lr}
+	push {r4,lr}
 	vpush {s0}
 
-	bl math32_degree_to_radian
-	.unreq degree
-	radian .req r0
+	mov matrix_result, r1
 
 	push {r0}
 	mov r0, #4
-	bl mtx32_identity
-	mov matrix_result, r0
+	mov r1, matrix_result
+	bl mtx32_identity_into
 	pop {r0}
 
-	cmp matrix_result, #0
-	beq mtx32_rotatez3d_common
+	bl math32_degree_to_radian
+	.unreq degree
+	radian .req r0
 
 	push {r0}
 	bl math32_cos
@@ -846,10 +1451,10 @@ mtx32_rotatez3d:
 	vmov value, vfp_value
 	str value, [matrix_result, #4]  @ Matrix_result[1], -sin
 
-	mtx32_rotatez3d_common:
+	mtx32_rotatez3d_into_common:
 		mov r0, matrix_result
 		vpop {s0}
-		pop {pc}
+		pop {r4,pc}
 
 .unreq radian
 .unreq matrix_result
@@ -879,6 +1484,55 @@ mtx32_perspective3d:
 	near          .req r2
 	far           .req r3
 	matrix_result .req r4
+
+	push {r4,lr}
+
+	push {r0-r3}
+	mov r0, #16
+	bl heap32_malloc
+	mov matrix_result, r0
+	pop {r0-r3}
+
+	cmp matrix_result, #0
+	beq mtx32_perspective3d_common
+
+	push {r4}
+	bl mtx32_perspective3d_into
+	add sp, sp, #4
+
+	mtx32_perspective3d_common:
+		mov r0, matrix_result
+		pop {r4,pc}
+
+.unreq fovy_deg
+.unreq aspect
+.unreq near
+.unreq far
+.unreq matrix_result
+
+
+/**
+ * function mtx32_perspective3d_into
+ * Make 4 by 4 Square Matrix (Row Order) with Perspective into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: FovY (Field of View Y: Vertical) by Degrees, Must Be Single Precison Float
+ * r1: Aspect, Must Be Single Precision Float
+ * r2: Near, Must Be Single Precision Float
+ * r3: Far, Must Be Single Precision Float
+ * r4: 4 by 4 Square Matrix to Be Calculated
+ *
+ * Return: r0 (4 by 4 Square Matrix to Be Calculated)
+ */
+.globl mtx32_perspective3d_into
+mtx32_perspective3d_into:
+	/* Auto (Local) Variables, but just Aliases */
+	fovy_deg      .req r0
+	aspect        .req r1
+	near          .req r2
+	far           .req r3
+	matrix_result .req r4
 	temp          .req r5
 
 	/* VFP Registers */
@@ -891,17 +1545,22 @@ mtx32_perspective3d:
 	vfp_temp2    .req s6
 
 	push {r4-r5,lr}
+
+	add sp, sp, #12                            @ r4-r5 and lr offset 12 bytes
+	pop {matrix_result}                        @ Get Fifth Argument
+	sub sp, sp, #16                            @ Retrieve SP
+
 	vpush {s0-s6}
 
-	/* Make All Zero 4-4 Martrix */
+	/* Make All Zero 4-4 Martrix, Matrix_result[15] Is Only One to Be Zero on Identity */
 	push {r0-r3}
-	mov r0, #16 
-	bl heap32_malloc
-	mov matrix_result, r0
+	mov r0, #4
+	mov r1, matrix_result
+	bl mtx32_identity_into
 	pop {r0-r3}
 
-	cmp matrix_result, #0
-	beq mtx32_perspective3d_common
+	mov temp, #0
+	str temp, [matrix_result, #60]             @ Matrix_result[15]
 
 	/* FovY by Degrees to Radian */
 
@@ -966,7 +1625,7 @@ mtx32_perspective3d:
 	vdiv.f32 vfp_temp, vfp_temp, vfp_temp2
 	vstr vfp_temp, [matrix_result, #44]        @ Matrix_result[11]
 
-	mtx32_perspective3d_common:
+	mtx32_perspective3d_into_common:
 		mov r0, matrix_result
 		vpop {s0-s6}
 		pop {r4-r5,pc}
@@ -1006,305 +1665,210 @@ mtx32_view3d:
 	vec_trg       .req r1
 	vec_up        .req r2
 	matrix_orient .req r3
-	vec_distance  .req r4
-	temp          .req r5
-
-	/* VFP Registers */
-	vfp_vec_x     .req s0
-	vfp_vec_y     .req s1
-	vfp_vec_z     .req s2
-	vfp_vec2_x    .req s3
-	vfp_vec2_y    .req s4
-	vfp_vec2_z    .req s5
-	vfp_temp      .req s6
-
-	push {r4-r5,lr}
-	vpush {s0-s6}
-
-	vldr vfp_vec_x, [vec_cam]
-	vldr vfp_vec_y, [vec_cam, #4]
-	vldr vfp_vec_z, [vec_cam, #8]
-	vldr vfp_vec2_x, [vec_trg]
-	vldr vfp_vec2_y, [vec_trg, #4]
-	vldr vfp_vec2_z, [vec_trg, #8]
 
-	/* Make Vector of Distance Between Target and Camera Posision */
+	push {lr}
 
-	push {r0-r3}
-	mov r0, #3
+	push {r0-r2}
+	mov r0, #16
 	bl heap32_malloc
-	mov vec_distance, r0
-	pop {r0-r3}
-
-	cmp vec_distance, #0
-	bne mtx32_view3d_distance
-
-	mov r0, #0
-	b mtx32_view3d_common
-
-	mtx32_view3d_distance:
-
-		vsub.f32 vfp_temp, vfp_vec2_x, vfp_vec_x @ Camera Position is Inverted
-		vstr vfp_temp, [vec_distance]
-		vsub.f32 vfp_temp, vfp_vec2_y, vfp_vec_y @ Camera Position is Inverted
-		vstr vfp_temp, [vec_distance, #4]
-		vsub.f32 vfp_temp, vfp_vec2_z, vfp_vec_z @ Camera Position is Inverted
-		vstr vfp_temp, [vec_distance, #8]
-
-		/* Make Forward Vector from Distance, e.g., Index Finger */
-
-		push {r0-r3}
-		mov r0, vec_distance
-		mov r1, #3
-		bl mtx32_normalize
-		mov temp, r0
-		pop {r0-r3}
-
-		push {r0-r3}
-		mov r0, vec_distance
-		bl heap32_mfree
-		pop {r0-r3}
-
-		.unreq vec_distance
-		vec_forward .req r4
-
-		mov vec_forward, temp
-		cmp vec_forward, #0
-		bne mtx32_view3d_right
-
-		mov r0, #0
-		b mtx32_view3d_common
-
-	mtx32_view3d_right:
-
-		/* Make Right Vector, e.g., Middle Finger */
-
-		push {r0-r1,r3}
-		mov r0, vec_forward
-		mov r1, vec_up
-		bl mtx32_crossproduct
-		mov vec_up, r0
-		pop {r0-r1,r3}
-
-		cmp vec_up, #0
-		bne mtx32_view3d_right_normalize
+	mov matrix_orient, r0
+	pop {r0-r2}
 
-		push {r0-r3}
-		mov r0, vec_forward
-		bl heap32_mfree
-		pop {r0-r3}
+	cmp matrix_orient, #0
+	beq mtx32_view3d_common
 
-		mov r0, #0
-		b mtx32_view3d_common
+	push {r3}
+	bl mtx32_view3d_into
+	pop {r3}
 
-		mtx32_view3d_right_normalize:
+	mtx32_view3d_common:
+		mov r0, matrix_orient
+		pop {pc}
 
-			push {r0-r3}
-			mov r0, vec_up
-			mov r1, #3
-			bl mtx32_normalize
-			mov temp, r0
-			pop {r0-r3}
+.unreq vec_cam
+.unreq vec_trg
+.unreq vec_up
+.unreq matrix_orient
 
-			push {r0-r3}
-			mov r0, vec_up
-			bl heap32_mfree
-			pop {r0-r3}
-
-			.unreq vec_up
-			vec_right .req r2
 
-			mov vec_right, temp
-			cmp vec_right, #0
-			bne mtx32_view3d_realup
+/**
+ * function mtx32_view3d_into
+ * Make 4 by 4 Square Matrix (Row Order) with View into Memory Space of Caller
+ * Forward, right, and real up vectors are made in VFP registers without allocating memory space.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Parameters
+ * r0: Vector of Camera Position, Must Be Three of Vector Size, X, Y, and Z
+ * r1: Vector of Target Position, Must Be Three of Vector Size, X, Y, and Z
+ * r2: Vector of Up (Above Your Head), Must Be Three of Vector Size, X, Y, and Z
+ * r3: 4 by 4 Square Matrix to Be Calculated
+ *
+ * Return: r0 (4 by 4 Square Matrix to Be Calculated)
+ */
+.globl mtx32_view3d_into
+mtx32_view3d_into:
+	/* Auto (Local) Variables, but just Aliases */
+	vec_cam       .req r0
+	vec_trg       .req r1
+	vec_up        .req r2
+	matrix_orient .req r3
 
-			push {r0-r3}
-			mov r0, vec_forward
-			bl heap32_mfree
-			pop {r0-r3}
+	/* VFP Registers */
+	vfp_cam_x     .req s0
+	vfp_cam_y     .req s1
+	vfp_cam_z     .req s2
+	vfp_forward_x .req s3
+	vfp_forward_y .req s4
+	vfp_forward_z .req s5
+	vfp_right_x   .req s6
+	vfp_right_y   .req s7
+	vfp_right_z   .req s8
+	vfp_realup_x  .req s9
+	vfp_realup_y  .req s10
+	vfp_realup_z  .req s11
+	vfp_up_x      .req s12
+	vfp_up_y      .req s13
+	vfp_up_z      .req s14
+	vfp_length    .req s15
 
-			mov r0, #0
-			b mtx32_view3d_common
+	push {lr}
+	vpush {s0-s15}
 
-	mtx32_view3d_realup:
-		/* Make Real Up Vector, e.g., Thumb */
-
-		push {r0,r2-r3}
-		mov r0, vec_right
-		mov r1, vec_forward
-		bl mtx32_crossproduct
-		mov vec_trg, r0
-		pop {r0,r2-r3}
-
-		cmp vec_trg, #0
-		bne mtx32_view3d_realup_normalize
-
-		push {r0-r3}
-		mov r0, vec_forward
-		bl heap32_mfree
-		pop {r0-r3}
-
-		push {r0-r3}
-		mov r0, vec_right
-		bl heap32_mfree
-		pop {r0-r3}
-
-		mov r0, #0
-		b mtx32_view3d_common
-
-		mtx32_view3d_realup_normalize:
-
-			push {r0-r3}
-			mov r0, vec_trg
-			mov r1, #3
-			bl mtx32_normalize
-			mov temp, r0
-			pop {r0-r3}
-
-			push {r0-r3}
-			mov r0, vec_trg
-			bl heap32_mfree
-			pop {r0-r3}
-
-			.unreq vec_trg
-			vec_realup .req r1
-
-			mov vec_realup, temp
-			cmp vec_realup, #0
-			bne mtx32_view3d_identify
-
-			push {r0-r3}
-			mov r0, vec_forward
-			bl heap32_mfree
-			pop {r0-r3}
-
-			push {r0-r3}
-			mov r0, vec_right
-			bl heap32_mfree
-			pop {r0-r3}
-
-			mov r0, #0
-			b mtx32_view3d_common
-
-	mtx32_view3d_identify:
-		/* Make Identified 4-4 Martrix */
-
-		push {r0-r2}
-		mov r0, #4
-		bl mtx32_identity
-		mov matrix_orient, r0
-		pop {r0-r2}
-
-		cmp matrix_orient, #0
-		bne mtx32_view3d_identify_main
-
-		push {r0-r3}
-		mov r0, vec_forward
-		bl heap32_mfree
-		pop {r0-r3}
-
-		push {r0-r3}
-		mov r0, vec_right
-		bl heap32_mfree
-		pop {r0-r3}
-
-		push {r0-r3}
-		mov r0, vec_realup
-		bl heap32_mfree
-		pop {r0-r3}
-
-		mov r0, #0
-		b mtx32_view3d_common
-
-		mtx32_view3d_identify_main:
-			/* Store Rotation and Translation with Row Order */
-
-			vldr vfp_vec_x, [vec_cam]
-			vldr vfp_vec_y, [vec_cam, #4]
-			vldr vfp_vec_z, [vec_cam, #8]
-
-			/* Rotation for Right */
-			vldr vfp_vec2_x, [vec_right]
-			vldr vfp_vec2_y, [vec_right, #4]
-			vldr vfp_vec2_z, [vec_right, #8]
-			vstr vfp_vec2_x, [matrix_orient]
-			vstr vfp_vec2_y, [matrix_orient, #4]
-			vstr vfp_vec2_z, [matrix_orient, #8]
-
-			/* Translation for X */
-			vmul.f32 vfp_temp, vfp_vec_x, vfp_vec2_x
-			vmla.f32 vfp_temp, vfp_vec_y, vfp_vec2_y
-			vmla.f32 vfp_temp, vfp_vec_z, vfp_vec2_z
-			vneg.f32 vfp_temp, vfp_temp
-			vstr vfp_temp, [matrix_orient, #12]
-
-			/* Rotation for Real Up */
-			vldr vfp_vec2_x, [vec_realup]
-			vldr vfp_vec2_y, [vec_realup, #4]
-			vldr vfp_vec2_z, [vec_realup, #8]
-			vstr vfp_vec2_x, [matrix_orient, #16]
-			vstr vfp_vec2_y, [matrix_orient, #20]
-			vstr vfp_vec2_z, [matrix_orient, #24]
-
-			/* Translation for Y */
-			vmul.f32 vfp_temp, vfp_vec_x, vfp_vec2_x
-			vmla.f32 vfp_temp, vfp_vec_y, vfp_vec2_y
-			vmla.f32 vfp_temp, vfp_vec_z, vfp_vec2_z
-			vneg.f32 vfp_temp, vfp_temp
-			vstr vfp_temp, [matrix_orient, #28]
-
-			/* Rotation for Forward */
-			vldr vfp_vec2_x, [vec_forward]
-			vldr vfp_vec2_y, [vec_forward, #4]
-			vldr vfp_vec2_z, [vec_forward, #8]
-			vneg.f32 vfp_vec2_x, vfp_vec2_x
-			vneg.f32 vfp_vec2_y, vfp_vec2_y
-			vneg.f32 vfp_vec2_z, vfp_vec2_z
-			vstr vfp_vec2_x, [matrix_orient, #32]
-			vstr vfp_vec2_y, [matrix_orient, #36]
-			vstr vfp_vec2_z, [matrix_orient, #40]
-
-			/* Translation for Z */
-			vmul.f32 vfp_temp, vfp_vec_x, vfp_vec2_x
-			vmla.f32 vfp_temp, vfp_vec_y, vfp_vec2_y
-			vmla.f32 vfp_temp, vfp_vec_z, vfp_vec2_z
-			vneg.f32 vfp_temp, vfp_temp
-			vstr vfp_temp, [matrix_orient, #44]
-
-			push {r0-r3}
-			mov r0, vec_right
-			bl heap32_mfree
-			pop {r0-r3}
-
-			push {r0-r3}
-			mov r0, vec_realup
-			bl heap32_mfree
-			pop {r0-r3}
-
-			push {r0-r3}
-			mov r0, vec_forward
-			bl heap32_mfree
-			pop {r0-r3}
-
-			mov r0, matrix_orient
+	/* Make Identified 4-4 Martrix */
+	push {r0-r3}
+	mov r0, #4
+	mov r1, matrix_orient
+	bl mtx32_identity_into
+	pop {r0-r3}
 
-	mtx32_view3d_common:
-		vpop {s0-s6}
-		pop {r4-r5,pc}
+	vldr vfp_cam_x, [vec_cam]
+	vldr vfp_cam_y, [vec_cam, #4]
+	vldr vfp_cam_z, [vec_cam, #8]
+	vldr vfp_up_x, [vec_up]
+	vldr vfp_up_y, [vec_up, #4]
+	vldr vfp_up_z, [vec_up, #8]
+
+	/* Make Forward Vector from Distance Between Target and Camera Position, e.g., Index Finger */
+	vldr vfp_forward_x, [vec_trg]
+	vldr vfp_forward_y, [vec_trg, #4]
+	vldr vfp_forward_z, [vec_trg, #8]
+	vsub.f32 vfp_forward_x, vfp_forward_x, vfp_cam_x @ Camera Position is Inverted
+	vsub.f32 vfp_forward_y, vfp_forward_y, vfp_cam_y @ Camera Position is Inverted
+	vsub.f32 vfp_forward_z, vfp_forward_z, vfp_cam_z @ Camera Position is Inverted
+
+	/* Normalize, If Length Is Zero, Remain Zero Vector */
+	vmul.f32 vfp_length, vfp_forward_x, vfp_forward_x
+	vmla.f32 vfp_length, vfp_forward_y, vfp_forward_y
+	vmla.f32 vfp_length, vfp_forward_z, vfp_forward_z
+	vsqrt.f32 vfp_length, vfp_length
+	vcmp.f32 vfp_length, #0
+	vmrs apsr_nzcv, fpscr                          @ Transfer FPSCR Flags to CPSR's NZCV
+	vdivne.f32 vfp_forward_x, vfp_forward_x, vfp_length
+	vdivne.f32 vfp_forward_y, vfp_forward_y, vfp_length
+	vdivne.f32 vfp_forward_z, vfp_forward_z, vfp_length
+
+	/* Make Right Vector, Cross Product of Forward and Up, e.g., Middle Finger */
+	vmul.f32 vfp_right_x, vfp_forward_y, vfp_up_z
+	vmls.f32 vfp_right_x, vfp_forward_z, vfp_up_y
+	vmul.f32 vfp_right_y, vfp_forward_z, vfp_up_x
+	vmls.f32 vfp_right_y, vfp_forward_x, vfp_up_z
+	vmul.f32 vfp_right_z, vfp_forward_x, vfp_up_y
+	vmls.f32 vfp_right_z, vfp_forward_y, vfp_up_x
+
+	vmul.f32 vfp_length, vfp_right_x, vfp_right_x
+	vmla.f32 vfp_length, vfp_right_y, vfp_right_y
+	vmla.f32 vfp_length, vfp_right_z, vfp_right_z
+	vsqrt.f32 vfp_length, vfp_length
+	vcmp.f32 vfp_length, #0
+	vmrs apsr_nzcv, fpscr                          @ Transfer FPSCR Flags to CPSR's NZCV
+	vdivne.f32 vfp_right_x, vfp_right_x, vfp_length
+	vdivne.f32 vfp_right_y, vfp_right_y, vfp_length
+	vdivne.f32 vfp_right_z, vfp_right_z, vfp_length
+
+	/* Make Real Up Vector, Cross Product of Right and Forward, e.g., Thumb */
+	vmul.f32 vfp_realup_x, vfp_right_y, vfp_forward_z
+	vmls.f32 vfp_realup_x, vfp_right_z, vfp_forward_y
+	vmul.f32 vfp_realup_y, vfp_right_z, vfp_forward_x
+	vmls.f32 vfp_realup_y, vfp_right_x, vfp_forward_z
+	vmul.f32 vfp_realup_z, vfp_right_x, vfp_forward_y
+	vmls.f32 vfp_realup_z, vfp_right_y, vfp_forward_x
+
+	vmul.f32 vfp_length, vfp_realup_x, vfp_realup_x
+	vmla.f32 vfp_length, vfp_realup_y, vfp_realup_y
+	vmla.f32 vfp_length, vfp_realup_z, vfp_realup_z
+	vsqrt.f32 vfp_length, vfp_length
+	vcmp.f32 vfp_length, #0
+	vmrs apsr_nzcv, fpscr                          @ Transfer FPSCR Flags to CPSR's NZCV
+	vdivne.f32 vfp_realup_x, vfp_realup_x, vfp_length
+	vdivne.f32 vfp_realup_y, vfp_realup_y, vfp_length
+	vdivne.f32 vfp_realup_z, vfp_realup_z, vfp_length
+
+	/* Store Rotation and Translation with Row Order */
+
+	/* Rotation for Right */
+	vstr vfp_right_x, [matrix_orient]
+	vstr vfp_right_y, [matrix_orient, #4]
+	vstr vfp_right_z, [matrix_orient, #8]
+
+	/* Translation for X */
+	vmul.f32 vfp_length, vfp_cam_x, vfp_right_x
+	vmla.f32 vfp_length, vfp_cam_y, vfp_right_y
+	vmla.f32 vfp_length, vfp_cam_z, vfp_right_z
+	vneg.f32 vfp_length, vfp_length
+	vstr vfp_length, [matrix_orient, #12]
+
+	/* Rotation for Real Up */
+	vstr vfp_realup_x, [matrix_orient, #16]
+	vstr vfp_realup_y, [matrix_orient, #20]
+	vstr vfp_realup_z, [matrix_orient, #24]
+
+	/* Translation for Y */
+	vmul.f32 vfp_length, vfp_cam_x, vfp_realup_x
+	vmla.f32 vfp_length, vfp_cam_y, vfp_realup_y
+	vmla.f32 vfp_length, vfp_cam_z, vfp_realup_z
+	vneg.f32 vfp_length, vfp_length
+	vstr vfp_length, [matrix_orient, #28]
+
+	/* Rotation for Forward */
+	vneg.f32 vfp_forward_x, vfp_forward_x
+	vneg.f32 vfp_forward_y, vfp_forward_y
+	vneg.f32 vfp_forward_z, vfp_forward_z
+	vstr vfp_forward_x, [matrix_orient, #32]
+	vstr vfp_forward_y, [matrix_orient, #36]
+	vstr vfp_forward_z, [matrix_orient, #40]
+
+	/* Translation for Z */
+	vmul.f32 vfp_length, vfp_cam_x, vfp_forward_x
+	vmla.f32 vfp_length, vfp_cam_y, vfp_forward_y
+	vmla.f32 vfp_length, vfp_cam_z, vfp_forward_z
+	vneg.f32 vfp_length, vfp_length
+	vstr vfp_length, [matrix_orient, #44]
+
+	mtx32_view3d_into_common:
+		mov r0, matrix_orient
+		vpop {s0-s15}
+		pop {pc}
 
 .unreq vec_cam
-.unreq vec_realup
-.unreq vec_right
+.unreq vec_trg
+.unreq vec_up
 .unreq matrix_orient
-.unreq vec_forward
-.unreq temp
-.unreq vfp_vec_x
-.unreq vfp_vec_y
-.unreq vfp_vec_z
-.unreq vfp_vec2_x
-.unreq vfp_vec2_y
-.unreq vfp_vec2_z
-.unreq vfp_temp
+.unreq vfp_cam_x
+.unreq vfp_cam_y
+.unreq vfp_cam_z
+.unreq vfp_forward_x
+.unreq vfp_forward_y
+.unreq vfp_forward_z
+.unreq vfp_right_x
+.unreq vfp_right_y
+.unreq vfp_right_z
+.unreq vfp_realup_x
+.unreq vfp_realup_y
+.unreq vfp_realup_z
+.unreq vfp_up_x
+.unreq vfp_up_y
+.unreq vfp_up_z
+.unreq vfp_length
 
 
 /**
@@ -7,10 +7,18 @@
  *
  */
 
+/**
+ * Functions for I2C EEPROM use a static buffer, no heap allocation on each call.
+ * Writing is split at page boundaries (equ32_rom32_page_size) to stream data page by page.
+ * After writing each page, ACK polling waits for the end of the write cycle, instead of the worst-case sleep.
+ * Reading goes through the read cache (equ32_rom32_cache_lines * equ32_rom32_cache_line bytes),
+ * and writing updates lines in the cache (write-through), so repeated reading of the same region stays off the bus.
+ */
+
 
 /**
  * function rom32_romread_i2c
- * I2C EEPROM Write
+ * I2C EEPROM Read
  *
  * Parameters
  * r0: Heap to Write Data
@@ -19,7 +27,7 @@
  * r3: Length to Read (Bytes)
  *
  * Return: r0 (0 as Success, -1, 1-4 as Error)
- * Error(-1): Memory Allocation Fails
+ * Error(-1): Heap Is Not Allocated
  * Error(1): Device Address Error (Derived From I2C)
  * Error(2): Clock Stretch Timeout (Derived From I2C)
  * Error(3): Transaction Error on Checking Process (Derived From I2C)
@@ -31,10 +39,12 @@ rom32_romread_i2c:
 	chip_select     .req r1
 	addr            .req r2
 	length          .req r3
-	heap_addr       .req r4 @ Heap for Writing Address
-	temp            .req r5
+	line            .req r4 @ Pointer of Line in Read Cache
+	offset          .req r5
+	size            .req r6
+	temp            .req r7
 
-	push {r4-r5,lr}
+	push {r4-r7,lr}
 
 	push {r0-r3}
 	bl heap32_mcount
@@ -47,62 +57,49 @@ rom32_romread_i2c:
 	cmp length, temp
 	movgt length, temp                @ Prevent Overflow
 
-	push {r0-r3}
-	add r0, #1
-	bl heap32_malloc
-	mov heap_addr, r0
-	pop {r0-r3}
-
-	cmp heap_addr, #0
-	beq rom32_romread_i2c_error
-
-	/* Most Significant Word Will Be Send at First, Least Significant Word Will Be Send at Second */
-	and temp, addr, #0xFF00
-	lsr temp, temp, #8
-	strb temp, [heap_addr]
-	and temp, addr, #0xFF
-	strb temp, [heap_addr, #1]
-
 	/**
 	 * Bit[6:3] is Fixed, Bit[6:0] becomes Device Address Bit[7:1], Bit[0] is Write/Read
 	 */
+	and chip_select, chip_select, #0b111
 	orr chip_select, chip_select, #0b01010000
 
-	/* Address Write */
-	push {r0-r3}
-	mov r0, heap_addr
-	mov r2, #2
-	bl i2c32_i2ctx
-	mov temp, r0
-	pop {r0-r3}
+	lsl addr, addr, #16
+	lsr addr, addr, #16
 
-/*
-macro32_debug temp, 0, 100
-*/
+	rom32_romread_i2c_loop:
+		cmp length, #0
+		ble rom32_romread_i2c_success
 
-	cmp temp, #0
-	bne rom32_romread_i2c_common      @ If Error on I2C
+		push {r0-r3}
+		mov r0, chip_select
+		mov r1, addr
+		bl rom32_cache_fetch
+		mov line, r0
+		mov temp, r1
+		pop {r0-r3}
 
-	/* Wait for 5ms to write address */
-	push {r0-r3}
-	mov r0, #0x1400                   @ Decimal 5120
-	bl arm32_sleep
-	pop {r0-r3}
+		cmp temp, #0
+		movne r0, temp
+		bne rom32_romread_i2c_common      @ If Error on I2C
 
-	push {r0-r3}
-	mov r2, length
-	bl i2c32_i2crx
-	mov temp, r0
-	pop {r0-r3}
+		/* Bytes in Line */
+		and offset, addr, #equ32_rom32_cache_line - 1
+		rsb size, offset, #equ32_rom32_cache_line
+		cmp size, length
+		movgt size, length
 
-/*
-macro32_debug temp, 0, 112
-*/
+		add addr, addr, size
+		bic addr, addr, #0x00FF0000       @ Wrap Around Memory Address
+		sub length, length, size
 
-	cmp temp, #0
-	bne rom32_romread_i2c_common     @ If Error on I2C
+		rom32_romread_i2c_loop_copy:
+			ldrb temp, [line, offset]
+			strb temp, [heap], #1
+			add offset, offset, #1
+			subs size, size, #1
+			bgt rom32_romread_i2c_loop_copy
 
-	b rom32_romread_i2c_success
+		b rom32_romread_i2c_loop
 
 	rom32_romread_i2c_error:
 		mvn r0, #0                        @ Error With -1
@@ -112,25 +109,23 @@ macro32_debug temp, 0, 112
 		mov r0, #0
 
 	rom32_romread_i2c_common:
-		push {r0-r3}
-		mov r0, heap_addr
-		bl heap32_mfree                   @ mfree Issues Error if Address Is Null(0)
-		pop {r0-r3}
-
 		macro32_dsb ip                    @ Ensure Completion of Instructions Before
-		pop {r4-r5,pc}
+		pop {r4-r7,pc}
 
 .unreq heap
 .unreq chip_select
 .unreq addr
 .unreq length
-.unreq heap_addr
+.unreq line
+.unreq offset
+.unreq size
 .unreq temp
 
 
 /**
  * function rom32_romwrite_i2c
  * I2C EEPROM Write
+ * Data is written page by page, and the function returns after the write cycle of the last page.
  *
  * Parameters
  * r0: Heap to Write Data
@@ -138,9 +133,8 @@ macro32_debug temp, 0, 112
  * r2: Memory Address in EEPROM (Bit[15:0])
  * r3: Length to Write (Bytes)
  *
- * Return: r0 (0 as Success, -1, 1-4 as Error)
- * Error(-1): Memory Allocation Fails
- * Error(1): Device Address Error (Derived From I2C)
+ * Return: r0 (0 as Success, 1-4 as Error)
+ * Error(1): Device Address Error, or Timeout of ACK Polling (Derived From I2C)
  * Error(2): Clock Stretch Timeout (Derived From I2C)
  * Error(3): Transaction Error on Checking Process (Derived From I2C)
  */
@@ -151,95 +145,346 @@ rom32_romwrite_i2c:
 	chip_select     .req r1
 	addr            .req r2
 	length          .req r3
-	heap_addr       .req r4 @ Heap for Writing Address
-	temp            .req r5
+	buffer          .req r4 @ Address and Data of One Page
+	size            .req r5
+	temp            .req r6
+	dst             .req r7
+	byte            .req r8
 
-	push {r4-r5,lr}
+	push {r4-r8,lr}
 
-	tst length, #0b11                 @ Check Bit[1:0]
-	addne temp, length, #0b100        @ Add 4 If Value Exists on Bit[1:0]
-	moveq temp, length
+	/**
+	 * Bit[6:3] is Fixed, Bit[6:0] becomes Device Address Bit[7:1], Bit[0] is Write/Read
+	 */
+	and chip_select, chip_select, #0b111
+	orr chip_select, chip_select, #0b01010000
 
-	lsr temp, temp, #2                @ Substitute of Division by 4
+	lsl addr, addr, #16
+	lsr addr, addr, #16
 
-	push {r0-r3}
-	add r0, temp, #1
-	bl heap32_malloc
-	mov heap_addr, r0
-	pop {r0-r3}
+	ldr buffer, ROM32_BUFFER
 
-	cmp heap_addr, #0
-	beq rom32_romwrite_i2c_error
+	rom32_romwrite_i2c_loop:
+		cmp length, #0
+		ble rom32_romwrite_i2c_success
 
-	/* Most Significant Word Will Be Send at First, Least Significant Word Will Be Send at Second */
-	and temp, addr, #0xFF00
-	lsr temp, temp, #8
-	strb temp, [heap_addr]
-	and temp, addr, #0xFF
-	strb temp, [heap_addr, #1]
+		/* Split at Page Boundary */
+		and temp, addr, #equ32_rom32_page_size - 1
+		rsb size, temp, #equ32_rom32_page_size
+		cmp size, length
+		movgt size, length
 
-	push {r0-r3}
-	push {length}
-	mov r2, heap
-	mov r0, heap_addr
-	mov r1, #2
-	mov r3, #0
-	bl heap32_mcopy
-	add sp, sp, #4
-	mov temp, r0
-	pop {r0-r3}
+		/* Most Significant Word Will Be Send at First, Least Significant Word Will Be Send at Second */
+		lsr temp, addr, #8
+		strb temp, [buffer]
+		strb addr, [buffer, #1]
 
-	cmp temp, #0
-	beq rom32_romwrite_i2c_error      @ If Error on Memory Copy
+		add dst, buffer, #2
+		mov temp, size
 
-	/**
-	 * Bit[6:3] is Fixed, Bit[6:0] becomes Device Address Bit[7:1], Bit[0] is Write/Read
-	 */
-	orr chip_select, chip_select, #0b01010000
+		rom32_romwrite_i2c_loop_copy:
+			ldrb byte, [heap], #1
+			strb byte, [dst], #1
+			subs temp, temp, #1
+			bgt rom32_romwrite_i2c_loop_copy
 
-	/* Address and Data Write */
-	push {r0-r3}
-	mov r0, heap_addr
-	add r2, length, #2                @ Address Plus Data 
-	bl i2c32_i2ctx
-	mov temp, r0
-	pop {r0-r3}
+		/* Address and Data Write */
+		push {r0-r3}
+		mov r0, buffer
+		add r2, size, #2                  @ Address Plus Data
+		bl i2c32_i2ctx
+		mov temp, r0
+		pop {r0-r3}
 
-/*
-macro32_debug temp, 0, 136
-*/
+		cmp temp, #0
+		movne r0, temp
+		bne rom32_romwrite_i2c_common     @ If Error on I2C
 
-	cmp temp, #0
-	bne rom32_romwrite_i2c_common     @ If Error on I2C
+		/* Write-through to Read Cache */
+		push {r0-r3}
+		mov r0, chip_select
+		mov r1, addr
+		add r2, buffer, #2
+		mov r3, size
+		bl rom32_cache_update
+		pop {r0-r3}
 
-	/* Wait for 5ms to write address */
-	push {r0-r3}
-	mov r0, #0x1400                   @ Decimal 5120
-	bl arm32_sleep
-	pop {r0-r3}
+		add addr, addr, size
+		bic addr, addr, #0x00FF0000       @ Wrap Around Memory Address
+		sub length, length, size
 
-	b rom32_romwrite_i2c_success
+		/* Wait for Write Cycle */
+		push {r0-r3}
+		mov r0, chip_select
+		mov r1, addr
+		bl rom32_poll_i2c
+		mov temp, r0
+		pop {r0-r3}
 
-	rom32_romwrite_i2c_error:
-		mvn r0, #0                        @ Error With -1
-		b rom32_romwrite_i2c_common
+		cmp temp, #0
+		movne r0, temp
+		bne rom32_romwrite_i2c_common     @ If Error on I2C
+
+		b rom32_romwrite_i2c_loop
 
 	rom32_romwrite_i2c_success:
 		mov r0, #0
 
 	rom32_romwrite_i2c_common:
-		push {r0-r3}
-		mov r0, heap_addr
-		bl heap32_mfree                   @ mfree Issues Error if Address Is Null(0)
-		pop {r0-r3}
-
 		macro32_dsb ip                    @ Ensure Completion of Instructions Before
-		pop {r4-r5,pc}
+		pop {r4-r8,pc}
 
 .unreq heap
 .unreq chip_select
 .unreq addr
 .unreq length
-.unreq heap_addr
+.unreq buffer
+.unreq size
+.unreq temp
+.unreq dst
+.unreq byte
+
+
+/**
+ * Set Memory Address to I2C EEPROM with ACK Polling
+ * While the write cycle, the EEPROM doesn't acknowledge its device address, so retry until acknowledged.
+ *
+ * Parameters
+ * r0: Device Address
+ * r1: Memory Address in EEPROM (Bit[15:0])
+ *
+ * Return: r0 (0 as Success, 1-3 as Error, Derived From I2C)
+ */
+rom32_poll_i2c:
+	/* Auto (Local) Variables, but just Aliases */
+	addr_device     .req r0
+	addr            .req r1
+	count           .req r2
+	buffer          .req r3
+	result          .req r4
+
+	push {r4,lr}
+
+	ldr buffer, ROM32_BUFFER
+	lsr result, addr, #8
+	strb result, [buffer]
+	strb addr, [buffer, #1]
+
+	mov count, #equ32_rom32_poll_count
+
+	rom32_poll_i2c_loop:
+		push {r0-r3}
+		mov r1, addr_device
+		mov r0, buffer
+		mov r2, #2
+		bl i2c32_i2ctx
+		mov result, r0
+		pop {r0-r3}
+
+		cmp result, #1
+		bne rom32_poll_i2c_common         @ Acknowledged or Other Error
+
+		subs count, count, #1
+		ble rom32_poll_i2c_common
+
+		push {r0-r3}
+		mov r0, #equ32_rom32_poll_interval
+		bl arm32_sleep
+		pop {r0-r3}
+
+		b rom32_poll_i2c_loop
+
+	rom32_poll_i2c_common:
+		mov r0, result
+		pop {r4,pc}
+
+.unreq addr_device
+.unreq addr
+.unreq count
+.unreq buffer
+.unreq result
+
+
+/**
+ * Fetch Line of Read Cache, Read from I2C EEPROM on Miss
+ *
+ * Parameters
+ * r0: Device Address
+ * r1: Memory Address in EEPROM (Bit[15:0])
+ *
+ * Return: r0 (Pointer of Line), r1 (0 as Success, 1-3 as Error, Derived From I2C)
+ */
+rom32_cache_fetch:
+	/* Auto (Local) Variables, but just Aliases */
+	addr_device     .req r0
+	addr            .req r1
+	tag             .req r2
+	i               .req r3
+	tags            .req r4
+	temp            .req r5
+	line            .req r6
+
+	push {r4-r6,lr}
+
+	bic addr, addr, #equ32_rom32_cache_line - 1
+	orr tag, addr, addr_device, lsl #16
+	orr tag, tag, #0x80000000         @ Valid
+
+	ldr tags, ROM32_CACHE_TAGS
+	mov i, #0
+
+	rom32_cache_fetch_search:
+		cmp i, #equ32_rom32_cache_lines
+		bhs rom32_cache_fetch_miss
+		ldr temp, [tags, i, lsl #2]
+		cmp temp, tag
+		beq rom32_cache_fetch_hit
+		add i, i, #1
+		b rom32_cache_fetch_search
+
+	rom32_cache_fetch_miss:
+		/* Replace in Round Robin */
+		ldr i, rom32_cache_victim
+		add temp, i, #1
+		and temp, temp, #equ32_rom32_cache_lines - 1
+		str temp, rom32_cache_victim
+
+		mov temp, #0
+		str temp, [tags, i, lsl #2]       @ Invalid Until Filled
+
+		ldr line, ROM32_CACHE_DATA
+		mov temp, #equ32_rom32_cache_line
+		mla line, i, temp, line
+
+		push {r0-r3}
+		bl rom32_poll_i2c
+		mov temp, r0
+		pop {r0-r3}
+
+		cmp temp, #0
+		bne rom32_cache_fetch_error
+
+		push {r0-r3}
+		mov r1, addr_device
+		mov r0, line
+		mov r2, #equ32_rom32_cache_line
+		bl i2c32_i2crx
+		mov temp, r0
+		pop {r0-r3}
+
+		cmp temp, #0
+		bne rom32_cache_fetch_error
+
+		str tag, [tags, i, lsl #2]
+		b rom32_cache_fetch_success
+
+	rom32_cache_fetch_hit:
+		ldr line, ROM32_CACHE_DATA
+		mov temp, #equ32_rom32_cache_line
+		mla line, i, temp, line
+		b rom32_cache_fetch_success
+
+	rom32_cache_fetch_error:
+		mov r0, #0
+		mov r1, temp
+		b rom32_cache_fetch_common
+
+	rom32_cache_fetch_success:
+		mov r0, line
+		mov r1, #0
+
+	rom32_cache_fetch_common:
+		pop {r4-r6,pc}
+
+.unreq addr_device
+.unreq addr
+.unreq tag
+.unreq i
+.unreq tags
+.unreq temp
+.unreq line
+
+
+/**
+ * Write-through to Read Cache, Only Lines in Cache Are Updated
+ *
+ * Parameters
+ * r0: Device Address
+ * r1: Memory Address in EEPROM (Bit[15:0])
+ * r2: Pointer of Data
+ * r3: Length (Bytes)
+ *
+ * Return: r0 (0 as Success)
+ */
+rom32_cache_update:
+	/* Auto (Local) Variables, but just Aliases */
+	addr_device     .req r0
+	addr            .req r1
+	data            .req r2
+	length          .req r3
+	tags            .req r4
+	i               .req r5
+	tag             .req r6
+	temp            .req r7
+
+	push {r4-r7,lr}
+
+	ldr tags, ROM32_CACHE_TAGS
+
+	rom32_cache_update_loop:
+		cmp length, #0
+		ble rom32_cache_update_common
+
+		bic tag, addr, #equ32_rom32_cache_line - 1
+		orr tag, tag, addr_device, lsl #16
+		orr tag, tag, #0x80000000         @ Valid
+
+		mov i, #0
+
+		rom32_cache_update_loop_search:
+			cmp i, #equ32_rom32_cache_lines
+			bhs rom32_cache_update_loop_next
+			ldr temp, [tags, i, lsl #2]
+			cmp temp, tag
+			addne i, i, #1
+			bne rom32_cache_update_loop_search
+
+			ldr tag, ROM32_CACHE_DATA
+			mov temp, #equ32_rom32_cache_line
+			mla tag, i, temp, tag
+			and temp, addr, #equ32_rom32_cache_line - 1
+			add tag, tag, temp
+			ldrb temp, [data]
+			strb temp, [tag]
+
+		rom32_cache_update_loop_next:
+			add data, data, #1
+			add addr, addr, #1
+			bic addr, addr, #0x00FF0000   @ Wrap Around Memory Address
+			sub length, length, #1
+			b rom32_cache_update_loop
+
+	rom32_cache_update_common:
+		mov r0, #0
+		pop {r4-r7,pc}
+
+.unreq addr_device
+.unreq addr
+.unreq data
+.unreq length
+.unreq tags
+.unreq i
+.unreq tag
 .unreq temp
 
+rom32_cache_victim: .word 0x00
+ROM32_BUFFER:       .word rom32_buffer
+ROM32_CACHE_TAGS:   .word rom32_cache_tags
+ROM32_CACHE_DATA:   .word rom32_cache_data
+.section	.data
+.balign 4
+rom32_buffer:       .space 2 + equ32_rom32_page_size, 0x00 @ Memory Address and Data of One Page
+.balign 4
+rom32_cache_tags:   .space 4 * equ32_rom32_cache_lines, 0x00 @ Bit[31] Valid, Bit[22:16] Device Address, Bit[15:0] Memory Address
+rom32_cache_data:   .space equ32_rom32_cache_line * equ32_rom32_cache_lines, 0x00
+.section	.library_system32
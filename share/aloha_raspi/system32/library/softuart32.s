@@ -33,6 +33,12 @@
  * Plus, 1.25 percents of error should be reduced because of other factors to increase error.
  */
 
+/**
+ * softuart32_softuartreceiver samples one pin on each call of a timer interrupt.
+ * To receive higher baud rates or several pins without the interrupt,
+ * capture GPLEV0 by DMA and decode it on the main loop with share/include/softuart32/capture.c.
+ */
+
 /**
  * function softuart32_pop
  * Pop for Software UART
@@ -390,6 +390,20 @@ sts32_synthewave_pwm:
 				/* Get Time (Seconds) */
 				vdiv.f32 vfp_time, vfp_time, vfp_samplerate
 
+				/* Apply MIDI Events Due on This Sample */
+				ldr temp, STS32_SYNTHEWAVE_SAMPLES
+				add temp, temp, #1
+				str temp, STS32_SYNTHEWAVE_SAMPLES
+				ldr offset_param, STS32_SYNTHEWAVE_DUE
+				subs temp, temp, offset_param
+				bmi sts32_synthewave_pwm_loop             @ If Not Due
+
+				push {r0-r3}
+				bl sts32_synthemidi_dispatch
+				pop {r0-r3}
+
+				ldr status_voices, STS32_VOICES             @ Reload Status Changed by MIDI Events
+
 				b sts32_synthewave_pwm_loop
 
 	sts32_synthewave_pwm_error1:
@@ -753,6 +767,20 @@ sts32_synthewave_i2s:
 				/* Get Time (Seconds) */
 				vdiv.f32 vfp_time, vfp_time, vfp_samplerate
 
+				/* Apply MIDI Events Due on This Sample */
+				ldr temp, STS32_SYNTHEWAVE_SAMPLES
+				add temp, temp, #1
+				str temp, STS32_SYNTHEWAVE_SAMPLES
+				ldr offset_param, STS32_SYNTHEWAVE_DUE
+				subs temp, temp, offset_param
+				bmi sts32_synthewave_i2s_loop             @ If Not Due
+
+				push {r0-r3}
+				bl sts32_synthemidi_dispatch
+				pop {r0-r3}
+
+				ldr status_voices, STS32_VOICES             @ Reload Status Changed by MIDI Events
+
 				b sts32_synthewave_i2s_loop
 
 	sts32_synthewave_i2s_error1:
@@ -791,6 +819,9 @@ sts32_synthewave_i2s:
 sts32_synthewave_MATH32_PI_DOUBLE: .word MATH32_PI_DOUBLE
 
 STS32_SYNTHEWAVE_TIME:   .word 0x00 @ One Equals 1/sampling-rate Seconds
+.globl STS32_SYNTHEWAVE_SAMPLES
+STS32_SYNTHEWAVE_SAMPLES: .word 0x00 @ Free-running Count of Samples, Timestamp of MIDI Events
+STS32_SYNTHEWAVE_DUE:    .word 0x7FFFFFFF @ Timestamp of Next MIDI Event
 STS32_SYNTHEWAVE_RL:     .word 0x00 @ 0 as R, 1 as L, Only on PWM
 STS32_SYNTHEWAVE_PARAM:  .word STS32_SYNTHEWAVE_FREQA_L
 STS32_SYNTHEWAVE_TONE_R: .float 0.0
@@ -881,6 +912,29 @@ sts32_syntheset:
 .unreq status
 
 
+/**
+ * function sts32_synthesetpre
+ * Set Synthesizer with Pre-code
+ * Synthesizer code is made from pre-code on each beat by sts32_syntheplay without decoding in advance.
+ *
+ * Parameters
+ * r0: Pointer of Array of Sequences of Synthesizer Pre-code (Two Dimentional, L and R Alternatively)
+ * r1: Length (Maximum Number of Beats in Sequences, Use sts32_synthebeatlenlr)
+ * r2: Count (Offset)
+ * r3: Number of Repeat, If -1, Infinite Loop
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error(1): Failure of Setting (Pointer of Pre-code is Addressed to Zero or Length is Zero)
+ */
+.globl sts32_synthesetpre
+sts32_synthesetpre:
+	cmp r0, #0
+	moveq r0, #1
+	moveq pc, lr                               @ Return with Error 1
+	orr r0, r0, #1                             @ Bit[0] as Flag of Pre-code, Array of Pointers Is Word Aligned
+	b sts32_syntheset
+
+
 /**
  * function sts32_syntheplay
  * Play Synthesizer
@@ -986,6 +1040,46 @@ sts32_syntheplay:
 		offset_param .req r5
 
 	sts32_syntheplay_encode:
+		/* If Pre-code, Make Synthesizer Code on Current Beat for Each Voice */
+		tst addr_code, #1
+		beq sts32_syntheplay_encode_constant
+
+		bic addr_code, addr_code, #1
+
+		mov code, #0
+		sts32_syntheplay_encode_pre:
+			cmp code, num_voices
+			bhs sts32_syntheplay_encode_pre_common
+			add temp, offset_voice, code
+			cmp temp, #equ32_sts32_voice_max
+			bhs sts32_syntheplay_encode_pre_common
+
+			ldr addr_param, STS32_SYNTHEPRE_STATE_ADDR
+			add addr_param, addr_param, temp, lsl #6   @ Multiply by 64, 16 Words for Each Voice
+			ldr offset_param, [addr_code, code, lsl #2] @ Pre-code for The Voice
+
+			push {r0-r3}
+			mov r0, addr_param
+			mov r1, offset_param
+			mov r2, count
+			bl sts32_synthepre
+			ldr temp, STS32_SYNTHEPRE_CODE_ADDR
+			add temp, temp, code, lsl #3               @ Multiply by 8, One Synthesizer Code on Each Voice Has Two Words
+			str r0, [temp]
+			str r1, [temp, #4]
+			pop {r0-r3}
+
+			add code, code, #1
+			b sts32_syntheplay_encode_pre
+
+		sts32_syntheplay_encode_pre_common:
+			/* Cancel Offset by Count on Following Process */
+			ldr addr_code, STS32_SYNTHEPRE_CODE_ADDR
+			lsl temp, num_voices, #3                   @ Multiply by 8 to Make Stride
+			mul temp, count, temp
+			sub addr_code, addr_code, temp
+
+	sts32_syntheplay_encode_constant:
 		/* Hard Code of Single Precision Float 0.125 */
 		mov temp, #0x3E000000
 		vmov vfp_eighth, temp
@@ -1149,6 +1243,12 @@ sts32_syntheplay:
 .unreq vfp_fraction
 
 sts32_syntheplay_MATH32_PI_DOUBLE: .word MATH32_PI_DOUBLE
+STS32_SYNTHEPRE_CODE_ADDR:         .word STS32_SYNTHEPRE_CODE
+STS32_SYNTHEPRE_STATE_ADDR:        .word STS32_SYNTHEPRE_STATE
+.section	.data
+STS32_SYNTHEPRE_CODE:              .space 8 * equ32_sts32_voice_max, 0x00  @ Synthesizer Code on Current Beat Made from Pre-code
+STS32_SYNTHEPRE_STATE:             .space 64 * equ32_sts32_voice_max, 0x00 @ State of Each Voice to Make Synthesizer Code from Pre-code
+.section	.library_system32
 
 
 /**
@@ -1561,6 +1661,27 @@ sts32_syntheinit_i2s:
  */
 .globl sts32_synthemidi
 sts32_synthemidi:
+	mvn r3, #0                        @ -1 as Receiving Byte on UART
+
+
+/**
+ * function sts32_synthemidi_byte
+ * MIDI Handler with One Byte
+ * sts32_synthemidi is this function receiving the byte on UART.
+ *
+ * Parameters
+ * r0: Channel, 0-15 (MIDI Channel No. 1 to 16)
+ * r1: 0 as PWM Mode, 1 as PCM Mode
+ * r2: Number of Voices
+ * r3: Byte of MIDI Message, -1 as Receiving Byte on UART
+ *
+ * Return: r0 (0 as success, 1, 2, and 3 as error)
+ * Error(1): Not Initialized on sts32_syntheinit_*, No Buffer to Receive on UART, or UART Overrun
+ * Error(2): Character Is Not Received
+ * Error(3): MIDI Channel is Not Matched, or Only Data Bytes Received
+ */
+.globl sts32_synthemidi_byte
+sts32_synthemidi_byte:
 	/* Auto (Local) Variables, but just Aliases */
 	channel        .req r0
 	mode           .req r1
@@ -1588,6 +1709,8 @@ sts32_synthemidi:
 	cmp num_voices, #equ32_sts32_voice_max
 	movhi num_voices, #equ32_sts32_voice_max
 
+	mov byte, count                   @ Byte of MIDI Message or -1
+
 	ldr status, STS32_STATUS
 	ldr count, STS32_SYNTHEMIDI_COUNT
 	ldr max_size, STS32_SYNTHEMIDI_LENGTH
@@ -1604,6 +1727,10 @@ sts32_synthemidi:
 
 	ldr bytebuffer, STS32_SYNTHEMIDI_BYTEBUFFER
 
+	cmn byte, #1
+	strneb byte, [bytebuffer]
+	bne sts32_synthemidi_received     @ If Byte Is Given
+
 	push {r0-r3}
 	mov r0, bytebuffer
 	mov r1, #1                        @ 1 Bytes
@@ -1617,6 +1744,8 @@ sts32_synthemidi:
 	tst temp, #0x10                   @ Whether Not Received or So
 	bne sts32_synthemidi_error2       @ If Not Received
 
+	sts32_synthemidi_received:
+
 	/* Check Whether Status or Data Bytes */
 	ldrb byte, [bytebuffer]
 
@@ -1751,105 +1880,103 @@ sts32_synthemidi:
 		cmp channel, #equ32_sts32_synthemidi_percussion_ch
 		beq sts32_synthemidi_noteon_percussion
 
-		mov voices, #0
-		sts32_synthemidi_noteon_voicesearch:
-			cmp voices, num_voices
-			bhs sts32_synthemidi_noteon_common
-
-			/* Test Whether The Voice Is under Any Usage with MIDI or Synthesizer Code, or Not */
-			lsl temp, voices, #2               @ Multiply by 4
-			mov temp2, #0b1111
-			lsl temp2, temp2, temp
-			tst status_voices, temp2
-			bne sts32_synthemidi_noteon_voicesearch_common
-
-			/* Set Attack */
-			mov temp2, #0b1
-			lsl temp2, temp2, temp
-			orr status_voices, status_voices, temp2
-
-			/* Store Concurrent Notes */
-			ldr temp, STS32_SYNTHEMIDI_CURRENTNOTE
-			strb data1, [temp, voices]
-
-			/* Set Main Frequency from Table of Notes */
-			ldr temp, STS32_SYNTHEMIDI_TABLENOTES
-			lsl data1, data1, #2               @ Multiply by 4, Array of Single Precision Float
-			ldr data1, [temp, data1]
-			lsl temp2, voices, #4              @ Multiply by 16
-			ldr temp, STS32_SYNTHEWAVE_PARAM
-			str data1, [temp, temp2]           @ Main Frequency
-			add temp2, temp2, #4
-
-			/* Set Main Amplitude as Zero */
-			mov byte, #0
-			str byte, [temp, temp2]            @ Main Amplitude
-			add temp2, temp2, #4
-
-			/* Set Sub Frequency from Parameter, Round to Nearest 0.125 */
-			vmov vfp_temp, data1
-			ldr data1, STS32_SYNTHEMIDI_SUBPITCH
-			vmov vfp_temp2, data1
-			vmul.f32 vfp_temp, vfp_temp, vfp_temp2
-			mov data1, #0x3E000000             @ Hard Code 0.125 in Float
-			vmov vfp_temp2, data1
-			vdiv.f32 vfp_temp, vfp_temp, vfp_temp2
-			vcvtr.u32.f32 vfp_temp, vfp_temp
-			vcvt.f32.u32 vfp_temp, vfp_temp
-			vmul.f32 vfp_temp, vfp_temp, vfp_temp2
-			vmov data1, vfp_temp
-			str data1, [temp, temp2]           @ Sub Frequency
-			add temp2, temp2, #4
+		/* Allocate Voice, Free, Same Note, or Stolen */
+		push {r0-r3}
+		mov r0, data1
+		mov r1, num_voices
+		bl sts32_synthemidi_voicealloc
+		mov voices, r0
+		pop {r0-r3}
 
-			/* Set Sub Amplitude from Parameter */
-			ldr data1, STS32_SYNTHEMIDI_SUBAMP
-			str data1, [temp, temp2]           @ Sub Amplitude
+		cmn voices, #1
+		beq sts32_synthemidi_noteon_common
+
+		/* Clear Status of The Voice If Stolen or Retriggered, and Set Attack */
+		lsl temp, voices, #2               @ Multiply by 4
+		mov temp2, #0b111
+		lsl temp2, temp2, temp
+		bic status_voices, status_voices, temp2
+		mov temp2, #0b1
+		lsl temp2, temp2, temp
+		orr status_voices, status_voices, temp2
+
+		/* Store Concurrent Notes */
+		ldr temp, STS32_SYNTHEMIDI_CURRENTNOTE
+		strb data1, [temp, voices]
+
+		/* Set Main Frequency from Table of Notes */
+		ldr temp, STS32_SYNTHEMIDI_TABLENOTES
+		lsl data1, data1, #2               @ Multiply by 4, Array of Single Precision Float
+		ldr data1, [temp, data1]
+		lsl temp2, voices, #4              @ Multiply by 16
+		ldr temp, STS32_SYNTHEWAVE_PARAM
+		str data1, [temp, temp2]           @ Main Frequency
+		add temp2, temp2, #4
+
+		/* Set Main Amplitude as Zero */
+		mov byte, #0
+		str byte, [temp, temp2]            @ Main Amplitude
+		add temp2, temp2, #4
+
+		/* Set Sub Frequency from Parameter, Round to Nearest 0.125 */
+		vmov vfp_temp, data1
+		ldr data1, STS32_SYNTHEMIDI_SUBPITCH
+		vmov vfp_temp2, data1
+		vmul.f32 vfp_temp, vfp_temp, vfp_temp2
+		mov data1, #0x3E000000             @ Hard Code 0.125 in Float
+		vmov vfp_temp2, data1
+		vdiv.f32 vfp_temp, vfp_temp, vfp_temp2
+		vcvtr.u32.f32 vfp_temp, vfp_temp
+		vcvt.f32.u32 vfp_temp, vfp_temp
+		vmul.f32 vfp_temp, vfp_temp, vfp_temp2
+		vmov data1, vfp_temp
+		str data1, [temp, temp2]           @ Sub Frequency
+		add temp2, temp2, #4
 
-			/**
-			 * Make Deltas
-			 */
+		/* Set Sub Amplitude from Parameter */
+		ldr data1, STS32_SYNTHEMIDI_SUBAMP
+		str data1, [temp, temp2]           @ Sub Amplitude
 
-			/* Make Maximum Volume with Floating Point */
-			ldr temp, STS32_SYNTHEMIDI_VOLUME
-			mul data2, data2, temp
-			vmov vfp_volume, data2
-			vcvt.f32.u32 vfp_volume, vfp_volume
+		/**
+		 * Make Deltas
+		 */
 
-			/* Make Envelope Pointer for The Voice */
-			lsl temp2, voices, #4              @ Multiply by 16
-			ldr temp, STS32_SYNTHEMIDI_ENVELOPE
-			add temp, temp, temp2
+		/* Make Maximum Volume with Floating Point */
+		ldr temp, STS32_SYNTHEMIDI_VOLUME
+		mul data2, data2, temp
+		vmov vfp_volume, data2
+		vcvt.f32.u32 vfp_volume, vfp_volume
 
-			/* Store Count to Envelope Pointer */
-			mov data1, #0
-			str data1, [temp]
-			add temp, temp, #4
+		/* Make Envelope Pointer for The Voice */
+		lsl temp2, voices, #4              @ Multiply by 16
+		ldr temp, STS32_SYNTHEMIDI_ENVELOPE
+		add temp, temp, temp2
 
-			/* Store Delta for Attack to Envelope Pointer */
-			ldr data1, STS32_SYNTHEMIDI_ATTACK
-			vmov vfp_temp, data1
-			vcvt.f32.u32 vfp_temp, vfp_temp
-			vdiv.f32 vfp_temp, vfp_volume, vfp_temp
-			vstr vfp_temp, [temp]
-			add temp, temp, #4
-
-			/* Store Delta for Decay to Envelope Pointer */
-			ldr data1, STS32_SYNTHEMIDI_SUSTAIN
-			vmov vfp_temp, data1
-			vmul.f32 vfp_sustain, vfp_volume, vfp_temp
-			vsub.f32 vfp_temp2, vfp_volume, vfp_sustain
-			ldr data1, STS32_SYNTHEMIDI_DECAY
-			vmov vfp_temp, data1
-			vcvt.f32.u32 vfp_temp, vfp_temp
-			vdiv.f32 vfp_temp, vfp_temp2, vfp_temp
-			vstr vfp_temp, [temp]
+		/* Store Count to Envelope Pointer */
+		mov data1, #0
+		str data1, [temp]
+		add temp, temp, #4
 
-			/* Break Loop */
-			b sts32_synthemidi_noteon_common
+		/* Store Delta for Attack to Envelope Pointer */
+		ldr data1, STS32_SYNTHEMIDI_ATTACK
+		vmov vfp_temp, data1
+		vcvt.f32.u32 vfp_temp, vfp_temp
+		vdiv.f32 vfp_temp, vfp_volume, vfp_temp
+		vstr vfp_temp, [temp]
+		add temp, temp, #4
+
+		/* Store Delta for Decay to Envelope Pointer */
+		ldr data1, STS32_SYNTHEMIDI_SUSTAIN
+		vmov vfp_temp, data1
+		vmul.f32 vfp_sustain, vfp_volume, vfp_temp
+		vsub.f32 vfp_temp2, vfp_volume, vfp_sustain
+		ldr data1, STS32_SYNTHEMIDI_DECAY
+		vmov vfp_temp, data1
+		vcvt.f32.u32 vfp_temp, vfp_temp
+		vdiv.f32 vfp_temp, vfp_temp2, vfp_temp
+		vstr vfp_temp, [temp]
 
-			sts32_synthemidi_noteon_voicesearch_common:
-				add voices, voices, #1
-				b sts32_synthemidi_noteon_voicesearch
+		b sts32_synthemidi_noteon_common
 
 		sts32_synthemidi_noteon_percussion:
 			/* Virtual Parallel of Coconuts */
@@ -2497,6 +2624,8 @@ STS32_DIGITALMOD_MIN:            .float 0.8
 STS32_DIGITALMOD_MEDIUM:         .float 1.0
 .globl STS32_TONE
 STS32_TONE:                      .float 0.0
+.globl STS32_SYNTHEMIDI_STEAL
+STS32_SYNTHEMIDI_STEAL:          .word equ32_sts32_synthemidi_steal_oldest|equ32_sts32_synthemidi_steal_retrigger
 .section	.library_system32
 
 
@@ -2572,6 +2701,593 @@ sts32_synthemidi_malloc:
 .unreq buffer
 
 
+/**
+ * function sts32_synthemidi_voicealloc
+ * Allocate Voice for Note On Event from MIDI IN
+ * Voices are scanned one by one with the status of each voice on STS32_VOICES,
+ * and voices turned on are held as the age-ordered list of bytes, one byte per voice.
+ * So, the number of voices is limited by equ32_sts32_voice_max only, not by packing of the list.
+ * If the same note is sounding and retrigger is set on STS32_SYNTHEMIDI_STEAL, the voice is reused.
+ * If no voice is free, a voice under MIDI usage is stolen by the policy on STS32_SYNTHEMIDI_STEAL.
+ * Voices under usage with synthesizer code are never stolen.
+ *
+ * Parameters
+ * r0: Note Number
+ * r1: Number of Voices
+ *
+ * Return: r0 (Voice Number, -1 as error)
+ * Error(-1): No Voice to Be Allocated
+ */
+.globl sts32_synthemidi_voicealloc
+sts32_synthemidi_voicealloc:
+	/* Auto (Local) Variables, but just Aliases */
+	note           .req r0
+	voice          .req r1
+	status         .req r2
+	temp           .req r3
+	retrigger      .req r4
+	free           .req r5
+	quietest       .req r6
+	amplitude      .req r7
+	policy         .req r8
+	addr_voices    .req r9
+	addr_notes     .req r10
+	addr_param     .req r11
+	temp2          .req r12
+
+	push {r4-r11}
+
+	ldr policy, STS32_SYNTHEMIDI_STEAL_ADDR
+	ldr policy, [policy]
+	ldr addr_voices, STS32_SYNTHEMIDI_VOICEALLOC_VOICES
+	ldr addr_notes, STS32_SYNTHEMIDI_CURRENTNOTE
+	ldr addr_param, STS32_SYNTHEMIDI_VOICEALLOC_PARAM
+
+	cmp voice, #equ32_sts32_voice_max
+	movhi voice, #equ32_sts32_voice_max
+
+	mvn retrigger, #0
+	mvn free, #0
+	mvn quietest, #0
+	mvn amplitude, #0
+
+	/* Scan from Last Voice, Each Status Is Nibble on STS32_VOICES */
+	sts32_synthemidi_voicealloc_scan:
+		subs voice, voice, #1
+		blo sts32_synthemidi_voicealloc_select
+
+		ldrb status, [addr_voices, voice, lsr #1]
+		tst voice, #1
+		lsrne status, status, #4
+		and status, status, #0xF
+
+		cmp status, #0
+		bne sts32_synthemidi_voicealloc_scan_used
+
+		cmn free, #1
+		moveq free, voice
+		b sts32_synthemidi_voicealloc_scan
+
+		sts32_synthemidi_voicealloc_scan_used:
+			/* Exclude Voices under Synthesizer Code, Bit[3] of Each Nibble */
+			tst status, #0b1000
+			bne sts32_synthemidi_voicealloc_scan
+
+			/* Same Note Retrigger */
+			cmn retrigger, #1
+			bne sts32_synthemidi_voicealloc_scan_used_quietest
+			tst policy, #equ32_sts32_synthemidi_steal_retrigger
+			beq sts32_synthemidi_voicealloc_scan_used_quietest
+			ldrb temp, [addr_notes, voice]
+			cmp temp, note
+			moveq retrigger, voice
+
+			sts32_synthemidi_voicealloc_scan_used_quietest:
+				/* Main Amplitude Is Positive Single Precision Float, Comparable as Unsigned Integer */
+				add temp, addr_param, voice, lsl #4   @ Multiply by 16
+				ldr temp, [temp, #4]                  @ Main Amplitude
+				cmp temp, amplitude
+				movlo amplitude, temp
+				movlo quietest, voice
+
+				b sts32_synthemidi_voicealloc_scan
+
+	sts32_synthemidi_voicealloc_select:
+		mov voice, retrigger
+		cmn voice, #1
+		bne sts32_synthemidi_voicealloc_success
+
+		mov voice, free
+		cmn voice, #1
+		bne sts32_synthemidi_voicealloc_success    @ If Free Voice
+
+		tst policy, #equ32_sts32_synthemidi_steal_quietest
+		movne voice, quietest
+		bne sts32_synthemidi_voicealloc_select_common
+
+		tst policy, #equ32_sts32_synthemidi_steal_oldest
+		beq sts32_synthemidi_voicealloc_error
+
+		/* Oldest Voice under MIDI Usage from Head of List */
+		adr addr_notes, STS32_SYNTHEMIDI_ORDER
+		ldr temp2, STS32_SYNTHEMIDI_ORDER_COUNT
+		mov temp, #0
+
+		sts32_synthemidi_voicealloc_select_oldest:
+			cmp temp, temp2
+			bhs sts32_synthemidi_voicealloc_error
+
+			ldrb voice, [addr_notes, temp]
+			add temp, temp, #1
+
+			ldrb status, [addr_voices, voice, lsr #1]
+			tst voice, #1
+			lsrne status, status, #4
+			and status, status, #0xF
+
+			cmp status, #0
+			beq sts32_synthemidi_voicealloc_select_oldest
+			tst status, #0b1000
+			bne sts32_synthemidi_voicealloc_select_oldest
+
+			b sts32_synthemidi_voicealloc_success
+
+		sts32_synthemidi_voicealloc_select_common:
+			cmn voice, #1
+			beq sts32_synthemidi_voicealloc_error
+
+	sts32_synthemidi_voicealloc_success:
+		/**
+		 * Renew Age-ordered List, Oldest on First Byte
+		 */
+		adr addr_notes, STS32_SYNTHEMIDI_ORDER
+		ldr temp2, STS32_SYNTHEMIDI_ORDER_COUNT
+
+		/* Remove Voice from List, Slide Down Bytes after Voice */
+		mov temp, #0
+		sts32_synthemidi_voicealloc_success_remove:
+			cmp temp, temp2
+			bhs sts32_synthemidi_voicealloc_success_append
+
+			ldrb status, [addr_notes, temp]
+			add temp, temp, #1
+			cmp status, voice
+			bne sts32_synthemidi_voicealloc_success_remove
+
+			sts32_synthemidi_voicealloc_success_remove_slide:
+				cmp temp, temp2
+				bhs sts32_synthemidi_voicealloc_success_remove_common
+
+				ldrb status, [addr_notes, temp]
+				sub temp, temp, #1
+				strb status, [addr_notes, temp]
+				add temp, temp, #2
+				b sts32_synthemidi_voicealloc_success_remove_slide
+
+			sts32_synthemidi_voicealloc_success_remove_common:
+				sub temp2, temp2, #1
+
+		sts32_synthemidi_voicealloc_success_append:
+			cmp temp2, #equ32_sts32_voice_max
+			bhs sts32_synthemidi_voicealloc_success_common
+
+			strb voice, [addr_notes, temp2]
+			add temp2, temp2, #1
+
+		sts32_synthemidi_voicealloc_success_common:
+			str temp2, STS32_SYNTHEMIDI_ORDER_COUNT
+
+			mov r0, voice
+			b sts32_synthemidi_voicealloc_common
+
+	sts32_synthemidi_voicealloc_error:
+		mvn r0, #0
+
+	sts32_synthemidi_voicealloc_common:
+		macro32_dsb ip
+		pop {r4-r11}
+		mov pc, lr
+
+.unreq note
+.unreq voice
+.unreq status
+.unreq temp
+.unreq retrigger
+.unreq free
+.unreq quietest
+.unreq amplitude
+.unreq policy
+.unreq addr_voices
+.unreq addr_notes
+.unreq addr_param
+.unreq temp2
+
+STS32_SYNTHEMIDI_VOICEALLOC_VOICES: .word STS32_VOICES
+STS32_SYNTHEMIDI_VOICEALLOC_PARAM:  .word STS32_SYNTHEWAVE_FREQA_L
+STS32_SYNTHEMIDI_STEAL_ADDR:        .word STS32_SYNTHEMIDI_STEAL
+STS32_SYNTHEMIDI_ORDER_COUNT:       .word 0x00 @ Number of Voices on List
+STS32_SYNTHEMIDI_ORDER:             .space equ32_sts32_voice_max, 0x00 @ Age-ordered List of Voices, Each Byte Is Voice Number, Oldest on First Byte
+.balign 4
+
+
+/**
+ * function sts32_synthemidi_eventmalloc
+ * Make Queue for Timestamped MIDI Events
+ * Each event is two words, timestamp (STS32_SYNTHEWAVE_SAMPLES) and message (Bit[7:0] status, Bit[15:8] data 1, Bit[23:16] data 2).
+ *
+ * Parameters
+ * r0: Number of Events, Rounded Down to Power of 2
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error(1): Memory Allocation Is Not Succeeded
+ */
+.globl sts32_synthemidi_eventmalloc
+sts32_synthemidi_eventmalloc:
+	/* Auto (Local) Variables, but just Aliases */
+	number      .req r0
+	queue       .req r1
+	temp        .req r2
+
+	push {lr}
+
+	cmp number, #0
+	beq sts32_synthemidi_eventmalloc_error
+
+	clz temp, number
+	mov number, #0x80000000
+	lsr number, number, temp                      @ Round Down to Power of 2
+
+	push {r0}
+	lsl r0, number, #1                            @ Two Words for Each Event
+	bl heap32_malloc
+	mov queue, r0
+	pop {r0}
+
+	cmp queue, #0
+	beq sts32_synthemidi_eventmalloc_error
+
+	sub number, number, #1
+	str number, STS32_SYNTHEMIDI_EVENT_MASK
+	mov temp, #0
+	str temp, STS32_SYNTHEMIDI_EVENT_HEAD
+	str temp, STS32_SYNTHEMIDI_EVENT_TAIL
+	str temp, STS32_SYNTHEMIDI_EVENT_RUNNING
+	str temp, STS32_SYNTHEMIDI_EVENT_DATA
+	str temp, STS32_SYNTHEMIDI_EVENT_COUNT
+	str temp, STS32_SYNTHEMIDI_EVENT_DROPPED
+
+	macro32_dsb ip
+
+	str queue, STS32_SYNTHEMIDI_EVENT_QUEUE       @ Activate Queue at Last
+
+	b sts32_synthemidi_eventmalloc_success
+
+	sts32_synthemidi_eventmalloc_error:
+		mov r0, #1
+		b sts32_synthemidi_eventmalloc_common
+
+	sts32_synthemidi_eventmalloc_success:
+		mov r0, #0
+
+	sts32_synthemidi_eventmalloc_common:
+		macro32_dsb ip
+		pop {pc}
+
+.unreq number
+.unreq queue
+.unreq temp
+
+
+/**
+ * function sts32_synthemidi_event
+ * MIDI Parser to Queue Timestamped Events
+ * Use this function in UART interrupt. All bytes on RxFIFO are parsed without calling any function.
+ * Running status is kept, System Exclusive is skipped, and System Real Time Messages are ignored.
+ * Each event is timestamped by STS32_SYNTHEWAVE_SAMPLES plus equ32_sts32_synthemidi_latency,
+ * and is applied at the exact sample in sts32_synthewave_* through sts32_synthemidi_dispatch.
+ * sts32/midievent.c in C headers is the model of this function and sts32_synthemidi_dispatch to check on a host machine.
+ *
+ * Parameters
+ * r0: Channel, 0-15 (MIDI Channel No. 1 to 16)
+ * r1: 0 as PWM Mode, 1 as PCM Mode
+ * r2: Number of Voices
+ *
+ * Return: r0 (0 as success, 1 as error)
+ * Error(1): No Queue, or Events Are Dropped Because of Full Queue
+ */
+.globl sts32_synthemidi_event
+sts32_synthemidi_event:
+	/* Auto (Local) Variables, but just Aliases */
+	channel        .req r0
+	mode           .req r1
+	num_voices     .req r2
+	queue          .req r3
+	head           .req r4
+	tail           .req r5
+	byte           .req r6
+	running        .req r7
+	data           .req r8
+	count          .req r9
+	addr_uart      .req r10
+	temp           .req r11
+	save_cpsr      .req r12
+
+	push {r4-r11}
+
+	/* Parameters for sts32_synthemidi_dispatch */
+	str channel, STS32_SYNTHEMIDI_EVENT_CHANNEL
+	str mode, STS32_SYNTHEMIDI_EVENT_MODE
+	str num_voices, STS32_SYNTHEMIDI_EVENT_VOICES
+
+	.unreq mode
+	mask .req r1
+	.unreq num_voices
+	temp2 .req r2
+
+	ldr queue, STS32_SYNTHEMIDI_EVENT_QUEUE
+	cmp queue, #0
+	beq sts32_synthemidi_event_error
+
+	/* For Atomic Procedure with sts32_synthemidi_dispatch, Set FIQ and IRQ Disable to CPSR */
+	mrs save_cpsr, cpsr
+	orr temp, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, temp
+
+	ldr mask, STS32_SYNTHEMIDI_EVENT_MASK
+	ldr head, STS32_SYNTHEMIDI_EVENT_HEAD
+	ldr tail, STS32_SYNTHEMIDI_EVENT_TAIL
+	ldr running, STS32_SYNTHEMIDI_EVENT_RUNNING
+	ldr data, STS32_SYNTHEMIDI_EVENT_DATA
+	ldr count, STS32_SYNTHEMIDI_EVENT_COUNT
+
+	mov addr_uart, #equ32_peripherals_base
+	add addr_uart, addr_uart, #equ32_uart0_base_upper
+	add addr_uart, addr_uart, #equ32_uart0_base_lower
+
+	sts32_synthemidi_event_loop:
+		ldr temp, [addr_uart, #equ32_uart0_fr]
+		tst temp, #equ32_uart0_fr_rxfe
+		bne sts32_synthemidi_event_common          @ If Empty on RxFIFO
+
+		ldr byte, [addr_uart, #equ32_uart0_dr]     @ 12-bit Word, Bit[11:8] Is Errors
+		tst byte, #equ32_uart0_dr_oe|equ32_uart0_dr_be|equ32_uart0_dr_pe|equ32_uart0_dr_fe
+		strneb temp, [addr_uart, #equ32_uart0_rsrecr] @ Clear by Write Any
+		movne running, #0                          @ Discard Message on Error
+		bne sts32_synthemidi_event_loop
+
+		and byte, byte, #0xFF
+
+		/* If 0b11111000 and Above, System Real Time Messages Don't Affect Running Status */
+		cmp byte, #248
+		bhs sts32_synthemidi_event_loop
+
+		tst byte, #0x80
+		beq sts32_synthemidi_event_data
+
+		/* Status Byte */
+		mov count, #0
+		mov data, #0
+		mov running, byte
+
+		/* System Common Messages and System Exclusive Cancel Running Status */
+		cmp running, #0xF0
+		movhs running, #0
+		bhs sts32_synthemidi_event_loop
+
+		and temp, running, #0x0F
+		cmp temp, channel
+		movne running, #0                          @ If Channel Is Not Matched, Ignore Data Bytes
+		b sts32_synthemidi_event_loop
+
+		sts32_synthemidi_event_data:
+			cmp running, #0
+			beq sts32_synthemidi_event_loop        @ If No Status, e.g., Data of System Exclusive
+
+			lsl temp, count, #3                    @ Multiply by 8
+			orr data, data, byte, lsl temp
+			add count, count, #1
+
+			/* Program Change and Channel Pressure Have One Data Byte */
+			and temp, running, #0xF0
+			cmp temp, #0xC0
+			cmpne temp, #0xD0
+			moveq temp, #1
+			movne temp, #2
+			cmp count, temp
+			blo sts32_synthemidi_event_loop
+
+			sub temp, head, tail
+			cmp temp, mask
+			bhi sts32_synthemidi_event_data_full   @ If Full
+
+			and temp, head, mask
+			add temp, queue, temp, lsl #3          @ Multiply by 8, Two Words for Each Event
+			ldr temp2, STS32_SYNTHEWAVE_SAMPLES_ADDR
+			ldr temp2, [temp2]
+			add temp2, temp2, #equ32_sts32_synthemidi_latency
+			str temp2, [temp]                      @ Timestamp
+			orr temp2, running, data, lsl #8
+			str temp2, [temp, #4]                  @ Message
+
+			add head, head, #1
+			b sts32_synthemidi_event_data_common
+
+			sts32_synthemidi_event_data_full:
+				ldr temp, STS32_SYNTHEMIDI_EVENT_DROPPED
+				add temp, temp, #1
+				str temp, STS32_SYNTHEMIDI_EVENT_DROPPED
+
+			sts32_synthemidi_event_data_common:
+				/* Keep Running Status */
+				mov count, #0
+				mov data, #0
+				b sts32_synthemidi_event_loop
+
+	sts32_synthemidi_event_error:
+		mov r0, #1
+		b sts32_synthemidi_event_return
+
+	sts32_synthemidi_event_common:
+		str running, STS32_SYNTHEMIDI_EVENT_RUNNING
+		str data, STS32_SYNTHEMIDI_EVENT_DATA
+		str count, STS32_SYNTHEMIDI_EVENT_COUNT
+
+		macro32_dsb temp
+		str head, STS32_SYNTHEMIDI_EVENT_HEAD
+
+		/* Timestamp of Oldest Event to Be Due */
+		cmp head, tail
+		andne temp, tail, mask
+		ldrne temp, [queue, temp, lsl #3]
+		ldrne temp2, STS32_SYNTHEWAVE_DUE_ADDR
+		strne temp, [temp2]
+
+		macro32_dsb temp
+
+		/* Return CPSR */
+		msr cpsr_c, save_cpsr
+
+		ldr temp, STS32_SYNTHEMIDI_EVENT_DROPPED
+		cmp temp, #0
+		movne r0, #1
+		moveq r0, #0
+
+	sts32_synthemidi_event_return:
+		pop {r4-r11}
+		mov pc, lr
+
+.unreq channel
+.unreq mask
+.unreq temp2
+.unreq queue
+.unreq head
+.unreq tail
+.unreq byte
+.unreq running
+.unreq data
+.unreq count
+.unreq addr_uart
+.unreq temp
+.unreq save_cpsr
+
+
+/**
+ * function sts32_synthemidi_dispatch
+ * Apply MIDI Events Due on Current Sample
+ * sts32_synthewave_* calls this function when STS32_SYNTHEWAVE_SAMPLES reaches STS32_SYNTHEWAVE_DUE.
+ * Each event is applied through sts32_synthemidi_byte with parameters given on sts32_synthemidi_event.
+ *
+ * Return: r0 (0 as success)
+ */
+.globl sts32_synthemidi_dispatch
+sts32_synthemidi_dispatch:
+	/* Auto (Local) Variables, but just Aliases */
+	queue          .req r4
+	mask           .req r5
+	tail           .req r6
+	temp           .req r7
+	message        .req r8
+	save_cpsr      .req r9
+	samples        .req r10
+
+	push {r4-r10,lr}
+
+	/* For Atomic Procedure with sts32_synthemidi_event, Set FIQ and IRQ Disable to CPSR */
+	mrs save_cpsr, cpsr
+	orr temp, save_cpsr, #equ32_fiq_disable|equ32_irq_disable
+	msr cpsr_c, temp
+
+	ldr samples, STS32_SYNTHEWAVE_SAMPLES_ADDR
+	ldr samples, [samples]
+
+	ldr queue, STS32_SYNTHEMIDI_EVENT_QUEUE
+	cmp queue, #0
+	beq sts32_synthemidi_dispatch_empty
+
+	ldr mask, STS32_SYNTHEMIDI_EVENT_MASK
+	ldr tail, STS32_SYNTHEMIDI_EVENT_TAIL
+
+	sts32_synthemidi_dispatch_loop:
+		ldr temp, STS32_SYNTHEMIDI_EVENT_HEAD
+		cmp tail, temp
+		beq sts32_synthemidi_dispatch_empty
+
+		and temp, tail, mask
+		add temp, queue, temp, lsl #3           @ Multiply by 8, Two Words for Each Event
+		ldr message, [temp, #4]
+		ldr temp, [temp]                        @ Timestamp
+		subs r0, samples, temp
+		bmi sts32_synthemidi_dispatch_due       @ If Not Due Yet
+
+		add tail, tail, #1
+		str tail, STS32_SYNTHEMIDI_EVENT_TAIL
+
+		ldr r1, STS32_SYNTHEMIDI_BUFFER
+		cmp r1, #0
+		beq sts32_synthemidi_dispatch_loop      @ If Not Initialized
+
+		/* Store Message Except Last Data Byte to Buffer as Received */
+		lsr r0, message, #4                     @ Omit Channel Number
+		and r0, r0, #0x0F
+		strb r0, [r1]
+		and r0, message, #0xE0
+		cmp r0, #0xC0                           @ Program Change and Channel Pressure Have One Data Byte
+		lsrne r0, message, #8
+		strneb r0, [r1, #1]
+		movne r0, #2
+		lsrne r3, message, #16
+		moveq r0, #1
+		lsreq r3, message, #8
+		and r3, r3, #0xFF                       @ Last Data Byte
+		str r0, STS32_SYNTHEMIDI_COUNT
+
+		ldr r0, STS32_SYNTHEMIDI_EVENT_CHANNEL
+		ldr r1, STS32_SYNTHEMIDI_EVENT_MODE
+		ldr r2, STS32_SYNTHEMIDI_EVENT_VOICES
+		bl sts32_synthemidi_byte
+
+		b sts32_synthemidi_dispatch_loop
+
+	sts32_synthemidi_dispatch_empty:
+		mvn temp, #0x80000000
+		add temp, samples, temp                 @ Far Future
+
+	sts32_synthemidi_dispatch_due:
+		ldr r0, STS32_SYNTHEWAVE_DUE_ADDR
+		str temp, [r0]
+
+		macro32_dsb ip
+
+		/* Return CPSR */
+		msr cpsr_c, save_cpsr
+
+		mov r0, #0
+		pop {r4-r10,pc}
+
+.unreq queue
+.unreq mask
+.unreq tail
+.unreq temp
+.unreq message
+.unreq save_cpsr
+.unreq samples
+
+STS32_SYNTHEWAVE_SAMPLES_ADDR:    .word STS32_SYNTHEWAVE_SAMPLES
+STS32_SYNTHEWAVE_DUE_ADDR:        .word STS32_SYNTHEWAVE_DUE
+.globl STS32_SYNTHEMIDI_EVENT_DROPPED
+STS32_SYNTHEMIDI_EVENT_QUEUE:     .word 0x00
+STS32_SYNTHEMIDI_EVENT_MASK:      .word 0x00 @ Number of Events - 1
+STS32_SYNTHEMIDI_EVENT_HEAD:      .word 0x00 @ Incremented by sts32_synthemidi_event Only
+STS32_SYNTHEMIDI_EVENT_TAIL:      .word 0x00 @ Incremented by sts32_synthemidi_dispatch Only
+STS32_SYNTHEMIDI_EVENT_RUNNING:   .word 0x00 @ Running Status
+STS32_SYNTHEMIDI_EVENT_DATA:      .word 0x00 @ Data Bytes of Outstanding Message
+STS32_SYNTHEMIDI_EVENT_COUNT:     .word 0x00 @ Number of Data Bytes of Outstanding Message
+STS32_SYNTHEMIDI_EVENT_CHANNEL:   .word 0x00
+STS32_SYNTHEMIDI_EVENT_MODE:      .word 0x00
+STS32_SYNTHEMIDI_EVENT_VOICES:    .word 0x00
+STS32_SYNTHEMIDI_EVENT_DROPPED:   .word 0x00 @ Number of Events Dropped Because of Full Queue
+
+
 /**
  * function sts32_synthemidi_envelope
  * Make Envelope for Notes from MIDI IN
@@ -2871,25 +3587,10 @@ sts32_synthedecodelr:
 	/**
 	 * Get Maximum Beat Length
 	 */
-	mov beat, #0
-	mov voices, #0
-	sts32_synthedecodelr_beatlen:
-		cmp voices, num_voices
-		bhs sts32_synthedecodelr_malloc
-
-		lsl temp, voices, #2                 @ Multiply by 4
-
-		push {r0-r2}
-		ldr r0, [array_synt_pre_point, temp]
-		bl sts32_synthebeatlen
-		mov temp, r0
-		pop {r0-r2}
-
-		cmp temp, beat
-		movhi beat, temp
-
-		add voices, voices, #1
-		b sts32_synthedecodelr_beatlen
+	push {r0-r1}
+	bl sts32_synthebeatlenlr
+	mov beat, r0
+	pop {r0-r1}
 
 	sts32_synthedecodelr_malloc:
 		lsl temp, num_voices, #1             @ Multiply by 2, One Synthesizer Code on Each Voice Has Two Words (64-bit, 8 Bytes)
@@ -3279,3 +3980,348 @@ macro32_debug synt_point, 200, 60
 .unreq vfp_sustain_level
 .unreq vfp_zero
 
+
+
+/**
+ * function sts32_synthebeatlenlr
+ * Count Maximum Beats in Sequences of Synthesizer Pre-code
+ *
+ * Parameters
+ * r0: Pointer of Array of Sequences of Synthesizer Pre-code (Two Dimentional, L and R Alternatively)
+ * r1: Number of Voices
+ *
+ * Return: r0 (Maximum Number of Beats in Sequences of Synthesizer Pre-code)
+ */
+.globl sts32_synthebeatlenlr
+sts32_synthebeatlenlr:
+	/* Auto (Local) Variables, but just Aliases */
+	array_synt_pre_point .req r0
+	num_voices           .req r1
+	beat                 .req r2
+	temp                 .req r3
+	voices               .req r4
+
+	push {r4,lr}
+
+	cmp num_voices, #equ32_sts32_voice_max
+	movhi num_voices, #equ32_sts32_voice_max
+
+	mov beat, #0
+	mov voices, #0
+
+	sts32_synthebeatlenlr_loop:
+		cmp voices, num_voices
+		bhs sts32_synthebeatlenlr_common
+
+		push {r0-r2}
+		ldr r0, [array_synt_pre_point, voices, lsl #2] @ Multiply by 4
+		bl sts32_synthebeatlen
+		mov temp, r0
+		pop {r0-r2}
+
+		cmp temp, beat
+		movhi beat, temp
+
+		add voices, voices, #1
+		b sts32_synthebeatlenlr_loop
+
+	sts32_synthebeatlenlr_common:
+		mov r0, beat
+		pop {r4,pc}
+
+.unreq array_synt_pre_point
+.unreq num_voices
+.unreq beat
+.unreq temp
+.unreq voices
+
+
+/**
+ * function sts32_synthepre
+ * Make Synthesizer Code on Current Beat from Pre-code on The Fly
+ * Envelope is stepped incrementally on each beat through attack, decay, sustain, and release,
+ * and the result is the same as synthesizer code made by sts32_synthedecode.
+ * If the beat is not next to the last beat on the state, the state is reset and sought from the head of pre-code.
+ *
+ * Parameters
+ * r0: Pointer of State of Voice (16 Words)
+ * r1: Pointer of Array of Synthesizer Pre-code
+ * r2: Count (Beat) to Make
+ *
+ * Return: r0 (Lower Half of Synthesizer Code), r1 (Upper Half of Synthesizer Code)
+ */
+.globl sts32_synthepre
+sts32_synthepre:
+	/* Auto (Local) Variables, but just Aliases */
+	state             .req r0
+	synt_pre_point    .req r1
+	count             .req r2
+	temp              .req r3
+	phase             .req r4
+	remain            .req r5
+	code_lower        .req r6
+	code_upper        .req r7
+	block             .req r8
+	count_state       .req r9
+	temp2             .req r10
+	beat_length       .req r11
+
+	/* VFP Registers */
+	vfp_volume        .req s0
+	vfp_delta         .req s1
+	vfp_temp          .req s2
+	vfp_beat_length   .req s3
+	vfp_original      .req s4
+	vfp_hundred       .req s5
+	vfp_sustain_level .req s6
+
+	push {r4-r11,lr}
+	vpush {s0-s6}
+
+	/**
+	 * State of Voice
+	 * Offset 0: Pointer of Array of Synthesizer Pre-code
+	 * Offset 4: Count of Beats Made
+	 * Offset 8: Pointer of Current Block
+	 * Offset 12: Phase, 0 as Attack, 1 as Decay, 2 as Sustain, 3 as Release, 4 as End or Loading Block
+	 * Offset 16: Remaining Beats in Phase
+	 * Offset 20: Lower Half of Synthesizer Code
+	 * Offset 24: Upper Half of Synthesizer Code
+	 * Offset 28: Volume (Single Precision Float)
+	 * Offset 32: Delta for Attack (Single Precision Float)
+	 * Offset 36: Delta for Decay (Single Precision Float)
+	 * Offset 40: Delta for Release (Single Precision Float)
+	 * Offset 44: Sustain Level (Single Precision Float)
+	 * Offset 48: Decay Length
+	 * Offset 52: Sustain Length
+	 * Offset 56: Release Length
+	 */
+
+	ldr temp, [state]
+	ldr count_state, [state, #4]
+	cmp temp, synt_pre_point
+	bne sts32_synthepre_reset
+	cmp count_state, count
+	bls sts32_synthepre_load
+
+	sts32_synthepre_reset:
+		str synt_pre_point, [state]
+		mov count_state, #0
+		str synt_pre_point, [state, #8]
+		mov temp, #4
+		str temp, [state, #12]
+		mov temp, #0
+		str temp, [state, #16]
+
+	sts32_synthepre_load:
+		ldr block, [state, #8]
+		ldr phase, [state, #12]
+		ldr remain, [state, #16]
+		ldr code_lower, [state, #20]
+		ldr code_upper, [state, #24]
+		vldr vfp_volume, [state, #28]
+
+	sts32_synthepre_beat:
+		cmp remain, #0
+		bne sts32_synthepre_beat_step
+
+		cmp phase, #0
+		beq sts32_synthepre_beat_decay
+		cmp phase, #1
+		beq sts32_synthepre_beat_sustain
+		cmp phase, #2
+		beq sts32_synthepre_beat_release
+		cmp phase, #3
+		addeq block, block, #16                        @ Offset for Next Pre-block
+
+		/* Load Block, If End of Pre-code, Stay Phase 4 */
+		mov phase, #4
+		ldr code_lower, [block]
+		ldr code_upper, [block, #4]
+		cmp code_lower, #0
+		cmpeq code_upper, #0
+		beq sts32_synthepre_beat_step
+
+		/* Volume */
+		asr temp, code_lower, #17                      @ Arighmetic Logical Shift Right to Hold Signess, Bit[31:17]
+		vmov vfp_original, temp
+		vcvt.f32.s32 vfp_original, vfp_original
+
+		/* Beat Length */
+		ldr beat_length, [block, #8]
+		vmov vfp_beat_length, beat_length
+		vcvt.f32.u32 vfp_beat_length, vfp_beat_length
+
+		mov temp, #100
+		vmov vfp_hundred, temp
+		vcvt.f32.u32 vfp_hundred, vfp_hundred
+
+		/* Attack Time and Attack Delta */
+		ldrb temp, [block, #12]
+		cmp temp, #100
+		movhi temp, #100                               @ Prevent Overflow
+		vmov vfp_temp, temp
+		vcvt.f32.u32 vfp_temp, vfp_temp
+		vdiv.f32 vfp_temp, vfp_temp, vfp_hundred
+		vmul.f32 vfp_temp, vfp_beat_length, vfp_temp
+		vdiv.f32 vfp_delta, vfp_original, vfp_temp
+		vstr vfp_delta, [state, #32]
+		vcvt.u32.f32 vfp_temp, vfp_temp
+		vmov remain, vfp_temp                          @ Attack Length
+
+		/* Sustain Level */
+		ldrb temp, [block, #14]
+		cmp temp, #100
+		movhi temp, #100                               @ Prevent Overflow
+		vmov vfp_temp, temp
+		vcvt.f32.u32 vfp_temp, vfp_temp
+		vdiv.f32 vfp_temp, vfp_temp, vfp_hundred
+		vmul.f32 vfp_sustain_level, vfp_original, vfp_temp
+		vstr vfp_sustain_level, [state, #44]
+
+		/* Decay Time and Decay Delta */
+		ldrb temp, [block, #13]
+		cmp temp, #100
+		movhi temp, #100                               @ Prevent Overflow
+		vmov vfp_temp, temp
+		vcvt.f32.u32 vfp_temp, vfp_temp
+		vdiv.f32 vfp_temp, vfp_temp, vfp_hundred
+		vmul.f32 vfp_temp, vfp_beat_length, vfp_temp
+		vsub.f32 vfp_delta, vfp_original, vfp_sustain_level
+		vdiv.f32 vfp_delta, vfp_delta, vfp_temp
+		vstr vfp_delta, [state, #36]
+		vcvt.u32.f32 vfp_temp, vfp_temp
+		vmov temp2, vfp_temp                           @ Decay Length
+
+		/* Release Time and Release Delta */
+		ldrb temp, [block, #15]
+		cmp temp, #100
+		movhi temp, #100                               @ Prevent Overflow
+		vmov vfp_temp, temp
+		vcvt.f32.u32 vfp_temp, vfp_temp
+		vdiv.f32 vfp_temp, vfp_temp, vfp_hundred
+		vmul.f32 vfp_temp, vfp_beat_length, vfp_temp
+		vdiv.f32 vfp_delta, vfp_sustain_level, vfp_temp
+		vstr vfp_delta, [state, #40]
+		vcvt.u32.f32 vfp_temp, vfp_temp
+		vmov phase, vfp_temp                           @ Release Length
+
+		/* Sustain Time */
+		sub beat_length, beat_length, remain
+		sub beat_length, beat_length, temp2
+		sub beat_length, beat_length, phase
+
+		/* Check Overflow */
+		cmp beat_length, #0
+		sublt phase, phase, beat_length
+		movlt beat_length, #0
+
+		cmp phase, #0
+		sublt temp2, temp2, phase
+		movlt phase, #0
+
+		cmp temp2, #0
+		sublt remain, remain, temp2
+		movlt temp2, #0
+
+		cmp remain, #0
+		movlt remain, #0
+
+		str temp2, [state, #48]
+		str beat_length, [state, #52]
+		str phase, [state, #56]
+
+		/* Volume 0.0 and Clear Volume Bit[31:17] */
+		mov temp, #0
+		vmov vfp_volume, temp
+		bic code_lower, code_lower, #0xFF000000
+		bic code_lower, code_lower, #0x00FE0000
+
+		mov phase, #0
+		b sts32_synthepre_beat
+
+		sts32_synthepre_beat_decay:
+			ldr code_lower, [block]                    @ Retrieve Original Volume for Flat Part
+			asr temp, code_lower, #17                  @ Arighmetic Logical Shift Right to Hold Signess, Bit[31:17]
+			vmov vfp_volume, temp
+			vcvt.f32.s32 vfp_volume, vfp_volume
+			ldr remain, [state, #48]
+			mov phase, #1
+			b sts32_synthepre_beat
+
+		sts32_synthepre_beat_sustain:
+			vldr vfp_volume, [state, #44]
+			ldr remain, [state, #52]
+			mov phase, #2
+			b sts32_synthepre_beat
+
+		sts32_synthepre_beat_release:
+			ldr remain, [state, #56]
+			mov phase, #3
+			b sts32_synthepre_beat
+
+		sts32_synthepre_beat_step:
+			mov synt_pre_point, code_lower             @ Code on This Beat
+			mov temp2, code_upper
+
+			cmp phase, #4
+			beq sts32_synthepre_beat_common
+			sub remain, remain, #1
+			cmp phase, #2
+			beq sts32_synthepre_beat_common
+
+			cmp phase, #0
+			vldreq vfp_delta, [state, #32]
+			vaddeq.f32 vfp_volume, vfp_volume, vfp_delta
+			cmp phase, #1
+			vldreq vfp_delta, [state, #36]
+			vsubeq.f32 vfp_volume, vfp_volume, vfp_delta
+			cmp phase, #3
+			vldreq vfp_delta, [state, #40]
+			vsubeq.f32 vfp_volume, vfp_volume, vfp_delta
+
+			vcvtr.s32.f32 vfp_temp, vfp_volume
+			vmov temp, vfp_temp
+			lsl temp, temp, #17                        @ Bit[31:17]
+			bic code_lower, code_lower, #0xFF000000
+			bic code_lower, code_lower, #0x00FE0000
+			orr code_lower, code_lower, temp
+
+		sts32_synthepre_beat_common:
+			add count_state, count_state, #1
+			cmp count_state, count
+			bls sts32_synthepre_beat                   @ Seek Until Reaching Count
+
+	sts32_synthepre_common:
+		str count_state, [state, #4]
+		str block, [state, #8]
+		str phase, [state, #12]
+		str remain, [state, #16]
+		str code_lower, [state, #20]
+		str code_upper, [state, #24]
+		vstr vfp_volume, [state, #28]
+
+		mov r0, synt_pre_point
+		mov r1, temp2
+		vpop {s0-s6}
+		pop {r4-r11,pc}
+
+.unreq state
+.unreq synt_pre_point
+.unreq count
+.unreq temp
+.unreq phase
+.unreq remain
+.unreq code_lower
+.unreq code_upper
+.unreq block
+.unreq count_state
+.unreq temp2
+.unreq beat_length
+.unreq vfp_volume
+.unreq vfp_delta
+.unreq vfp_temp
+.unreq vfp_beat_length
+.unreq vfp_original
+.unreq vfp_hundred
+.unreq vfp_sustain_level
@@ -227,6 +227,8 @@ tft32_tftfillcolor_type1:
  * Device ID (set by an external pin) assumes as 0 in default. Device ID is the third bit of the start byte, from LSB.
  * CS of SPI assumes as No. 0 in default.
  *
+ * Pixels are sent through spi32_spidma by equ32_tft32_dma_pixels, so the CPU only swaps bytes of the next pixels.
+ *
  * Parameters
  * r0: Pointer of Image in 16-bit (2 Bytes) Color
  * r1: Size to Be Written (16-bit Half Words)
@@ -241,13 +243,50 @@ tft32_tftimage_type1:
 
 	push {lr}
 
+	mov r2, #1                              @ One Row
+	mov r3, #0                              @ Stride
+	bl tft32_tftstream_type1
+
+	tft32_tftimage_type1_common:
+		mov r0, #0
+		pop {pc}
+
+.unreq image_point
+.unreq size
+
+
+/**
+ * Write Rows of Image to GRAM from Current Address, Type 1
+ * r0: Pointer of First Pixel
+ * r1: Pixels per Row
+ * r2: Number of Rows
+ * r3: Bytes per Row of Image (Stride)
+ */
+tft32_tftstream_type1:
+	/* Auto (Local) Variables, but just Aliases */
+	image_point .req r0
+	width       .req r1
+	size        .req r2
+	stride      .req r3
+	buffer      .req r4
+	length      .req r5
+	i           .req r6
+	temp        .req r7
+	staging     .req r8
+	column      .req r9
+	row_point   .req r10
+
+	push {r4-r10,lr}
+
+	mul size, width, size
+
 	/* CS Goes Low */
-	push {r0-r1}
+	push {r0-r3}
 	mov r0, #0b11<<equ32_spi0_cs_clear|equ32_tft32_cs<<equ32_spi0_cs_cs
 	bl spi32_spistart
-	pop {r0-r1}
+	pop {r0-r3}
 
-	push {r0-r1}
+	push {r0-r3}
 	mov r0, #0x70|equ32_tft32_deviceid<<2   @ Device ID[2], Index[1], Write Bit[0]
 	lsl r0, r0, #24
 	orr r0, r0, #0x0022<<8                  @ Index 0x22
@@ -256,22 +295,22 @@ tft32_tftimage_type1:
 	bl spi32_spiwaitdone
 	mov r0, #0b10                           @ Clear RxFIFO, Dummy Bytes Are Stacked through Transmission
 	bl spi32_spiclear
-	pop {r0-r1}
+	pop {r0-r3}
 
 	/* CS Goes High */
-	push {r0-r1}
+	push {r0-r3}
 	bl spi32_spistop
-	pop {r0-r1}
+	pop {r0-r3}
 
 	macro32_dsb ip
 
 	/* CS Goes Low */
-	push {r0-r1}
+	push {r0-r3}
 	mov r0, #0b11<<equ32_spi0_cs_clear|equ32_tft32_cs<<equ32_spi0_cs_cs
 	bl spi32_spistart
-	pop {r0-r1}
+	pop {r0-r3}
 
-	push {r0-r1}
+	push {r0-r3}
 	mov r0, #0x72|equ32_tft32_deviceid<<2   @ Device ID[2], Data[1], Write Bit[0]
 	lsl r0, r0, #24
 	mov r1, #1
@@ -279,13 +318,73 @@ tft32_tftimage_type1:
 	bl spi32_spiwaitdone
 	mov r0, #0b10                           @ Clear RxFIFO, Dummy Bytes Are Stacked through Transmission
 	bl spi32_spiclear
-	pop {r0-r1}
-
-	tft32_tftimage_type1_loop:
-		subs size, size, #1
-		blo tft32_tftimage_type1_jump
-
-		push {r0-r1}
+	pop {r0-r3}
+
+	/**
+	 * Pixels Are Swapped to Big Endian in One of Two Staging Buffers,
+	 * while DMA Sends the Other at the Wire Speed of SPI
+	 */
+	mov staging, #0
+	mov column, #0
+	mov row_point, image_point
+
+	tft32_tftstream_type1_loop:
+		cmp size, #2
+		blo tft32_tftstream_type1_jump
+
+		mov length, #equ32_tft32_dma_pixels
+		cmp size, length
+		movlo length, size
+		bic length, length, #1                  @ Even Pixels, Multiple of 4 Bytes
+		sub size, size, length
+
+		ldr buffer, TFT32_STAGING
+		eor staging, staging, #1
+		cmp staging, #0
+		addne buffer, buffer, #equ32_tft32_dma_pixels * 2
+
+		mov i, #0
+		tft32_tftstream_type1_loop_swap:
+			ldrh temp, [image_point], #2
+			rev16 temp, temp
+			strh temp, [buffer, i]
+
+			/* Next Row */
+			add column, column, #1
+			cmp column, width
+			moveq column, #0
+			addeq row_point, row_point, stride
+			moveq image_point, row_point
+
+			add i, i, #2
+			cmp i, length, lsl #1
+			blo tft32_tftstream_type1_loop_swap
+
+		push {r0-r3}
+		mov r0, #equ32_tft32_dma_timeout
+		bl spi32_spidmawait
+		pop {r0-r3}
+
+		push {r0-r3}
+		mov r0, buffer
+		mov r1, #0
+		lsl r2, length, #1
+		bl spi32_spidma
+		pop {r0-r3}
+
+		b tft32_tftstream_type1_loop
+
+	tft32_tftstream_type1_jump:
+		push {r0-r3}
+		mov r0, #equ32_tft32_dma_timeout
+		bl spi32_spidmawait
+		pop {r0-r3}
+
+		/* Odd Pixel at Last */
+		cmp size, #0
+		beq tft32_tftstream_type1_common
+
+		push {r0-r3}
 		ldrh r0, [image_point]
 		lsl r0, r0, #16
 		mov r1, #2
@@ -293,23 +392,477 @@ tft32_tftimage_type1:
 		bl spi32_spiwaitdone
 		mov r0, #0b10                       @ Clear RxFIFO, Dummy Bytes Are Stacked through Transmission
 		bl spi32_spiclear
-		pop {r0-r1}
+		pop {r0-r3}
 
-		add image_point, image_point, #2
+	tft32_tftstream_type1_common:
+		/* CS Goes High */
+		bl spi32_spistop
+		pop {r4-r10,pc}
 
-		macro32_dsb ip
+.unreq image_point
+.unreq width
+.unreq size
+.unreq stride
+.unreq buffer
+.unreq length
+.unreq i
+.unreq temp
+.unreq staging
+.unreq column
+.unreq row_point
 
-		b tft32_tftimage_type1_loop
 
-	tft32_tftimage_type1_jump:
+/**
+ * function tft32_tftwindow_type1
+ * Set Window and GRAM Address to Upper Left Corner of Window
+ * Registers are of S6D0151 (equ32_tft32_window_x/window_y/gram), each address is 8-bit.
+ * GRAM is incremented horizontally then vertically (ID = 0b11, AM = 0).
+ *
+ * Parameters
+ * r0: Horizontal Start Address
+ * r1: Horizontal End Address
+ * r2: Vertical Start Address
+ * r3: Vertical End Address
+ *
+ * Return: r0 (0 as success)
+ */
+.globl tft32_tftwindow_type1
+tft32_tftwindow_type1:
+	/* Auto (Local) Variables, but just Aliases */
+	x_start .req r0
+	x_end   .req r1
+	y_start .req r2
+	y_end   .req r3
 
-		/* CS Goes High */
-		bl spi32_spistop
+	push {lr}
 
-	tft32_tftimage_type1_common:
+	and x_start, x_start, #0xFF
+	and x_end, x_end, #0xFF
+	and y_start, y_start, #0xFF
+	and y_end, y_end, #0xFF
+
+	push {r0-r3}
+	orr r1, x_start, x_end, lsl #8
+	mov r0, #equ32_tft32_window_x
+	bl tft32_tftwrite_type1
+	pop {r0-r3}
+
+	push {r0-r3}
+	orr r1, y_start, y_end, lsl #8
+	mov r0, #equ32_tft32_window_y
+	bl tft32_tftwrite_type1
+	pop {r0-r3}
+
+	push {r0-r3}
+	orr r1, x_start, y_start, lsl #8
+	mov r0, #equ32_tft32_gram
+	bl tft32_tftwrite_type1
+	pop {r0-r3}
+
+	tft32_tftwindow_type1_common:
 		mov r0, #0
 		pop {pc}
 
-.unreq image_point
-.unreq size
+.unreq x_start
+.unreq x_end
+.unreq y_start
+.unreq y_end
+
+
+/**
+ * function tft32_tftshadow_type1
+ * Allocate Shadow of GRAM to Update Only Dirty Rectangles by tft32_tftupdate_type1
+ * The shadow is allocated from heap, and the previous shadow is freed.
+ * The first update after this function writes the whole screen.
+ *
+ * Parameters
+ * r0: Width of Screen (Pixels)
+ * r1: Height of Screen (Pixels)
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: Memory Allocation Fails
+ */
+.globl tft32_tftshadow_type1
+tft32_tftshadow_type1:
+	/* Auto (Local) Variables, but just Aliases */
+	width  .req r0
+	height .req r1
+	temp   .req r2
+
+	push {lr}
+
+	ldr temp, TFT32_SHADOW
+	cmp temp, #0
+	beq tft32_tftshadow_type1_malloc
+
+	push {r0-r4}
+	mov r0, temp
+	bl heap32_mfree
+	pop {r0-r4}
+
+	mov temp, #0
+	str temp, TFT32_SHADOW
+
+	tft32_tftshadow_type1_malloc:
+		str width, TFT32_SHADOW_WIDTH
+		str height, TFT32_SHADOW_HEIGHT
+
+		mul temp, width, height
+		add temp, temp, #1
+		lsr temp, temp, #1                     @ Words, Two Pixels per Word
+
+		push {r0-r3}
+		mov r0, temp
+		bl heap32_malloc
+		mov temp, r0
+		pop {r0-r3}
+
+		cmp temp, #0
+		beq tft32_tftshadow_type1_error
+
+		str temp, TFT32_SHADOW
+		mov temp, #1
+		str temp, tft32_tftshadow_full
+
+		b tft32_tftshadow_type1_success
+
+	tft32_tftshadow_type1_error:
+		mov r0, #1
+		b tft32_tftshadow_type1_common
+
+	tft32_tftshadow_type1_success:
+		mov r0, #0
+
+	tft32_tftshadow_type1_common:
+		pop {pc}
+
+.unreq width
+.unreq height
+.unreq temp
+
+
+/**
+ * function tft32_tftupdate_type1
+ * Write Only Dirty Rectangles of Image to GRAM through Shadow
+ * Rows of each band (equ32_tft32_band) are compared with the shadow, and changed pixels are copied to the shadow.
+ * The changed columns of a band make a rectangle. A rectangle is merged with the rectangle of the band above
+ * if the merged window costs less than two windows, counting equ32_tft32_window_overhead for each window.
+ * Each rectangle is sent with tft32_tftwindow_type1 from the shadow. TFT32_BYTES and TFT32_WINDOWS are of the last update.
+ *
+ * Parameters
+ * r0: Pointer of Image in 16-bit (2 Bytes) Color, Same Size as Shadow
+ *
+ * Return: r0 (0 as Success, 1 as Error)
+ * Error: No Shadow
+ */
+.globl tft32_tftupdate_type1
+tft32_tftupdate_type1:
+	/* Auto (Local) Variables, but just Aliases */
+	image       .req r0
+	shadow      .req r1
+	width       .req r2
+	y           .req r3
+	left        .req r4
+	right       .req r5
+	temp        .req r6
+	temp2       .req r7
+	band_end    .req r8
+	x_start     .req r9
+	x_end       .req r10
+	y_start     .req r11
+
+	push {r4-r11,lr}
+
+	ldr shadow, TFT32_SHADOW
+	cmp shadow, #0
+	beq tft32_tftupdate_type1_error
+
+	ldr width, TFT32_SHADOW_WIDTH
+
+	mov temp, #0
+	str temp, TFT32_BYTES
+	str temp, TFT32_WINDOWS
+	str temp, tft32_tftupdate_pending
+
+	mov y, #0
+
+	tft32_tftupdate_type1_band:
+		ldr temp, TFT32_SHADOW_HEIGHT
+		cmp y, temp
+		bhs tft32_tftupdate_type1_flush
+
+		add band_end, y, #equ32_tft32_band
+		cmp band_end, temp
+		movhi band_end, temp
+
+		mov x_start, width
+		mov x_end, #0
+		mvn y_start, #0                         @ -1 as Clean Band
+
+		tft32_tftupdate_type1_band_row:
+			cmp y, band_end
+			bhs tft32_tftupdate_type1_band_check
+
+			mul temp, y, width
+			push {image,shadow}
+			add image, image, temp, lsl #1
+			add shadow, shadow, temp, lsl #1
+
+			mov left, #0
+			sub right, width, #1
+			ldr temp, tft32_tftshadow_full
+			cmp temp, #0
+			bne tft32_tftupdate_type1_band_row_copy
+
+			tft32_tftupdate_type1_band_row_left:
+				cmp left, width
+				bhs tft32_tftupdate_type1_band_row_common   @ Clean Row
+				lsl temp, left, #1
+				ldrh temp2, [image, temp]
+				ldrh temp, [shadow, temp]
+				cmp temp, temp2
+				bne tft32_tftupdate_type1_band_row_right
+				add left, left, #1
+				b tft32_tftupdate_type1_band_row_left
+
+			/* Stops at Left at Least */
+			tft32_tftupdate_type1_band_row_right:
+				lsl temp, right, #1
+				ldrh temp2, [image, temp]
+				ldrh temp, [shadow, temp]
+				cmp temp, temp2
+				bne tft32_tftupdate_type1_band_row_copy
+				sub right, right, #1
+				b tft32_tftupdate_type1_band_row_right
+
+			tft32_tftupdate_type1_band_row_copy:
+				lsl temp, left, #1
+				lsl temp2, right, #1
+				tft32_tftupdate_type1_band_row_copy_loop:
+					ldrh lr, [image, temp]
+					strh lr, [shadow, temp]
+					add temp, temp, #2
+					cmp temp, temp2
+					bls tft32_tftupdate_type1_band_row_copy_loop
+
+				cmp left, x_start
+				movlo x_start, left
+				cmp right, x_end
+				movhi x_end, right
+				cmn y_start, #1
+				moveq y_start, y
+				str y, tft32_tftupdate_y_end
+
+			tft32_tftupdate_type1_band_row_common:
+				pop {image,shadow}
+				add y, y, #1
+				b tft32_tftupdate_type1_band_row
+
+		tft32_tftupdate_type1_band_check:
+			cmn y_start, #1
+			beq tft32_tftupdate_type1_band_clean
+
+			ldr temp, tft32_tftupdate_pending
+			cmp temp, #0
+			beq tft32_tftupdate_type1_band_new
+
+			/* Merge If Pending Rectangle Is Just Above */
+			ldr temp, tft32_tftupdate_py_end
+			add temp, temp, #1
+			cmp temp, y_start
+			bne tft32_tftupdate_type1_band_send
+
+			ldr left, tft32_tftupdate_px_start
+			cmp x_start, left
+			movlo left, x_start
+			ldr right, tft32_tftupdate_px_end
+			cmp x_end, right
+			movhi right, x_end
+
+			/* Pixels of Merged Window */
+			sub temp, right, left
+			add temp, temp, #1
+			ldr temp2, tft32_tftupdate_y_end
+			ldr band_end, tft32_tftupdate_py_start
+			sub temp2, temp2, band_end
+			add temp2, temp2, #1
+			mul band_end, temp, temp2
+
+			/* Pixels of Two Windows */
+			ldr temp, tft32_tftupdate_px_end
+			ldr temp2, tft32_tftupdate_px_start
+			sub temp, temp, temp2
+			add temp, temp, #1
+			ldr temp2, tft32_tftupdate_py_end
+			ldr lr, tft32_tftupdate_py_start
+			sub temp2, temp2, lr
+			add temp2, temp2, #1
+			mul lr, temp, temp2
+			sub temp, x_end, x_start
+			add temp, temp, #1
+			ldr temp2, tft32_tftupdate_y_end
+			sub temp2, temp2, y_start
+			add temp2, temp2, #1
+			mul temp2, temp, temp2
+			add lr, lr, temp2
+			add lr, lr, #equ32_tft32_window_overhead
+
+			cmp band_end, lr
+			bhi tft32_tftupdate_type1_band_send
+
+			str left, tft32_tftupdate_px_start
+			str right, tft32_tftupdate_px_end
+			ldr temp, tft32_tftupdate_y_end
+			str temp, tft32_tftupdate_py_end
+			b tft32_tftupdate_type1_band
+
+			tft32_tftupdate_type1_band_send:
+				push {r0-r3}
+				bl tft32_tftupdate_send
+				pop {r0-r3}
+
+			tft32_tftupdate_type1_band_new:
+				str x_start, tft32_tftupdate_px_start
+				str x_end, tft32_tftupdate_px_end
+				str y_start, tft32_tftupdate_py_start
+				ldr temp, tft32_tftupdate_y_end
+				str temp, tft32_tftupdate_py_end
+				mov temp, #1
+				str temp, tft32_tftupdate_pending
+				b tft32_tftupdate_type1_band
+
+		tft32_tftupdate_type1_band_clean:
+			ldr temp, tft32_tftupdate_pending
+			cmp temp, #0
+			beq tft32_tftupdate_type1_band
+
+			push {r0-r3}
+			bl tft32_tftupdate_send
+			pop {r0-r3}
+
+			b tft32_tftupdate_type1_band
+
+	tft32_tftupdate_type1_flush:
+		ldr temp, tft32_tftupdate_pending
+		cmp temp, #0
+		beq tft32_tftupdate_type1_success
+
+		push {r0-r3}
+		bl tft32_tftupdate_send
+		pop {r0-r3}
+
+		b tft32_tftupdate_type1_success
+
+	tft32_tftupdate_type1_error:
+		mov r0, #1
+		b tft32_tftupdate_type1_common
+
+	tft32_tftupdate_type1_success:
+		mov temp, #0
+		str temp, tft32_tftshadow_full
+		mov r0, #0
+
+	tft32_tftupdate_type1_common:
+		pop {r4-r11,pc}
+
+.unreq image
+.unreq shadow
+.unreq width
+.unreq y
+.unreq left
+.unreq right
+.unreq temp
+.unreq temp2
+.unreq band_end
+.unreq x_start
+.unreq x_end
+.unreq y_start
+
+
+/**
+ * Send Pending Rectangle from Shadow and Count Bytes on Wire
+ */
+tft32_tftupdate_send:
+	/* Auto (Local) Variables, but just Aliases */
+	x_start     .req r0
+	x_end       .req r1
+	y_start     .req r2
+	y_end       .req r3
+	width       .req r4
+	height      .req r5
+	temp        .req r6
+
+	push {r4-r6,lr}
+
+	ldr x_start, tft32_tftupdate_px_start
+	ldr x_end, tft32_tftupdate_px_end
+	ldr y_start, tft32_tftupdate_py_start
+	ldr y_end, tft32_tftupdate_py_end
+
+	push {r0-r3}
+	bl tft32_tftwindow_type1
+	pop {r0-r3}
+
+	sub width, x_end, x_start
+	add width, width, #1
+	sub height, y_end, y_start
+	add height, height, #1
+
+	/* Bytes: 3 Registers by 6 Bytes, GRAM Write by 4 Bytes, and Pixels */
+	mul temp, width, height
+	lsl temp, temp, #1
+	add temp, temp, #18 + 4
+	ldr y_end, TFT32_BYTES
+	add y_end, y_end, temp
+	str y_end, TFT32_BYTES
+	ldr temp, TFT32_WINDOWS
+	add temp, temp, #1
+	str temp, TFT32_WINDOWS
+
+	/* Upper Left Pixel of Rectangle in Shadow */
+	ldr temp, TFT32_SHADOW_WIDTH
+	mla x_start, y_start, temp, x_start
+	ldr y_start, TFT32_SHADOW
+	add r0, y_start, x_start, lsl #1
+	mov r1, width
+	mov r2, height
+	lsl r3, temp, #1
+	bl tft32_tftstream_type1
+
+	mov temp, #0
+	str temp, tft32_tftupdate_pending
+
+	pop {r4-r6,pc}
+
+.unreq x_start
+.unreq x_end
+.unreq y_start
+.unreq y_end
+.unreq width
+.unreq height
+.unreq temp
 
+tft32_tftshadow_full:     .word 0x00 @ Write All Pixels on Next Update
+tft32_tftupdate_pending:  .word 0x00 @ 1 as Rectangle Is Pending
+tft32_tftupdate_px_start: .word 0x00
+tft32_tftupdate_px_end:   .word 0x00
+tft32_tftupdate_py_start: .word 0x00
+tft32_tftupdate_py_end:   .word 0x00
+tft32_tftupdate_y_end:    .word 0x00 @ Last Dirty Row of Current Band
+
+.globl TFT32_SHADOW
+.globl TFT32_SHADOW_WIDTH
+.globl TFT32_SHADOW_HEIGHT
+.globl TFT32_BYTES
+.globl TFT32_WINDOWS
+TFT32_SHADOW:             .word 0x00
+TFT32_SHADOW_WIDTH:       .word 0x00
+TFT32_SHADOW_HEIGHT:      .word 0x00
+TFT32_BYTES:              .word 0x00 @ Bytes on Wire in Last Update
+TFT32_WINDOWS:            .word 0x00 @ Windows in Last Update
+TFT32_STAGING: .word _TFT32_STAGING
+
+.section	.data
+.balign 32
+_TFT32_STAGING: .space equ32_tft32_dma_pixels * 2 * 2 @ Two Staging Buffers of Big Endian Pixels for DMA
+.section	.library_system32
@@ -38,6 +38,8 @@
 .balign 4
 .include "system32/arm/clk32.s"
 .balign 4
+.include "system32/arm/timer32.s"
+.balign 4
 .include "system32/arm/dma32.s"
 .balign 4
 .include "system32/arm/uart32.s"
@@ -25,7 +25,11 @@ _os_prefetch_abort_addr:        .word _os_prefetch_abort
 _os_data_abort_addr:            .word _os_data_abort
 _os_reserve_addr:               .word _os_reset
 _os_irq_addr:                   .word _os_irq
+.ifdef __FIQ_BANKED
+_os_fiq_addr:                   .word os_fiq  @ Fast Path, os_fiq Returns by Itself
+.else
 _os_fiq_addr:                   .word _os_fiq
+.endif
 
 _os_reset:
 	/*
@@ -208,6 +212,24 @@ _os_reset:
 	bl arm32_set_cache
 	pop {r0-r3}
 
+	/**
+	 * Merge Uniform Sections into Supersections (16M Bytes) to Reduce TLB Misses
+	 */
+	push {r0-r3}
+.ifndef __ARMV6
+.ifndef __SECURE
+	mov r0, #1
+.else
+	mov r0, #0
+.endif
+.else
+	mov r0, #0
+.endif
+	mov r1, #0
+	mov r2, #equ32_peripherals_base
+	bl arm32_set_supersection
+	pop {r0-r3}
+
 	macro32_dsb ip
 	macro32_invalidate_tlb_all ip
 	macro32_dsb ip
@@ -309,7 +331,7 @@ _os_svc:
 	push {lr}                                @ Push fp and lr
 	ldr ip, [lr, #-4]                        @ Load SVC Instruction
 	bic ip, #0xFF000000                      @ Immediate Bit[23:0]
-	cmp ip, #0x6C                            @ Prevent Overflow SVC Table
+	cmp ip, #0x8E                            @ Prevent Overflow SVC Table
 	bhi _os_svc_common
 	lsl ip, ip, #3                           @ Substitution of Multiplication by 8
 	add pc, pc, ip
@@ -758,6 +780,142 @@ _os_svc:
 		bl v3d32_bind_objectv3d
 		b _os_svc_common
 
+	_os_svc_0x6D:
+		bl uart32_uarttxqueue
+		b _os_svc_common
+
+	_os_svc_0x6E:
+		bl uart32_uartline
+		b _os_svc_common
+
+	_os_svc_0x6F:
+		bl sts32_synthesetpre
+		b _os_svc_common
+
+	_os_svc_0x70:
+		bl v3d32_execute_cl_frame
+		b _os_svc_common
+
+	_os_svc_0x71:
+		bl v3d32_wait_cl_rendering
+		b _os_svc_common
+
+	_os_svc_0x72:
+		bl dma32_submit
+		b _os_svc_common
+
+	_os_svc_0x73:
+		bl dma32_poll
+		b _os_svc_common
+
+	_os_svc_0x74:
+		bl dma32_wait_ticket
+		b _os_svc_common
+
+	_os_svc_0x75:
+		bl dma32_complete
+		b _os_svc_common
+
+	_os_svc_0x76:
+		bl dma32_pool_init
+		b _os_svc_common
+
+	_os_svc_0x77:
+		bl arm32_cache_calibrate
+		b _os_svc_common
+
+	_os_svc_0x78:
+		bl gpio32_dmaplay
+		b _os_svc_common
+
+	_os_svc_0x79:
+		bl gpio32_dmastop
+		b _os_svc_common
+
+	_os_svc_0x7A:
+		bl gpio32_dmatimebase
+		b _os_svc_common
+
+	_os_svc_0x7B:
+		bl lcd32_lcdasyncinit
+		b _os_svc_common
+
+	_os_svc_0x7C:
+		bl lcd32_lcdqueue
+		b _os_svc_common
+
+	_os_svc_0x7D:
+		bl lcd32_lcdshadow
+		b _os_svc_common
+
+	_os_svc_0x7E:
+		bl lcd32_lcdshadowcg
+		b _os_svc_common
+
+	_os_svc_0x7F:
+		bl lcd32_lcdupdate
+		b _os_svc_common
+
+	_os_svc_0x80:
+		bl i2c32_i2csubmit
+		b _os_svc_common
+
+	_os_svc_0x81:
+		bl i2c32_i2cpoll
+		b _os_svc_common
+
+	_os_svc_0x82:
+		bl i2c32_i2cqueueinit
+		b _os_svc_common
+
+	_os_svc_0x83:
+		bl spi32_spisubmit
+		b _os_svc_common
+
+	_os_svc_0x84:
+		bl spi32_spipoll
+		b _os_svc_common
+
+	_os_svc_0x85:
+		bl spi32_spiqueueinit
+		b _os_svc_common
+
+	_os_svc_0x86:
+		bl spi32_spidma
+		b _os_svc_common
+
+	_os_svc_0x87:
+		bl spi32_spidmawait
+		b _os_svc_common
+
+	_os_svc_0x88:
+		bl tft32_tftwindow_type1
+		b _os_svc_common
+
+	_os_svc_0x89:
+		bl tft32_tftshadow_type1
+		b _os_svc_common
+
+	_os_svc_0x8A:
+		bl tft32_tftupdate_type1
+		b _os_svc_common
+
+	_os_svc_0x8B:
+		bl gpio32_dmacapture
+		b _os_svc_common
+
+	_os_svc_0x8C:
+		bl arm32_perf_init
+		b _os_svc_common
+
+	_os_svc_0x8D:
+		bl arm32_perf_begin
+		b _os_svc_common
+
+	_os_svc_0x8E:
+		bl arm32_perf_end
+		b _os_svc_common
+
 	_os_svc_common:
 		pop {lr}                         @ Pop lr
 		movs pc, lr
@@ -796,6 +954,8 @@ _os_irq:
 
 	/*push {r0-r12,lr}*/                         @ Equals to stmfd (stack pointer full, decrement order)
 
+	bl _os_imb
+
 	bl os_irq
 
 	/*pop {r0-r12,lr}*/                          @ Equals to ldmfd (stack pointer full, decrement order)
@@ -813,6 +973,8 @@ _os_fiq:
 	/*mrs r0, spsr*/                             @ No Need of Save Status Flags in Interrupts of ARM
 	/*push {r0}*/
 
+	bl _os_imb
+
 	bl os_fiq
 
 	/*pop {r0}*/
@@ -821,3 +983,38 @@ _os_fiq:
 
 	pop {lr}
 	subs pc, lr, #4
+
+
+/**
+ * Instruction Memory Barrier on Request
+ * Called on every entry of IRQ and FIQ, but the maintenance runs only if OS_IMB_REQUEST is not zero.
+ * ARM11 doesn't keep the instruction cache coherent with the data cache.
+ * If code is modified, e.g., loaded or patched, clean the data cache of the code first, then set OS_IMB_REQUEST to non-zero.
+ * The next entry invalidates the instruction cache, flushes the branch target cache and the prefetch buffer, then clears the request.
+ * Handlers don't need to invalidate the instruction cache on each interrupt by themselves.
+ *
+ * If __FIQ_BANKED is defined before including this file, the vector of FIQ jumps to os_fiq directly as the fast path.
+ * In this case, os_fiq needs to return with `subs pc, lr, #4`, and to use r8-r12 (banked in FIQ mode) to avoid push/pop.
+ * The fast path doesn't check OS_IMB_REQUEST, so don't modify code of os_fiq while FIQ is enabled.
+ */
+_os_imb:
+	push {r0-r1}
+	ldr r1, OS_IMB_REQUEST_ADDR
+	ldr r0, [r1]
+	cmp r0, #0
+	beq _os_imb_common
+
+	mov r0, #0
+	str r0, [r1]
+	macro32_invalidate_instruction_all r0
+	macro32_flush_branch r0
+	macro32_dsb r0
+	macro32_isb r0
+
+	_os_imb_common:
+		pop {r0-r1}
+		mov pc, lr
+
+OS_IMB_REQUEST_ADDR: .word OS_IMB_REQUEST
+.globl OS_IMB_REQUEST
+OS_IMB_REQUEST:      .word 0x00
@@ -0,0 +1,139 @@
+/**
+ * arm32/perf.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/* Shift and Subtract to Avoid Division of 64-bit in Library of Compiler */
+uint32 arm32_perf_average( uint32* stat, uint32 count ) {
+	uint32 sum_lower = stat[0];
+	uint32 sum_upper = stat[1];
+	uint32 remainder = 0;
+	uint32 quotient = 0;
+	uint32 carry;
+
+	if ( ! count ) return 0;
+	for ( int32 i = 63; i >= 0; i-- ) {
+		carry = remainder >> 31;
+		remainder <<= 1;
+		if ( i >= 32 ) {
+			remainder |= (sum_upper >> (i - 32)) & 1;
+		} else {
+			remainder |= (sum_lower >> i) & 1;
+		}
+		if ( carry || remainder >= count ) {
+			remainder -= count;
+			if ( i < 32 ) quotient |= 1u << i; // Average Is Less Than Maximum, Upper Bits Are Zero
+		}
+	}
+	return quotient;
+}
+
+/* Each Put Function Stops at size, So Lines Are Truncated If size Is Short */
+static uint32 arm32_perf_put_string( String string, uint32 index, uint32 size, String source ) {
+	while ( *source ) {
+		if ( index >= size ) return size;
+		string[index++] = *source++;
+	}
+	return index;
+}
+
+static uint32 arm32_perf_put_decimal( String string, uint32 index, uint32 size, uint32 value ) {
+	char8 digits[10];
+	uint32 length = 0;
+	do {
+		digits[length++] = '0' + value % 10;
+		value /= 10;
+	} while ( value );
+	while ( length ) {
+		if ( index >= size ) return size;
+		string[index++] = digits[--length];
+	}
+	return index;
+}
+
+static uint32 arm32_perf_put_stat( String string, uint32 index, uint32 size, String name, uint32* stat, uint32 count ) {
+	index = arm32_perf_put_string( string, index, size, name );
+	index = arm32_perf_put_decimal( string, index, size, stat[2] );
+	index = arm32_perf_put_string( string, index, size, "/" );
+	index = arm32_perf_put_decimal( string, index, size, arm32_perf_average( stat, count ) );
+	index = arm32_perf_put_string( string, index, size, "/" );
+	return arm32_perf_put_decimal( string, index, size, stat[3] );
+}
+
+static uint32 arm32_perf_put_marker( String string, uint32 size, uint32 marker ) {
+	uint32 index;
+	index = arm32_perf_put_string( string, 0, size, "M" );
+	if ( marker < 10 ) index = arm32_perf_put_string( string, index, size, "0" );
+	return arm32_perf_put_decimal( string, index, size, marker );
+}
+
+uint32 arm32_perf_format( uint32* buffer, uint32 marker, String string, uint32 size ) {
+	uint32* entry;
+	uint32 count;
+	uint32 index;
+
+	if ( marker >= ARM32_PERF_MARKERS ) return 0;
+	entry = buffer + marker * ARM32_PERF_ENTRY_WORDS;
+	count = entry[ARM32_PERF_COUNT];
+	if ( ! count ) return 0;
+
+	index = arm32_perf_put_marker( string, size, marker );
+	index = arm32_perf_put_string( string, index, size, " N:" );
+	index = arm32_perf_put_decimal( string, index, size, count );
+	index = arm32_perf_put_stat( string, index, size, " C:", entry + ARM32_PERF_CYCLES, count );
+	index = arm32_perf_put_stat( string, index, size, " E0:", entry + ARM32_PERF_EVENT_0, count );
+	index = arm32_perf_put_stat( string, index, size, " E1:", entry + ARM32_PERF_EVENT_1, count );
+	return index;
+}
+
+uint32 arm32_perf_format_histogram( uint32* buffer, uint32 marker, String string, uint32 size ) {
+	uint32* entry;
+	uint32 index;
+
+	if ( marker >= ARM32_PERF_MARKERS ) return 0;
+	entry = buffer + marker * ARM32_PERF_ENTRY_WORDS;
+	if ( ! entry[ARM32_PERF_COUNT] ) return 0;
+
+	index = arm32_perf_put_marker( string, size, marker );
+	index = arm32_perf_put_string( string, index, size, " H:" );
+	for ( uint32 i = 0; i < 16; i++ ) {
+		index = arm32_perf_put_string( string, index, size, " " );
+		index = arm32_perf_put_decimal( string, index, size, entry[ARM32_PERF_HISTOGRAM + i] );
+	}
+	return index;
+}
+
+static void arm32_perf_output( String string, uint32 length, int32 x_coord, int32 y_coord, bool flag_uart ) {
+	if ( flag_uart ) {
+		string[length++] = '\r';
+		string[length++] = '\n';
+		_uarttx( string, length );
+	} else {
+		print32_string( string, x_coord, y_coord, length );
+	}
+}
+
+uint32 arm32_perf_report( uint32* buffer, int32 x_coord, int32 y_coord, bool flag_uart ) {
+	char8 string[ARM32_PERF_STRING_SIZE];
+	uint32 number_marker = 0;
+	uint32 length;
+
+	for ( uint32 i = 0; i < ARM32_PERF_MARKERS; i++ ) {
+		/* Keep Two Bytes for CR and LF */
+		length = arm32_perf_format( buffer, i, string, ARM32_PERF_STRING_SIZE - 2 );
+		if ( ! length ) continue;
+		arm32_perf_output( string, length, x_coord, y_coord, flag_uart );
+		y_coord += PRINT32_FONT_HEIGHT;
+		length = arm32_perf_format_histogram( buffer, i, string, ARM32_PERF_STRING_SIZE - 2 );
+		if ( length ) {
+			arm32_perf_output( string, length, x_coord, y_coord, flag_uart );
+			y_coord += PRINT32_FONT_HEIGHT;
+		}
+		number_marker++;
+	}
+	return number_marker;
+}
@@ -0,0 +1,51 @@
+/**
+ * arm32/perf.h
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * This header file is for reporting markers measured by _perf_begin and _perf_end (arm32_perf_* in ../(asterisk)/system32/arm/arm32.s).
+ * Select two events by _perf_init, e.g., _perf_init( ARM32_PERF_DCACHE_MISS, ARM32_PERF_BRANCH_MISS ),
+ * then put _perf_begin( marker ) and _perf_end( marker ) around the code to be measured, e.g., FFT in tuner/user32.c.
+ * Each marker has the number of measurements, the sum, the minimum, and the maximum of cycles and two events,
+ * and the histogram of cycles. Note that cycles include the overhead of the system call of _perf_begin and _perf_end.
+ * Functions in perf.c except arm32_perf_report touch only buffers given by pointers, i.e., no peripherals.
+ * Build on Host: cc -include share/include/system32.h -include share/include/arm32/perf.h -c share/include/arm32/perf.c
+ */
+
+#define ARM32_PERF_STRING_SIZE 192 // Bytes of Line on arm32_perf_report, Longest Line Is Histogram, Up to 182 Bytes
+
+/**
+ * Average of Statistics (Sum Divided by Number of Measurements)
+ * stat is the pointer of statistics in the marker, e.g., &ARM32_PERF_BUFFER[marker * ARM32_PERF_ENTRY_WORDS + ARM32_PERF_CYCLES].
+ *
+ * Return: Average, 0 If No Measurement
+ */
+uint32 arm32_perf_average( uint32* stat, uint32 count );
+
+/**
+ * Make One Line of Marker, "Mnn N:count C:min/avg/max E0:min/avg/max E1:min/avg/max" Without Newline
+ *
+ * Return: Length of String, 0 If No Measurement on Marker, String Is Truncated If Size Is Short
+ */
+uint32 arm32_perf_format( uint32* buffer, uint32 marker, String string, uint32 size );
+
+/**
+ * Make One Line of Histogram of Marker, "Mnn H:" and Counts of 16 Buckets Without Newline
+ *
+ * Return: Length of String, 0 If No Measurement on Marker, String Is Truncated If Size Is Short
+ */
+uint32 arm32_perf_format_histogram( uint32* buffer, uint32 marker, String string, uint32 size );
+
+/**
+ * Print Lines of All Measured Markers, Two Lines per Marker
+ * If flag_uart is true, lines are sent through _uarttx with CR and LF, and coordinates are ignored.
+ * Otherwise, lines are drawn through print32_string from the coordinates with the height of PRINT32_FONT_HEIGHT per line.
+ *
+ * Return: Number of Reported Markers
+ */
+uint32 arm32_perf_report( uint32* buffer, int32 x_coord, int32 y_coord, bool flag_uart );
@@ -0,0 +1,187 @@
+/**
+ * gpio32/sequencer.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/* Values Are Stored in Little Endian, Byte by Byte to Keep the Layout on a Host Machine with 64-bit Long */
+static void gpio32_seq_put32( uchar8* buffer, uint32 value ) {
+	buffer[0] = value & 0xFF;
+	buffer[1] = (value >> 8) & 0xFF;
+	buffer[2] = (value >> 16) & 0xFF;
+	buffer[3] = (value >> 24) & 0xFF;
+}
+
+static uint32 gpio32_seq_get32( uchar8* buffer ) {
+	return buffer[0]|buffer[1]<<8|buffer[2]<<16|(uint32)buffer[3]<<24;
+}
+
+static void gpio32_seq_put_cb( uchar8* cb, uint32 ti, uint32 source, uint32 destination, uint32 next ) {
+	gpio32_seq_put32( cb, ti );
+	gpio32_seq_put32( cb + 4, source );
+	gpio32_seq_put32( cb + 8, destination );
+	gpio32_seq_put32( cb + 12, 4 ); // Transfer Length, One Word
+	gpio32_seq_put32( cb + 16, 0 ); // 2D Stride
+	gpio32_seq_put32( cb + 20, next );
+	gpio32_seq_put32( cb + 24, 0 );
+	gpio32_seq_put32( cb + 28, 0 );
+}
+
+uint32 gpio32_seq_encode_beat( gpio_sequence beat, uint32 mask, uint32* clear, uint32* set ) {
+	uint32 value = beat & mask & 0x3FFFFFFF;
+	*clear = 0;
+	*set = 0;
+	if ( beat == GPIO32_END ) return GPIO32_SEQ_BEAT_END;
+	switch ( beat >> 30 ) {
+		case 0b10: // Change All
+			*clear = ~beat & mask & 0x3FFFFFFF;
+			*set = value;
+			break;
+		case 0b11: // Stay Pins of Zero
+			*set = value;
+			break;
+		case 0b01: // Invert, Stay Pins of Zero
+			*clear = value;
+			break;
+		default: // 0b00, Ignore
+			return GPIO32_SEQ_BEAT_IGNORE;
+	}
+	return GPIO32_SEQ_BEAT_WRITE;
+}
+
+uint32 gpio32_seq_step( gpio_sequence beat, uint32 mask, uint32 level ) {
+	uint32 clear;
+	uint32 set;
+	if ( gpio32_seq_encode_beat( beat, mask, &clear, &set ) != GPIO32_SEQ_BEAT_WRITE ) return level;
+	return ((level & ~clear) | set) & 0x3FFFFFFF;
+}
+
+uint32 gpio32_seq_compile( uchar8* buffer, uint32 bus_address, gpio_sequence* sequence, uint32 length, uint32 mask, int32 repeat, uchar8 timebase, bool flag_inten ) {
+	uint32 ti_pace;
+	uint32 bus_pace;
+	uint32 number_beat = 0;
+	uint32 number_cb_pass = 0;
+	uint32 number_data_pass = 0;
+	uint32 number_pass;
+	uint32 number_cb;
+	uint32 clear;
+	uint32 set;
+	uint32 result;
+	uint32 index_cb;
+	uint32 index_data;
+	uchar8* data;
+	uint32 bus_data;
+	uint32 next;
+
+	if ( timebase == GPIO32_SEQ_TIMEBASE_PWM ) {
+		bus_pace = GPIO32_SEQ_BUS_PWM_FIF1;
+	} else if ( timebase == GPIO32_SEQ_TIMEBASE_PCM ) {
+		bus_pace = GPIO32_SEQ_BUS_PCM_FIFO;
+	} else {
+		return 0;
+	}
+	ti_pace = timebase << GPIO32_SEQ_TI_PERMAP|GPIO32_SEQ_TI_DST_DREQ|GPIO32_SEQ_TI_WAIT_RESP|GPIO32_SEQ_TI_NO_WIDE_BURSTS;
+
+	if ( repeat == GPIO32_SEQ_LOOP ) {
+		number_pass = 1;
+	} else if ( repeat > 0 ) {
+		number_pass = repeat;
+	} else {
+		return 0;
+	}
+
+	/* Count CBs and Data Words of One Pass */
+	for ( uint32 i = 0; i < length; i++ ) {
+		result = gpio32_seq_encode_beat( sequence[i], mask, &clear, &set );
+		if ( result == GPIO32_SEQ_BEAT_END ) break;
+		number_beat++;
+		number_cb_pass++; // Wait for DREQ
+		if ( clear ) { number_cb_pass++; number_data_pass++; }
+		if ( set ) { number_cb_pass++; number_data_pass++; }
+	}
+	if ( ! number_beat ) return 0;
+
+	number_cb = number_cb_pass * number_pass;
+	if ( buffer == NULL ) return number_cb * GPIO32_SEQ_CB_SIZE + (1 + number_data_pass) * 4;
+
+	/* Data[0] Is Dummy to Be Sent to FIFO of Timebase */
+	data = buffer + number_cb * GPIO32_SEQ_CB_SIZE;
+	bus_data = bus_address + number_cb * GPIO32_SEQ_CB_SIZE;
+	gpio32_seq_put32( data, 0 );
+
+	index_cb = 0;
+	for ( uint32 pass = 0; pass < number_pass; pass++ ) {
+		index_data = 1;
+		for ( uint32 i = 0; i < number_beat; i++ ) {
+			gpio32_seq_encode_beat( sequence[i], mask, &clear, &set );
+			/* Wait for DREQ First, Then Write Pins Right After Tick of Timebase */
+			for ( uint32 j = 0; j < 3; j++ ) {
+				if ( j == 1 && ! clear ) continue;
+				if ( j == 2 && ! set ) continue;
+				if ( index_cb + 1 < number_cb ) {
+					next = bus_address + (index_cb + 1) * GPIO32_SEQ_CB_SIZE;
+				} else if ( repeat == GPIO32_SEQ_LOOP ) {
+					next = bus_address;
+				} else {
+					next = 0;
+				}
+				if ( j == 0 ) {
+					gpio32_seq_put_cb( buffer + index_cb * GPIO32_SEQ_CB_SIZE, ti_pace, bus_data, bus_pace, next );
+				} else {
+					if ( ! pass ) gpio32_seq_put32( data + index_data * 4, j == 1 ? clear : set );
+					gpio32_seq_put_cb( buffer + index_cb * GPIO32_SEQ_CB_SIZE, GPIO32_SEQ_TI_WAIT_RESP|GPIO32_SEQ_TI_NO_WIDE_BURSTS, bus_data + index_data * 4, j == 1 ? GPIO32_SEQ_BUS_GPCLR0 : GPIO32_SEQ_BUS_GPSET0, next );
+					index_data++;
+				}
+				index_cb++;
+			}
+		}
+	}
+	if ( flag_inten && repeat != GPIO32_SEQ_LOOP ) buffer[(number_cb - 1) * GPIO32_SEQ_CB_SIZE] |= GPIO32_SEQ_TI_INTEN;
+
+	return number_cb * GPIO32_SEQ_CB_SIZE + (1 + number_data_pass) * 4;
+}
+
+int32 gpio32_seq_simulate( uchar8* buffer, uint32 bus_address, uint32 size, uint32 level, uint32* levels, uint32 max_beats ) {
+	uint32 number_beat = 0;
+	uint32 number_cb_beat = 0; // CBs Without Wait for DREQ, to Stop Chain Looping Without Beat
+	uint32 bus_cb = bus_address;
+	uchar8* cb;
+	uint32 ti;
+	uint32 source;
+	uint32 destination;
+	uint32 value;
+
+	if ( size < GPIO32_SEQ_CB_SIZE ) return -1;
+	level &= 0x3FFFFFFF;
+	while ( bus_cb ) {
+		if ( bus_cb < bus_address || bus_cb - bus_address > size - GPIO32_SEQ_CB_SIZE || (bus_cb - bus_address) % GPIO32_SEQ_CB_SIZE ) return -1;
+		if ( number_cb_beat > size / GPIO32_SEQ_CB_SIZE ) return -1;
+		cb = buffer + (bus_cb - bus_address);
+		ti = gpio32_seq_get32( cb );
+		source = gpio32_seq_get32( cb + 4 );
+		destination = gpio32_seq_get32( cb + 8 );
+		if ( source < bus_address || source - bus_address > size - 4 || (source - bus_address) % 4 ) return -1;
+		value = gpio32_seq_get32( buffer + (source - bus_address) );
+		if ( destination == GPIO32_SEQ_BUS_PWM_FIF1 || destination == GPIO32_SEQ_BUS_PCM_FIFO ) {
+			if ( ! (ti & GPIO32_SEQ_TI_DST_DREQ) ) return -2;
+			if ( number_beat >= max_beats ) break;
+			levels[number_beat++] = level;
+			number_cb_beat = 0;
+		} else if ( destination == GPIO32_SEQ_BUS_GPCLR0 ) {
+			level &= ~value;
+			if ( number_beat ) levels[number_beat - 1] = level;
+			number_cb_beat++;
+		} else if ( destination == GPIO32_SEQ_BUS_GPSET0 ) {
+			level = (level | value) & 0x3FFFFFFF;
+			if ( number_beat ) levels[number_beat - 1] = level;
+			number_cb_beat++;
+		} else {
+			return -2;
+		}
+		bus_cb = gpio32_seq_get32( cb + 20 );
+	}
+	return number_beat;
+}
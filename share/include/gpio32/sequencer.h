@@ -0,0 +1,88 @@
+/**
+ * gpio32/sequencer.h
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * This header file is for compiling a GPIO sequence of ../(asterisk)/system32/arm/gpio32.s to a chain of DMA control blocks (CBs).
+ * Each beat of the sequence becomes a CB to wait for DREQ of PWM or PCM as a timebase, and CBs to write GPCLR0 and GPSET0.
+ * So, the sequence runs with the DMA engine only, no beat on FIQ/IRQ, unlike gpio32_gpioplay.
+ * Functions in sequencer.c touch only the buffer given by the pointer, i.e., no heap, no peripherals.
+ * So, sequencer.c can be built and checked on a host machine as well as the target.
+ * On the target, allocate the buffer with heap32_malloc (28 bytes more to align the buffer to 32 bytes),
+ * and pass the ARM side address + V3D32_BUS_COHERENCE (Same as equ32_bus_coherence_base) as the bus address.
+ * Then, set the timebase with `_gpiodmatimebase`, and play the buffer with `_gpiodmaplay`.
+ * Build on Host: cc -include share/include/system32.h -include share/include/gpio32/sequencer.h -c share/include/gpio32/sequencer.c
+ * Check on Host: See sequencer_test.c, which compares levels simulated from compiled CBs with gpio32_seq_step.
+ */
+
+/* Layout of Buffer: CBs (8 Words Each, 256-bit Align) Then Data Words, Little Endian */
+#define GPIO32_SEQ_CB_SIZE                 32
+
+/* Bus Addresses of Peripherals, Same on BCM2835 and BCM2836/BCM2837 */
+#define GPIO32_SEQ_BUS_GPSET0              0x7E20001C
+#define GPIO32_SEQ_BUS_GPCLR0              0x7E200028
+#define GPIO32_SEQ_BUS_PWM_FIF1            0x7E20C018
+#define GPIO32_SEQ_BUS_PCM_FIFO            0x7E203004
+
+/* Transfer Information, Same as equ32_dma_ti_* in equ32.s */
+#define GPIO32_SEQ_TI_NO_WIDE_BURSTS       0x04000000
+#define GPIO32_SEQ_TI_PERMAP               16 // Bit[20:16]
+#define GPIO32_SEQ_TI_DST_DREQ             0x00000040
+#define GPIO32_SEQ_TI_WAIT_RESP            0x00000008
+#define GPIO32_SEQ_TI_INTEN                0x00000001
+
+/* Timebase, DREQ Number Is Same as equ32_dma_dreq_* in equ32.s */
+#define GPIO32_SEQ_TIMEBASE_PCM            2
+#define GPIO32_SEQ_TIMEBASE_PWM            5
+
+/* Repeat */
+#define GPIO32_SEQ_LOOP                    -1 // Last CB Links to First CB
+
+/* Return of gpio32_seq_encode_beat */
+#define GPIO32_SEQ_BEAT_END                0
+#define GPIO32_SEQ_BEAT_IGNORE             1
+#define GPIO32_SEQ_BEAT_WRITE              2
+
+/**
+ * Encode One Beat to Values of GPCLR0 and GPSET0
+ * Bit[31:30] has the same meaning as gpio32_gpioplay. Values are masked with Bit[29:0] of the mask.
+ * 0b11 and 0b01 write only GPSET0 and only GPCLR0 respectively, because other pins stay; no need of reading GPLEV0.
+ *
+ * Return: GPIO32_SEQ_BEAT_END (All Zero), GPIO32_SEQ_BEAT_IGNORE (0b00 on Bit[31:30]), or GPIO32_SEQ_BEAT_WRITE
+ */
+uint32 gpio32_seq_encode_beat( gpio_sequence beat, uint32 mask, uint32* clear, uint32* set );
+
+/**
+ * Levels of GPIO 0-29 After One Beat of gpio32_gpioplay, Reference to Check Compiled CBs
+ *
+ * Return: Levels
+ */
+uint32 gpio32_seq_step( gpio_sequence beat, uint32 mask, uint32 level );
+
+/**
+ * Compile GPIO Sequence to Chain of CBs
+ * One beat is one CB to wait for DREQ, and up to two CBs to write GPCLR0 then GPSET0.
+ * Values of GPCLR0 and GPSET0 are shared among repeats, so unrolled repeats add CBs only.
+ * If the buffer is NULL, nothing is written and only bytes are returned to calculate the size of the buffer.
+ * The buffer must be 256-bit aligned, and the bus address is the address of the buffer in view of DMA.
+ * length is the maximum number of beats; a beat of all zero ends the sequence as well.
+ * repeat is the number of repeats (1 and more), or GPIO32_SEQ_LOOP.
+ * If flag_inten is true, the last CB issues the interrupt of the channel (not in loop).
+ *
+ * Return: Bytes of Buffer, 0 as Error (No Beat, Repeat Is Zero, or Unknown Timebase)
+ */
+uint32 gpio32_seq_compile( uchar8* buffer, uint32 bus_address, gpio_sequence* sequence, uint32 length, uint32 mask, int32 repeat, uchar8 timebase, bool flag_inten );
+
+/**
+ * Simulate Chain of CBs from the First CB
+ * Levels of GPIO 0-29 after each beat are stored to the array of levels.
+ * Simulation ends at the last CB, or at max_beats to stop a loop.
+ *
+ * Return: Number of Beats, -1 as CB or Source out of Buffer, -2 as Unknown Destination
+ */
+int32 gpio32_seq_simulate( uchar8* buffer, uint32 bus_address, uint32 size, uint32 level, uint32* levels, uint32 max_beats );
@@ -0,0 +1,123 @@
+/**
+ * gpio32/sequencer_test.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * Host check of sequencer.c.
+ * Sequences are compiled to chains of CBs, and levels simulated from the chains are compared with gpio32_seq_step,
+ * the reference of gpio32_gpioplay.
+ * Build on Host: cc -D__ARMV7=1 -include share/include/system32.h -include share/include/gpio32/sequencer.h -include share/include/gpio32/sequencer.c -o sequencer_test share/include/gpio32/sequencer_test.c
+ * Run on Host: ./sequencer_test
+ * Return: 0 as success, 1 as failure
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#define SEQUENCER_TEST_BUS     0xC0100000 // Bus Address of Buffer, Arbitrary
+#define SEQUENCER_TEST_BUFFER  4096
+#define SEQUENCER_TEST_BEATS   64
+
+static uchar8 buffer[SEQUENCER_TEST_BUFFER] __attribute__((aligned(32)));
+
+/* Pins 0-3, Four Kinds of Beats; 0b00 on Bit[31:30] Is Ignored */
+static gpio_sequence sequence[] = {
+	0x80000005, // Change All: 0 and 2 High, 1 and 3 Low
+	0xC0000002, // Set 1
+	0x40000001, // Clear 0
+	0x00000008, // Ignore
+	0x8000000A, // Change All: 1 and 3 High
+	0x40000008, // Clear 3
+	GPIO32_END
+};
+
+static uint32 test_sequence( char* name, uint32 length, uint32 mask, int32 repeat, uchar8 timebase, bool flag_inten, uint32 level_start ) {
+	uint32 levels[SEQUENCER_TEST_BEATS];
+	uint32 expected[SEQUENCER_TEST_BEATS];
+	uint32 number_expected = 0;
+	uint32 number_beat = 0;
+	uint32 level = level_start & 0x3FFFFFFF;
+	uint32 max_beats;
+
+	/* Size Query Then Compile */
+	uint32 size = gpio32_seq_compile( NULL, SEQUENCER_TEST_BUS, sequence, length, mask, repeat, timebase, flag_inten );
+	if ( ! size || size > SEQUENCER_TEST_BUFFER ) {
+		printf( "%s: Size %d Is Invalid\n", name, (int)size );
+		return 1;
+	}
+	memset( buffer, 0xFF, SEQUENCER_TEST_BUFFER );
+	if ( gpio32_seq_compile( buffer, SEQUENCER_TEST_BUS, sequence, length, mask, repeat, timebase, flag_inten ) != size ) {
+		printf( "%s: Size Is Not Same as Query\n", name );
+		return 1;
+	}
+
+	/* Reference */
+	for ( uint32 i = 0; i < length && sequence[i] != GPIO32_END; i++ ) number_beat++;
+	max_beats = repeat == GPIO32_SEQ_LOOP ? number_beat * 3 : SEQUENCER_TEST_BEATS;
+	for ( uint32 pass = 0; number_expected < max_beats; pass++ ) {
+		if ( repeat != GPIO32_SEQ_LOOP && pass >= (uint32)repeat ) break;
+		for ( uint32 i = 0; i < number_beat && number_expected < max_beats; i++ ) {
+			level = gpio32_seq_step( sequence[i], mask, level );
+			expected[number_expected++] = level;
+		}
+	}
+
+	int32 result = gpio32_seq_simulate( buffer, SEQUENCER_TEST_BUS, size, level_start, levels, max_beats );
+	if ( result != (int32)number_expected ) {
+		printf( "%s: Beats %d, Expected %d\n", name, (int)result, (int)number_expected );
+		return 1;
+	}
+	for ( uint32 i = 0; i < number_expected; i++ ) {
+		if ( levels[i] != expected[i] ) {
+			printf( "%s: Beat %d, Level 0x%08X, Expected 0x%08X\n", name, (int)i, (unsigned int)levels[i], (unsigned int)expected[i] );
+			return 1;
+		}
+	}
+
+	/* Interrupt Only on Last CB, Not in Loop; CBs Are in Order, So Count CBs by Next CB Address */
+	uint32 number_cb = 1;
+	while ( number_cb * GPIO32_SEQ_CB_SIZE < size ) {
+		uint32 next = gpio32_seq_get32( buffer + (number_cb - 1) * GPIO32_SEQ_CB_SIZE + 20 );
+		if ( next != SEQUENCER_TEST_BUS + number_cb * GPIO32_SEQ_CB_SIZE ) break;
+		number_cb++;
+	}
+	for ( uint32 i = 0; i < number_cb; i++ ) {
+		bool inten = buffer[i * GPIO32_SEQ_CB_SIZE] & GPIO32_SEQ_TI_INTEN;
+		bool expected_inten = flag_inten && repeat != GPIO32_SEQ_LOOP && i + 1 == number_cb;
+		if ( inten != expected_inten ) {
+			printf( "%s: INTEN on CB %d Is Wrong\n", name, (int)i );
+			return 1;
+		}
+	}
+
+	printf( "%s: OK, %d Beats, %d Bytes\n", name, (int)number_expected, (int)size );
+	return 0;
+}
+
+int main( void ) {
+	uint32 result = 0;
+	uint32 length = sizeof(sequence) / sizeof(gpio_sequence);
+
+	result |= test_sequence( "PWM Once", length, 0xF, 1, GPIO32_SEQ_TIMEBASE_PWM, false, 0 );
+	result |= test_sequence( "PCM Repeat 3 with Interrupt", length, 0xF, 3, GPIO32_SEQ_TIMEBASE_PCM, true, 0 );
+	result |= test_sequence( "Mask 0b0101", length, 0x5, 2, GPIO32_SEQ_TIMEBASE_PWM, true, 0xA );
+	result |= test_sequence( "Loop", length, 0xF, GPIO32_SEQ_LOOP, GPIO32_SEQ_TIMEBASE_PWM, true, 0xF );
+	result |= test_sequence( "Length 2", 2, 0xF, 1, GPIO32_SEQ_TIMEBASE_PWM, false, 0 );
+
+	/* Errors */
+	if ( gpio32_seq_compile( NULL, SEQUENCER_TEST_BUS, sequence, length, 0xF, 0, GPIO32_SEQ_TIMEBASE_PWM, false )
+		|| gpio32_seq_compile( NULL, SEQUENCER_TEST_BUS, sequence, length, 0xF, 1, 0, false )
+		|| gpio32_seq_compile( NULL, SEQUENCER_TEST_BUS, sequence + length - 1, 1, 0xF, 1, GPIO32_SEQ_TIMEBASE_PWM, false ) ) {
+		printf( "Errors: Compiled with Zero Repeat, Unknown Timebase, or No Beat\n" );
+		result |= 1;
+	} else {
+		printf( "Errors: OK\n" );
+	}
+
+	return result;
+}
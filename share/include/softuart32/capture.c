@@ -0,0 +1,201 @@
+/**
+ * softuart32/capture.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/* Values Are Stored in Little Endian, Byte by Byte to Keep the Layout on a Host Machine with 64-bit Long */
+static void softuart32_cap_put32( uchar8* buffer, uint32 value ) {
+	buffer[0] = value & 0xFF;
+	buffer[1] = (value >> 8) & 0xFF;
+	buffer[2] = (value >> 16) & 0xFF;
+	buffer[3] = (value >> 24) & 0xFF;
+}
+
+static void softuart32_cap_put_cb( uchar8* cb, uint32 ti, uint32 source, uint32 destination, uint32 next ) {
+	softuart32_cap_put32( cb, ti );
+	softuart32_cap_put32( cb + 4, source );
+	softuart32_cap_put32( cb + 8, destination );
+	softuart32_cap_put32( cb + 12, 4 ); // Transfer Length, One Word
+	softuart32_cap_put32( cb + 16, 0 ); // 2D Stride
+	softuart32_cap_put32( cb + 20, next );
+	softuart32_cap_put32( cb + 24, 0 );
+	softuart32_cap_put32( cb + 28, 0 );
+}
+
+uint32 softuart32_cap_compile( uchar8* buffer, uint32 bus_address, uint32 samples, uchar8 timebase ) {
+	uint32 ti_pace;
+	uint32 bus_pace;
+	uint32 number_cb;
+	uint32 bus_data;
+	uint32 next;
+
+	if ( timebase == SOFTUART32_CAP_TIMEBASE_PWM ) {
+		bus_pace = SOFTUART32_CAP_BUS_PWM_FIF1;
+	} else if ( timebase == SOFTUART32_CAP_TIMEBASE_PCM ) {
+		bus_pace = SOFTUART32_CAP_BUS_PCM_FIFO;
+	} else {
+		return 0;
+	}
+	if ( ! samples ) return 0;
+	ti_pace = timebase << SOFTUART32_CAP_TI_PERMAP|SOFTUART32_CAP_TI_DST_DREQ|SOFTUART32_CAP_TI_WAIT_RESP|SOFTUART32_CAP_TI_NO_WIDE_BURSTS;
+
+	number_cb = samples * SOFTUART32_CAP_CB_PER_SAMPLE;
+	if ( buffer == NULL ) return number_cb * SOFTUART32_CAP_CB_SIZE + (1 + samples) * 4;
+
+	/* Data[0] Is Dummy to Be Sent to FIFO of Timebase, Levels Follow */
+	bus_data = bus_address + number_cb * SOFTUART32_CAP_CB_SIZE;
+	softuart32_cap_put32( buffer + number_cb * SOFTUART32_CAP_CB_SIZE, 0 );
+
+	for ( uint32 i = 0; i < samples; i++ ) {
+		/* Wait for DREQ First, Then Copy GPLEV0 Right After Tick of Timebase */
+		next = bus_address + (i * SOFTUART32_CAP_CB_PER_SAMPLE + 1) * SOFTUART32_CAP_CB_SIZE;
+		softuart32_cap_put_cb( buffer + i * SOFTUART32_CAP_CB_PER_SAMPLE * SOFTUART32_CAP_CB_SIZE, ti_pace, bus_data, bus_pace, next );
+		next += SOFTUART32_CAP_CB_SIZE;
+		if ( i + 1 == samples ) next = bus_address; // Ring
+		softuart32_cap_put_cb( buffer + (i * SOFTUART32_CAP_CB_PER_SAMPLE + 1) * SOFTUART32_CAP_CB_SIZE, SOFTUART32_CAP_TI_WAIT_RESP|SOFTUART32_CAP_TI_NO_WIDE_BURSTS, SOFTUART32_CAP_BUS_GPLEV0, bus_data + (1 + i) * 4, next );
+		softuart32_cap_put32( buffer + number_cb * SOFTUART32_CAP_CB_SIZE + (1 + i) * 4, 0 );
+	}
+
+	return number_cb * SOFTUART32_CAP_CB_SIZE + (1 + samples) * 4;
+}
+
+uint32* softuart32_cap_levels( uchar8* buffer, uint32 samples ) {
+	return (uint32*)(buffer + samples * SOFTUART32_CAP_CB_PER_SAMPLE * SOFTUART32_CAP_CB_SIZE + 4);
+}
+
+int32 softuart32_cap_head( uint32 bus_cb, uint32 bus_address, uint32 samples ) {
+	uint32 index_cb;
+	if ( bus_cb < bus_address ) return -1;
+	index_cb = (bus_cb - bus_address) / SOFTUART32_CAP_CB_SIZE;
+	if ( index_cb >= samples * SOFTUART32_CAP_CB_PER_SAMPLE ) return -1;
+	return index_cb / SOFTUART32_CAP_CB_PER_SAMPLE;
+}
+
+uint32 softuart32_cap_channel_init( _SoftUARTCapture* channel, uint32 gpio, uint32 ratio, uint32 bits, uint32 bits_stop, uchar8* buffer, uint32 size ) {
+	if ( gpio > 31 || ratio < 3 << SOFTUART32_CAP_FIXED || bits < 5 || bits > 9 || bits_stop < 1 || bits_stop > 2 ) return 1;
+	channel->gpio = gpio;
+	channel->ratio = ratio;
+	channel->bits = bits;
+	channel->bits_stop = bits_stop;
+	channel->buffer = buffer;
+	channel->size = size;
+	channel->count = 0;
+	channel->error_framing = 0;
+	channel->error_overrun = 0;
+	channel->breaks = 0;
+	channel->status = SOFTUART32_CAP_IDLE;
+	channel->level = 1; // Idle Line Is High
+	channel->countdown = 0;
+	channel->index = 0;
+	channel->data = 0;
+	return 0;
+}
+
+/* Returns 1 If Byte Is Stored */
+static uint32 softuart32_cap_bit( _SoftUARTCapture* channel, uint32 level ) {
+	uint32 index = channel->index++;
+	if ( index == 0 ) { // Start Bit
+		if ( level ) channel->status = SOFTUART32_CAP_IDLE; // Glitch
+		return 0;
+	}
+	if ( index <= channel->bits ) {
+		channel->data |= level << (index - 1);
+		return 0;
+	}
+	/* Stop Bits */
+	if ( ! level ) {
+		if ( channel->data ) {
+			channel->error_framing++;
+		} else {
+			channel->breaks++;
+		}
+		channel->status = SOFTUART32_CAP_IDLE; // Wait for High, Then Next Falling Edge
+		return 0;
+	}
+	if ( index < channel->bits + channel->bits_stop ) return 0;
+	channel->status = SOFTUART32_CAP_IDLE;
+	if ( channel->count >= channel->size ) {
+		channel->error_overrun++;
+		return 0;
+	}
+	channel->buffer[channel->count++] = channel->data & 0xFF;
+	return 1;
+}
+
+uint32 softuart32_cap_decode( uint32* levels, uint32 samples, uint32 tail, uint32 head, _SoftUARTCapture* channels, uint32 number_channels ) {
+	uint32 number_byte = 0;
+	uint32 value;
+	uint32 level;
+	_SoftUARTCapture* channel;
+
+	if ( ! samples || tail >= samples || head >= samples ) return 0;
+	while ( tail != head ) {
+		value = levels[tail];
+		for ( uint32 i = 0; i < number_channels; i++ ) {
+			channel = &channels[i];
+			level = (value >> channel->gpio) & 1;
+			if ( channel->status == SOFTUART32_CAP_IDLE ) {
+				if ( channel->level && ! level ) {
+					/* Edge Is Half Sample Before, Next Check on Center of Start Bit */
+					channel->status = SOFTUART32_CAP_FRAME;
+					channel->countdown = (channel->ratio >> 1) - (1 << (SOFTUART32_CAP_FIXED - 1));
+					channel->index = 0;
+					channel->data = 0;
+				}
+			} else {
+				channel->countdown -= 1 << SOFTUART32_CAP_FIXED;
+				if ( channel->countdown <= 0 ) {
+					channel->countdown += channel->ratio;
+					number_byte += softuart32_cap_bit( channel, level );
+				}
+			}
+			channel->level = level;
+		}
+		tail++;
+		if ( tail >= samples ) tail = 0;
+	}
+	return number_byte;
+}
+
+/* Write Samples of One Bit, Position Is Fractional Samples Carried to Next Bit */
+static uint32 softuart32_cap_emit( uint32* levels, uint32 samples, uint32* index, uint32* position, uint32 gpio, uint32 ratio, uint32 level ) {
+	while ( *position < ratio ) {
+		if ( *index >= samples ) return 1;
+		levels[*index] = (levels[*index] & ~(1 << gpio)) | level << gpio;
+		(*index)++;
+		*position += 1 << SOFTUART32_CAP_FIXED;
+	}
+	*position -= ratio;
+	return 0;
+}
+
+uint32 softuart32_cap_synthesize( uint32* levels, uint32 samples, uint32 gpio, uint32 ratio, uint32 bits, uint32 bits_stop, uchar8* bytes, uint32 length, uint32 idle ) {
+	uint32 index = 0;
+	uint32 position = 0;
+	uint32 error = 0;
+	uint32 idle_ratio = idle << SOFTUART32_CAP_FIXED;
+
+	if ( gpio > 31 || ratio < 1 << SOFTUART32_CAP_FIXED ) return 0;
+	error |= softuart32_cap_emit( levels, samples, &index, &position, gpio, ratio, 1 );
+	if ( ! length ) {
+		/* Break, Then Mark After Break */
+		error |= softuart32_cap_emit( levels, samples, &index, &position, gpio, idle_ratio, 0 );
+		error |= softuart32_cap_emit( levels, samples, &index, &position, gpio, ratio, 1 );
+	}
+	for ( uint32 i = 0; i < length; i++ ) {
+		error |= softuart32_cap_emit( levels, samples, &index, &position, gpio, ratio, 0 );
+		for ( uint32 j = 0; j < bits; j++ ) {
+			error |= softuart32_cap_emit( levels, samples, &index, &position, gpio, ratio, (bytes[i] >> j) & 1 );
+		}
+		for ( uint32 j = 0; j < bits_stop; j++ ) {
+			error |= softuart32_cap_emit( levels, samples, &index, &position, gpio, ratio, 1 );
+		}
+		if ( idle ) error |= softuart32_cap_emit( levels, samples, &index, &position, gpio, idle_ratio, 1 );
+	}
+	if ( error ) return 0;
+	return index;
+}
@@ -0,0 +1,118 @@
+/**
+ * softuart32/capture.h
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * This header file is for receiving software UART from levels of GPIO captured by DMA,
+ * instead of sampling one pin on each tick of FIQ by softuart32_softuartreceiver in ../(asterisk)/system32/library/softuart32.s.
+ * A ring of CBs waits for DREQ of PWM or PCM as the timebase, then copies GPLEV0 to a ring of levels on each sample.
+ * The ring loops on the DMA engine, and the decoder extracts frames of several pins from levels on the main loop.
+ * Functions in capture.c touch only buffers given by pointers, i.e., no heap, no peripherals.
+ * So, capture.c can be built and checked on a host machine with synthetic levels made by softuart32_cap_synthesize.
+ * On the target, allocate the buffer with heap32_malloc (28 bytes more to align the buffer to 32 bytes),
+ * and pass the ARM side address + V3D32_BUS_COHERENCE (Same as equ32_bus_coherence_base) as the bus address.
+ * Set the timebase with `_gpiodmatimebase`, and play the buffer with `_gpiodmaplay`.
+ * Then, take `_gpiodmacapture` of levels and decode levels from the last head to the current head.
+ * Build on Host: cc -include share/include/system32.h -include share/include/softuart32/capture.h -c share/include/softuart32/capture.c
+ * Check on Host: See capture_test.c, which decodes frames and breaks synthesized on two pins through a ring.
+ */
+
+/* Layout of Buffer: CBs (Two per Sample, 8 Words Each, 256-bit Align), Dummy Word, Then Levels, Little Endian */
+#define SOFTUART32_CAP_CB_SIZE             32
+#define SOFTUART32_CAP_CB_PER_SAMPLE       2
+
+/* Bus Addresses of Peripherals, Same on BCM2835 and BCM2836/BCM2837 */
+#define SOFTUART32_CAP_BUS_GPLEV0          0x7E200034
+#define SOFTUART32_CAP_BUS_PWM_FIF1        0x7E20C018
+#define SOFTUART32_CAP_BUS_PCM_FIFO        0x7E203004
+
+/* Transfer Information, Same as equ32_dma_ti_* in equ32.s */
+#define SOFTUART32_CAP_TI_NO_WIDE_BURSTS   0x04000000
+#define SOFTUART32_CAP_TI_PERMAP           16 // Bit[20:16]
+#define SOFTUART32_CAP_TI_DST_DREQ         0x00000040
+#define SOFTUART32_CAP_TI_WAIT_RESP        0x00000008
+
+/* Timebase, DREQ Number Is Same as equ32_dma_dreq_* in equ32.s */
+#define SOFTUART32_CAP_TIMEBASE_PCM        2
+#define SOFTUART32_CAP_TIMEBASE_PWM        5
+
+/* Fixed Point of Samples per Bit, Bit[31:16] as Integer, Bit[15:0] as Fractional */
+#define SOFTUART32_CAP_FIXED               16
+
+/* Status of Channel */
+#define SOFTUART32_CAP_IDLE                0
+#define SOFTUART32_CAP_FRAME               1
+
+typedef struct softuart32_CaptureChannel {
+	uint32 gpio; // 0-31 on GPLEV0
+	uint32 ratio; // Samples per Bit, Fixed Point by SOFTUART32_CAP_FIXED, 3.0 and More
+	uint32 bits; // Data Bits, 5 to 9, LSB First
+	uint32 bits_stop; // Stop Bits, 1 or 2
+	uchar8* buffer; // Received Bytes, Bit[8] of 9-bit Data Is Dropped
+	uint32 size; // Size of Buffer
+	uint32 count; // Bytes Stored in Buffer, Cleared by User
+	uint32 error_framing; // Stop Bit Is Low
+	uint32 error_overrun; // Buffer Is Full
+	uint32 breaks; // All Low in Frame, Not Stored
+	/* Status of Decoder, Cleared by softuart32_cap_channel_init */
+	uint32 status;
+	uint32 level; // Last Level, 1 as High
+	int32 countdown; // Samples to Next Center of Bit, Fixed Point
+	uint32 index; // Bit Index in Frame, 0 as Start Bit
+	uint32 data;
+} _SoftUARTCapture;
+
+/**
+ * Compile Ring of CBs to Capture Levels of GPIO 0-31
+ * Each sample is one CB to wait for DREQ, and one CB to copy GPLEV0 to the ring of levels.
+ * The last CB links to the first CB, so capture continues until _gpiodmastop.
+ * If the buffer is NULL, nothing is written and only bytes are returned to calculate the size of the buffer.
+ * The buffer must be 256-bit aligned, and the bus address is the address of the buffer in view of DMA.
+ *
+ * Return: Bytes of Buffer, 0 as Error (Samples Are Zero, or Unknown Timebase)
+ */
+uint32 softuart32_cap_compile( uchar8* buffer, uint32 bus_address, uint32 samples, uchar8 timebase );
+
+/**
+ * Pointer of Ring of Levels in Buffer Compiled by softuart32_cap_compile
+ */
+uint32* softuart32_cap_levels( uchar8* buffer, uint32 samples );
+
+/**
+ * Index of Next Sample to Be Written, from Bus Address of Current CB Returned by _gpiodmacapture
+ * Samples before the index in the ring have been captured on this lap.
+ *
+ * Return: Index (0 to samples - 1), -1 as CB out of Buffer
+ */
+int32 softuart32_cap_head( uint32 bus_cb, uint32 bus_address, uint32 samples );
+
+/**
+ * Initialize Channel for Decoder
+ * ratio is samples per bit in fixed point, e.g., sample rate / baud rate << SOFTUART32_CAP_FIXED.
+ *
+ * Return: 0 as Success, 1 as Error (GPIO, Ratio, or Bits Are Out of Range)
+ */
+uint32 softuart32_cap_channel_init( _SoftUARTCapture* channel, uint32 gpio, uint32 ratio, uint32 bits, uint32 bits_stop, uchar8* buffer, uint32 size );
+
+/**
+ * Decode Levels of Ring from Tail to Head (Exclusive) for All Channels
+ * Each channel finds the falling edge of the start bit, then checks the center of each bit.
+ * Status of each channel continues to the next call, so pass the head of this call as the tail of the next call.
+ *
+ * Return: Number of Bytes Stored in All Channels
+ */
+uint32 softuart32_cap_decode( uint32* levels, uint32 samples, uint32 tail, uint32 head, _SoftUARTCapture* channels, uint32 number_channels );
+
+/**
+ * Synthesize Levels of Frames on One GPIO to Check Decoder
+ * Levels of other pins are not changed. The line is high (idle) before the first frame and after the last frame.
+ * idle is samples of high between frames, or samples of low as break if length is zero.
+ *
+ * Return: Number of Samples Written, 0 as Error (Levels Are Short)
+ */
+uint32 softuart32_cap_synthesize( uint32* levels, uint32 samples, uint32 gpio, uint32 ratio, uint32 bits, uint32 bits_stop, uchar8* bytes, uint32 length, uint32 idle );
@@ -0,0 +1,155 @@
+/**
+ * softuart32/capture_test.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * Host check of capture.c.
+ * Frames on two pins with different baud rates and formats, and a break on each pin, are synthesized to levels.
+ * Levels are fed to a ring in chunks as DMA does, decoded from tail to head across the end of the ring,
+ * and received bytes, breaks and errors are compared with the synthesized ones.
+ * Build on Host: cc -D__ARMV7=1 -include share/include/system32.h -include share/include/softuart32/capture.h -include share/include/softuart32/capture.c -o capture_test share/include/softuart32/capture_test.c
+ * Run on Host: ./capture_test
+ * Return: 0 as success, 1 as failure
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#define CAPTURE_TEST_SAMPLES   8192 // Synthesized Levels
+#define CAPTURE_TEST_RING      500  // Ring of Levels, Not Multiple of Chunk to Wrap on Various Positions
+#define CAPTURE_TEST_CHUNK     37   // Samples per Call of Decoder
+#define CAPTURE_TEST_BUS       0xC0200000
+
+static uint32 linear[CAPTURE_TEST_SAMPLES];
+static uint32 ring[CAPTURE_TEST_RING];
+
+typedef struct _TestPin {
+	char* name;
+	uint32 gpio;
+	uint32 ratio;
+	uint32 bits;
+	uint32 bits_stop;
+	uchar8 bytes[8];
+	uint32 length;
+	bool flag_break_first; // Break Then Bytes, Otherwise Bytes Then Break
+} _TestPin;
+
+static _TestPin pins[] = {
+	{ "GPIO 4, 8 Samples per Bit, 8N1", 4, 8 << SOFTUART32_CAP_FIXED, 8, 1, { 'H', 'e', 'l', 'l', 'o', 0x00, 0xFF, 0x55 }, 8, false },
+	{ "GPIO 17, 5.5 Samples per Bit, 7N2", 17, 11 << (SOFTUART32_CAP_FIXED - 1), 7, 2, { 0x7F, 0x01, 'A', 'z', 0x40 }, 5, true }
+};
+
+/* Returns Index After Synthesized Samples, 0 as Error */
+static uint32 test_synthesize( _TestPin* pin ) {
+	uint32 index = 0;
+	uint32 written;
+	/* Break Is 12 Bits of Low, More Than One Frame */
+	uint32 samples_break = (12 * pin->ratio) >> SOFTUART32_CAP_FIXED;
+	if ( pin->flag_break_first ) {
+		written = softuart32_cap_synthesize( linear, CAPTURE_TEST_SAMPLES, pin->gpio, pin->ratio, pin->bits, pin->bits_stop, NULL, 0, samples_break );
+		if ( ! written ) return 0;
+		index += written;
+	}
+	written = softuart32_cap_synthesize( linear + index, CAPTURE_TEST_SAMPLES - index, pin->gpio, pin->ratio, pin->bits, pin->bits_stop, pin->bytes, pin->length, 3 );
+	if ( ! written ) return 0;
+	index += written;
+	if ( ! pin->flag_break_first ) {
+		written = softuart32_cap_synthesize( linear + index, CAPTURE_TEST_SAMPLES - index, pin->gpio, pin->ratio, pin->bits, pin->bits_stop, NULL, 0, samples_break );
+		if ( ! written ) return 0;
+		index += written;
+	}
+	return index;
+}
+
+static uint32 test_compile() {
+	uchar8 buffer[16 * SOFTUART32_CAP_CB_PER_SAMPLE * SOFTUART32_CAP_CB_SIZE + (1 + 16) * 4];
+	uint32 samples = 16;
+	uint32 size = softuart32_cap_compile( NULL, CAPTURE_TEST_BUS, samples, SOFTUART32_CAP_TIMEBASE_PWM );
+	if ( size != sizeof(buffer) || softuart32_cap_compile( buffer, CAPTURE_TEST_BUS, samples, SOFTUART32_CAP_TIMEBASE_PWM ) != size ) {
+		printf( "Compile: Size %d Is Invalid\n", (int)size );
+		return 1;
+	}
+	/* Ring: Last CB Links to First CB, Each Copy CB Writes Next Word of Levels */
+	for ( uint32 i = 0; i < samples * SOFTUART32_CAP_CB_PER_SAMPLE; i++ ) {
+		uchar8* cb = buffer + i * SOFTUART32_CAP_CB_SIZE;
+		uint32 next = cb[20]|cb[21]<<8|cb[22]<<16|(uint32)cb[23]<<24;
+		uint32 destination = cb[8]|cb[9]<<8|cb[10]<<16|(uint32)cb[11]<<24;
+		uint32 expected_next = i + 1 == samples * SOFTUART32_CAP_CB_PER_SAMPLE ? CAPTURE_TEST_BUS : CAPTURE_TEST_BUS + (i + 1) * SOFTUART32_CAP_CB_SIZE;
+		if ( next != expected_next ) {
+			printf( "Compile: Next of CB %d Is Wrong\n", (int)i );
+			return 1;
+		}
+		if ( i % SOFTUART32_CAP_CB_PER_SAMPLE && destination != CAPTURE_TEST_BUS + samples * SOFTUART32_CAP_CB_PER_SAMPLE * SOFTUART32_CAP_CB_SIZE + (1 + i / SOFTUART32_CAP_CB_PER_SAMPLE) * 4 ) {
+			printf( "Compile: Destination of CB %d Is Wrong\n", (int)i );
+			return 1;
+		}
+		if ( softuart32_cap_head( CAPTURE_TEST_BUS + i * SOFTUART32_CAP_CB_SIZE, CAPTURE_TEST_BUS, samples ) != (int32)(i / SOFTUART32_CAP_CB_PER_SAMPLE) ) {
+			printf( "Compile: Head of CB %d Is Wrong\n", (int)i );
+			return 1;
+		}
+	}
+	if ( softuart32_cap_head( CAPTURE_TEST_BUS + size, CAPTURE_TEST_BUS, samples ) != -1 || softuart32_cap_compile( NULL, CAPTURE_TEST_BUS, samples, 0 ) ) {
+		printf( "Compile: Errors Are Not Detected\n" );
+		return 1;
+	}
+	printf( "Compile: OK, %d Bytes\n", (int)size );
+	return 0;
+}
+
+int main( void ) {
+	_SoftUARTCapture channels[2];
+	uchar8 received[2][16];
+	uint32 number_pins = sizeof(pins) / sizeof(_TestPin);
+	uint32 total = 0;
+	uint32 result = 0;
+
+	result |= test_compile();
+
+	/* Idle Line Is High on All Pins */
+	for ( uint32 i = 0; i < CAPTURE_TEST_SAMPLES; i++ ) linear[i] = 0xFFFFFFFF;
+	for ( uint32 i = 0; i < number_pins; i++ ) {
+		uint32 index = test_synthesize( &pins[i] );
+		if ( ! index ) {
+			printf( "%s: Failure on Synthesizing\n", pins[i].name );
+			return 1;
+		}
+		if ( index > total ) total = index;
+		softuart32_cap_channel_init( &channels[i], pins[i].gpio, pins[i].ratio, pins[i].bits, pins[i].bits_stop, received[i], sizeof(received[i]) );
+	}
+	total += CAPTURE_TEST_CHUNK; // Trailing Idle
+
+	/* Feed Ring in Chunks, Then Decode from Last Head to Current Head */
+	uint32 tail = 0;
+	uint32 number_byte = 0;
+	for ( uint32 position = 0; position < total; position += CAPTURE_TEST_CHUNK ) {
+		for ( uint32 i = 0; i < CAPTURE_TEST_CHUNK; i++ ) ring[(position + i) % CAPTURE_TEST_RING] = linear[position + i];
+		uint32 head = (position + CAPTURE_TEST_CHUNK) % CAPTURE_TEST_RING;
+		number_byte += softuart32_cap_decode( ring, CAPTURE_TEST_RING, tail, head, channels, number_pins );
+		tail = head;
+	}
+
+	for ( uint32 i = 0; i < number_pins; i++ ) {
+		_SoftUARTCapture* channel = &channels[i];
+		uint32 mask = (1 << pins[i].bits) - 1;
+		uint32 error = channel->count != pins[i].length || channel->breaks != 1 || channel->error_framing || channel->error_overrun;
+		for ( uint32 j = 0; ! error && j < pins[i].length; j++ ) error = received[i][j] != (pins[i].bytes[j] & mask);
+		if ( error ) {
+			printf( "%s: Bytes %d, Breaks %d, Framing Errors %d, Overruns %d\n", pins[i].name, (int)channel->count, (int)channel->breaks, (int)channel->error_framing, (int)channel->error_overrun );
+			for ( uint32 j = 0; j < channel->count; j++ ) printf( "  %d: 0x%02X, Expected 0x%02X\n", (int)j, received[i][j], (unsigned int)(pins[i].bytes[j] & mask) );
+			result |= 1;
+		} else {
+			printf( "%s: OK, %d Bytes and Break\n", pins[i].name, (int)channel->count );
+		}
+	}
+	if ( number_byte != pins[0].length + pins[1].length ) {
+		printf( "Decode: Returned %d Bytes in Total\n", (int)number_byte );
+		result |= 1;
+	}
+
+	return result;
+}
@@ -0,0 +1,119 @@
+/**
+ * sts32/midievent.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/* Timestamps and Indexes Are 32-bit on the Target, Wrap Around on a Host Machine with 64-bit Long as well */
+#define STS32_MIDIEVENT_WORD 0xFFFFFFFF
+
+uint32 sts32_midievent_init( _MidiEventQueue* queue, uint32* buffer, uint32 number, uint32 channel ) {
+	uint32 power = 1;
+	if ( ! number ) return 1;
+	while ( power <= number >> 1 ) power <<= 1; // Round Down to Power of 2
+	queue->queue = buffer;
+	queue->mask = power - 1;
+	queue->head = 0;
+	queue->tail = 0;
+	queue->running = 0;
+	queue->data = 0;
+	queue->count = 0;
+	queue->channel = channel & 0x0F;
+	queue->dropped = 0;
+	queue->due = STS32_MIDIEVENT_FAR;
+	return 0;
+}
+
+uint32 sts32_midievent_parse( _MidiEventQueue* queue, uint32* words, uint32 length, uint32 samples ) {
+	uint32 byte;
+	uint32 number_data;
+	uint32* event;
+
+	if ( queue->queue == NULL ) return 1;
+	for ( uint32 i = 0; i < length; i++ ) {
+		byte = words[i];
+		if ( byte & STS32_MIDIEVENT_DR_ERRORS ) {
+			queue->running = 0; // Discard Message on Error
+			continue;
+		}
+		byte &= 0xFF;
+		/* If 0b11111000 and Above, System Real Time Messages Don't Affect Running Status */
+		if ( byte >= 248 ) continue;
+		if ( byte & 0x80 ) {
+			/* Status Byte */
+			queue->count = 0;
+			queue->data = 0;
+			queue->running = byte;
+			/* System Common Messages and System Exclusive Cancel Running Status */
+			if ( queue->running >= 0xF0 ) {
+				queue->running = 0;
+				continue;
+			}
+			if ( (queue->running & 0x0F) != queue->channel ) queue->running = 0; // Ignore Data Bytes
+			continue;
+		}
+		if ( ! queue->running ) continue; // No Status, e.g., Data of System Exclusive
+		queue->data |= byte << (queue->count << 3);
+		queue->count++;
+		/* Program Change and Channel Pressure Have One Data Byte */
+		number_data = (queue->running & 0xF0) == 0xC0 || (queue->running & 0xF0) == 0xD0 ? 1 : 2;
+		if ( queue->count < number_data ) continue;
+		if ( ((queue->head - queue->tail) & STS32_MIDIEVENT_WORD) > queue->mask ) {
+			queue->dropped++;
+		} else {
+			event = queue->queue + ((queue->head & queue->mask) << 1);
+			event[0] = (samples + STS32_MIDIEVENT_LATENCY) & STS32_MIDIEVENT_WORD; // Timestamp
+			event[1] = queue->running | queue->data << 8; // Message
+			queue->head = (queue->head + 1) & STS32_MIDIEVENT_WORD;
+		}
+		/* Keep Running Status */
+		queue->count = 0;
+		queue->data = 0;
+	}
+	/* Timestamp of Oldest Event to Be Due */
+	if ( queue->head != queue->tail ) queue->due = queue->queue[(queue->tail & queue->mask) << 1];
+	return queue->dropped ? 1 : 0;
+}
+
+bool sts32_midievent_due( _MidiEventQueue* queue, uint32 samples ) {
+	return ! ((samples - queue->due) & 0x80000000);
+}
+
+uint32 sts32_midievent_dispatch( _MidiEventQueue* queue, uint32 samples, uint32* messages, uint32 size ) {
+	uint32 number_message = 0;
+	uint32* event;
+
+	if ( queue->queue != NULL ) {
+		while ( queue->tail != queue->head ) {
+			event = queue->queue + ((queue->tail & queue->mask) << 1);
+			if ( (samples - event[0]) & 0x80000000 || number_message >= size ) {
+				queue->due = event[0]; // Not Due Yet, or Due on Next Check
+				return number_message;
+			}
+			queue->tail = (queue->tail + 1) & STS32_MIDIEVENT_WORD;
+			messages[number_message++] = event[1];
+		}
+	}
+	queue->due = (samples + STS32_MIDIEVENT_FAR) & STS32_MIDIEVENT_WORD; // Far Future
+	return number_message;
+}
+
+uchar8 sts32_midievent_unpack( uint32 message, uchar8* buffer, uint32* count ) {
+	uchar8 last;
+	buffer[0] = (message >> 4) & 0x0F; // Omit Channel Number
+	if ( (message & 0xE0) == 0xC0 ) { // Program Change and Channel Pressure Have One Data Byte
+		last = (message >> 8) & 0xFF;
+		*count = 1;
+	} else {
+		buffer[1] = (message >> 8) & 0xFF;
+		last = (message >> 16) & 0xFF;
+		*count = 2;
+	}
+	/* sts32_synthemidi_byte Stores Last Data Byte */
+	buffer[*count] = last;
+	(*count)++;
+	return last;
+}
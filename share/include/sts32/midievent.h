@@ -0,0 +1,83 @@
+/**
+ * sts32/midievent.h
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * This header file is for the model of the queue of timestamped MIDI events in ../(asterisk)/system32/library/sts32.s.
+ * sts32_midievent_parse is the same procedure as sts32_synthemidi_event (parser in UART interrupt),
+ * sts32_midievent_due is the same check as the render loop of sts32_synthewave_*,
+ * and sts32_midievent_dispatch is the same procedure as sts32_synthemidi_dispatch,
+ * except that messages are returned to the caller instead of calling sts32_synthemidi_byte.
+ * sts32_midievent_unpack makes the message buffer and the last byte as sts32_synthemidi_dispatch gives to sts32_synthemidi_byte.
+ * Functions in midievent.c touch only buffers given by pointers, i.e., no heap, no peripherals.
+ * So, midievent.c can be built and checked on a host machine, and the onset of events can be measured in samples.
+ * If you change the procedures in sts32.s, change this model as well.
+ * Build on Host: cc -include share/include/system32.h -include share/include/sts32/midievent.h -c share/include/sts32/midievent.c
+ * Check on Host: See midievent_test.c, which feeds a MIDI byte stream through a simulated UART and measures the onset of events.
+ */
+
+#define STS32_MIDIEVENT_LATENCY            64 // Same as equ32_sts32_synthemidi_latency
+#define STS32_MIDIEVENT_FAR                0x7FFFFFFF // Due on Empty Queue, Relative to Current Sample
+
+/* Bits of Word on UART Data Register, Same as equ32_uart0_dr_* in equ32.s */
+#define STS32_MIDIEVENT_DR_ERRORS          0xF00 // Overrun, Break, Parity, and Framing Errors
+
+typedef struct sts32_MidiEventQueue {
+	uint32* queue; // Two Words for Each Event, Timestamp and Message (Bit[7:0] Status, Bit[15:8] Data 1, Bit[23:16] Data 2)
+	uint32 mask; // Number of Events - 1
+	uint32 head; // Incremented by sts32_midievent_parse Only
+	uint32 tail; // Incremented by sts32_midievent_dispatch Only
+	uint32 running; // Running Status
+	uint32 data; // Data Bytes of Outstanding Message
+	uint32 count; // Number of Data Bytes of Outstanding Message
+	uint32 channel; // 0-15
+	uint32 dropped; // Number of Events Dropped Because of Full Queue
+	uint32 due; // Timestamp of Next Event, STS32_SYNTHEWAVE_DUE
+} _MidiEventQueue;
+
+/**
+ * Initialize Queue, Same as sts32_synthemidi_eventmalloc
+ * The buffer needs two words for each event, and the number of events is rounded down to power of 2.
+ *
+ * Return: 0 as Success, 1 as Error (Number Is Zero)
+ */
+uint32 sts32_midievent_init( _MidiEventQueue* queue, uint32* buffer, uint32 number, uint32 channel );
+
+/**
+ * Parse Words Read from UART Data Register in One Interrupt
+ * All words are stamped with the same sample, samples + STS32_MIDIEVENT_LATENCY, as sts32_synthemidi_event.
+ *
+ * Return: 0 as Success, 1 as Error (Events Have Been Dropped Because of Full Queue)
+ */
+uint32 sts32_midievent_parse( _MidiEventQueue* queue, uint32* words, uint32 length, uint32 samples );
+
+/**
+ * Check of Render Loop Whether Current Sample Reaches Next Event
+ * Timestamps wrap around at 32 bits, and the difference is signed, as subs and bmi in sts32_synthewave_*.
+ *
+ * Return: True If Due
+ */
+bool sts32_midievent_due( _MidiEventQueue* queue, uint32 samples );
+
+/**
+ * Take Events Due on Current Sample
+ * Messages are stored to the array of messages in order. Events over size stay in the queue, and are due on the next check.
+ *
+ * Return: Number of Messages
+ */
+uint32 sts32_midievent_dispatch( _MidiEventQueue* queue, uint32 samples, uint32* messages, uint32 size );
+
+/**
+ * Unpack Message as sts32_synthemidi_dispatch and sts32_synthemidi_byte Do
+ * The first byte of the buffer is the type of the message (status >> 4), then data bytes.
+ * sts32_synthemidi_dispatch stores bytes except the last data byte, which is given to sts32_synthemidi_byte to complete the message.
+ * count is the number of bytes in the buffer after sts32_synthemidi_byte stores the last data byte.
+ *
+ * Return: Last Data Byte
+ */
+uchar8 sts32_midievent_unpack( uint32 message, uchar8* buffer, uint32* count );
@@ -0,0 +1,195 @@
+/**
+ * sts32/midievent_test.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * Host check of midievent.c.
+ * A MIDI byte stream with running status, System Exclusive, System Real Time, other channels, and an error byte
+ * arrives on a simulated UART at 31250 baud, and the interrupt parses RxFIFO on reaching 2 bytes or on Rx timeout as the synthesizer app.
+ * The render loop advances samples at 32000Hz and dispatches due events as sts32_synthewave_*.
+ * Messages are compared with the expected ones, and each event has to be applied at the stamped sample.
+ * The onset error (applied sample - stamped sample) and the delay from the last byte on the wire are reported.
+ * The delay varies by the Rx timeout of UART (32 bits, appx. 1ms), because the last byte of a message may wait on RxFIFO under the trigger level.
+ * Events are stamped in the interrupt, so this variation stays in the delay from the wire, not in the onset from the stamp.
+ * Build on Host: cc -D__ARMV7=1 -include share/include/system32.h -include share/include/sts32/midievent.h -include share/include/sts32/midievent.c -o midievent_test share/include/sts32/midievent_test.c
+ * Run on Host: ./midievent_test
+ * Return: 0 as success, 1 as failure
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#define MIDIEVENT_TEST_BYTE        1024 // Time of One Byte (10 Bits on 31250 Baud) in 1/100 Samples on 32000Hz
+#define MIDIEVENT_TEST_TIMEOUT     3277 // Rx Timeout, 32 Bits, in 1/100 Samples
+#define MIDIEVENT_TEST_TRIGGER     2    // Interrupt on Reaching 2 Bytes of RxFIFO
+#define MIDIEVENT_TEST_EVENTS      64   // Same as Synthesizer App
+#define MIDIEVENT_TEST_CHANNEL     0
+#define MIDIEVENT_TEST_ERROR       0x100 // Framing Error on UART Data Register
+
+typedef struct _TestByte {
+	uint32 word; // Word on UART Data Register
+	uint32 gap; // Idle Before This Byte in 1/100 Samples
+} _TestByte;
+
+static _TestByte stream[] = {
+	{ 0x90, 0 }, { 0x3C, 0 }, { 0x64, 0 }, // Note On
+	{ 0x40, 25000 }, { 0xF8, 0 }, { 0x64, 0 }, // Running Status, Timing Clock in Message
+	{ 0xF0, 7000 }, { 0x7E, 0 }, { 0x7F, 0 }, { 0x09, 0 }, { 0x01, 0 }, { 0xF7, 0 }, // System Exclusive
+	{ 0x43, 0 }, { 0x64, 0 }, // Data Bytes After System Exclusive, No Running Status
+	{ 0xC0, 12000 }, { 0x05, 0 }, // Program Change
+	{ 0xD0, 3000 }, { 0x40, 0 }, { 0x41, 0 }, // Channel Pressure with Running Status
+	{ 0x91, 0 }, { 0x40, 0 }, { 0x40, 0 }, { 0x41, 0 }, { 0x40, 0 }, // Other Channel
+	{ 0xE0, 900 }, { 0x00, 0 }, { 0xFE, 0 }, { 0x40, 0 }, // Pitch Bend, Active Sensing in Message
+	{ 0xB0, 0 }, { 0x07 | MIDIEVENT_TEST_ERROR, 0 }, { 0x64, 0 }, // Control Change with Error, Discarded
+	{ 0x80, 40000 }, { 0x3C, 0 }, { 0x00, 0 }, // Note Off
+	{ 0x3E, 0 }, { 0x00, 0 } // Running Status
+};
+
+static uint32 expected[] = { 0x643C90, 0x644090, 0x05C0, 0x40D0, 0x41D0, 0x4000E0, 0x003C80, 0x003E80 };
+
+static uint32 buffer[MIDIEVENT_TEST_EVENTS * 2];
+
+static uint32 test_stream( char* name, uint32 samples_start ) {
+	_MidiEventQueue queue;
+	uint32 number_bytes = sizeof(stream) / sizeof(_TestByte);
+	uint32 number_expected = sizeof(expected) / sizeof(uint32);
+	uint32 arrival[sizeof(stream) / sizeof(_TestByte)]; // Time of Last Bit in 1/100 Samples from Start
+	uint32 fifo[16];
+	uint32 fifo_arrival[16];
+	uint32 number_fifo = 0;
+	uint32 index_byte = 0;
+	uint32 stamps[sizeof(expected) / sizeof(uint32)];
+	uint32 completes[sizeof(expected) / sizeof(uint32)]; // Time of Last Byte of Message
+	uint32 number_stamp = 0;
+	uint32 number_applied = 0;
+	int32 error_max = 0;
+	int32 delay_min = 0x7FFFFFFF;
+	int32 delay_max = 0;
+	uint32 samples = samples_start;
+
+	if ( sts32_midievent_init( &queue, buffer, MIDIEVENT_TEST_EVENTS, MIDIEVENT_TEST_CHANNEL ) ) return 1;
+	for ( uint32 i = 0, time = 0; i < number_bytes; i++ ) {
+		time += stream[i].gap + MIDIEVENT_TEST_BYTE;
+		arrival[i] = time;
+	}
+
+	for ( uint32 tick = 0; tick < arrival[number_bytes - 1] / 100 + STS32_MIDIEVENT_LATENCY * 4; tick++ ) {
+		uint32 time = tick * 100;
+		/* UART Receives Bytes */
+		while ( index_byte < number_bytes && arrival[index_byte] <= time ) {
+			fifo_arrival[number_fifo] = arrival[index_byte];
+			fifo[number_fifo++] = stream[index_byte++].word;
+		}
+
+		/* Interrupt on Trigger Level or Rx Timeout, Then Parse All Bytes on RxFIFO with Same Sample */
+		if ( number_fifo >= MIDIEVENT_TEST_TRIGGER || (number_fifo && time - fifo_arrival[number_fifo - 1] >= MIDIEVENT_TEST_TIMEOUT) ) {
+			/* Byte by Byte Is Same as All at Once, to Know Which Byte Completes Event */
+			for ( uint32 j = 0; j < number_fifo; j++ ) {
+				uint32 head = queue.head;
+				if ( sts32_midievent_parse( &queue, fifo + j, 1, samples ) ) {
+					printf( "%s: Events Are Dropped\n", name );
+					return 1;
+				}
+				if ( queue.head == head ) continue;
+				if ( number_stamp >= number_expected ) {
+					printf( "%s: Too Many Events\n", name );
+					return 1;
+				}
+				stamps[number_stamp] = (samples + STS32_MIDIEVENT_LATENCY) & 0xFFFFFFFF;
+				completes[number_stamp] = fifo_arrival[j];
+				number_stamp++;
+			}
+			number_fifo = 0;
+		}
+
+		/* Render One Sample, Then Check Due as sts32_synthewave_* */
+		samples = (samples + 1) & 0xFFFFFFFF;
+		if ( sts32_midievent_due( &queue, samples ) ) {
+			uint32 messages[MIDIEVENT_TEST_EVENTS];
+			uint32 number_message = sts32_midievent_dispatch( &queue, samples, messages, MIDIEVENT_TEST_EVENTS );
+			for ( uint32 j = 0; j < number_message; j++, number_applied++ ) {
+				if ( number_applied >= number_stamp || messages[j] != expected[number_applied] ) {
+					printf( "%s: Message %d Is 0x%06X, Expected 0x%06X\n", name, (int)number_applied, (unsigned int)messages[j], number_applied < number_expected ? (unsigned int)expected[number_applied] : 0 );
+					return 1;
+				}
+				int32 error = (int32)((samples - stamps[number_applied]) & 0xFFFFFFFF);
+				if ( error < 0 ) error = -error;
+				if ( error > error_max ) error_max = error;
+				int32 delay = tick + 1 - completes[number_applied] / 100; // Samples from Sample of Last Bit on Wire
+				if ( delay < delay_min ) delay_min = delay;
+				if ( delay > delay_max ) delay_max = delay;
+			}
+		}
+	}
+
+	if ( number_applied != number_expected || queue.head != queue.tail ) {
+		printf( "%s: Applied %d Events, Expected %d\n", name, (int)number_applied, (int)number_expected );
+		return 1;
+	}
+	if ( error_max ) {
+		printf( "%s: Onset Error Is Up to %d Samples\n", name, (int)error_max );
+		return 1;
+	}
+	printf( "%s: OK, %d Events, Onset Error 0 Samples, Delay from Wire %d to %d Samples (Jitter %d Samples, %d us)\n", name, (int)number_applied, (int)delay_min, (int)delay_max, (int)(delay_max - delay_min), (int)((delay_max - delay_min) * 1000000 / 32000) );
+	return 0;
+}
+
+static uint32 test_full() {
+	_MidiEventQueue queue;
+	uint32 words[] = { 0x90, 0x3C, 0x64, 0x3D, 0x64, 0x3E, 0x64, 0x3F, 0x64, 0x40, 0x64, 0x41, 0x64 };
+	uint32 messages[8];
+	if ( sts32_midievent_init( &queue, buffer, 6, MIDIEVENT_TEST_CHANNEL ) || queue.mask != 3 ) {
+		printf( "Full Queue: Number of Events Is Not Rounded Down to 4\n" );
+		return 1;
+	}
+	if ( ! sts32_midievent_parse( &queue, words, sizeof(words) / sizeof(uint32), 100 ) || queue.dropped != 2 ) {
+		printf( "Full Queue: Dropped %d Events, Expected 2\n", (int)queue.dropped );
+		return 1;
+	}
+	if ( sts32_midievent_due( &queue, 100 + STS32_MIDIEVENT_LATENCY - 1 ) || ! sts32_midievent_due( &queue, 100 + STS32_MIDIEVENT_LATENCY ) ) {
+		printf( "Full Queue: Due Is Not on Stamped Sample\n" );
+		return 1;
+	}
+	/* Two Events for Each Check by Size */
+	if ( sts32_midievent_dispatch( &queue, 100 + STS32_MIDIEVENT_LATENCY, messages, 2 ) != 2 || ! sts32_midievent_due( &queue, 101 + STS32_MIDIEVENT_LATENCY )
+		|| sts32_midievent_dispatch( &queue, 101 + STS32_MIDIEVENT_LATENCY, messages + 2, 8 ) != 2 || messages[3] != 0x643F90
+		|| sts32_midievent_due( &queue, 102 + STS32_MIDIEVENT_LATENCY ) ) {
+		printf( "Full Queue: Dispatch Is Wrong\n" );
+		return 1;
+	}
+	printf( "Full Queue: OK\n" );
+	return 0;
+}
+
+static uint32 test_unpack() {
+	uchar8 bytes[3];
+	uint32 count;
+	if ( sts32_midievent_unpack( 0x643C91, bytes, &count ) != 0x64 || count != 3 || bytes[0] != 0x9 || bytes[1] != 0x3C || bytes[2] != 0x64 ) {
+		printf( "Unpack: Note On Is Wrong\n" );
+		return 1;
+	}
+	if ( sts32_midievent_unpack( 0x05C0, bytes, &count ) != 0x05 || count != 2 || bytes[0] != 0xC || bytes[1] != 0x05 ) {
+		printf( "Unpack: Program Change Is Wrong\n" );
+		return 1;
+	}
+	if ( sts32_midievent_unpack( 0x40D0, bytes, &count ) != 0x40 || count != 2 || bytes[0] != 0xD ) {
+		printf( "Unpack: Channel Pressure Is Wrong\n" );
+		return 1;
+	}
+	printf( "Unpack: OK\n" );
+	return 0;
+}
+
+int main( void ) {
+	uint32 result = 0;
+	result |= test_stream( "Stream", 0 );
+	result |= test_stream( "Stream Across Wrap of Samples", 0xFFFFFF00 );
+	result |= test_full();
+	result |= test_unpack();
+	return result;
+}
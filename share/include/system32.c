@@ -367,7 +367,7 @@ __attribute__((noinline)) uint32 _uartinit( uint32 div_int, uint32 div_frac, uin
 	return result;
 }
 
-__attribute__((noinline)) uint32 _uartsettest( bool tdr_on, bool tx_on, bool rx_on )
+__attribute__((noinline)) uint32 _uartsettest( bool tdr_on, bool tx_on, bool rx_on, bool loopback )
 {
 	register uint32 result asm("r0");
 	asm volatile ("svc #0x34");
@@ -767,6 +767,244 @@ __attribute__((noinline)) uint32 _bind_objectv3d( _ObjectV3D* objectv3d )
 	return result;
 }
 
+__attribute__((noinline)) uint32 _uarttxqueue( String address_heap, uint32 size )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x6D");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _uartline( bool flag_mirror )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x6E");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _synthesetpre( synthe_precode** array_synthe_precode, uint32 length, uint32 count, int32 repeat )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x6F");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _execute_cl_frame( obj address_framebuffer, uint32 num_vertex, obj address_vertex, uint32 timeout )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x70");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _wait_cl_rendering( uint32 timeout )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x71");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _dmasubmit( _DMASegment* segments, uint32 number_segments )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x72");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _dmapoll( uint32 ticket )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x73");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _dmawait( uint32 ticket, uint32 timeout )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x74");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _dmacomplete()
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x75");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _dmapoolinit( uint32 mask_channel, bool flag_irq )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x76");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _cache_calibrate( obj address, uint32 length )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x77");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _gpiodmaplay( obj buffer, uint32 size )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x78");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _gpiodmastop()
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x79");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _gpiodmatimebase( uint32 divisors, uint32 range )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x7A");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _lcdasyncinit( uint32 tick_us )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x7B");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _lcdqueue( uchar8 character, bool flag_data )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x7C");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _lcdshadow( uchar8 address_ddram, String string, uint32 length_string )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x7D");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _lcdshadowcg( uchar8 address_cgram, String rows, uint32 length_rows )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x7E");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _lcdupdate()
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x7F");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _i2csubmit( _BusTransaction* transaction )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x80");
+	return result;
+}
+
+__attribute__((noinline)) int32 _i2cpoll( _BusTransaction* transaction )
+{
+	register int32 result asm("r0");
+	asm volatile ("svc #0x81");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _i2cqueueinit( bool flag_irq )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x82");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _spisubmit( _BusTransaction* transaction )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x83");
+	return result;
+}
+
+__attribute__((noinline)) int32 _spipoll( _BusTransaction* transaction )
+{
+	register int32 result asm("r0");
+	asm volatile ("svc #0x84");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _spiqueueinit( bool flag_irq )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x85");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _spidma( uchar8* data_send, uchar8* data_receive, uint32 length )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x86");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _spidmawait( uint32 timeout )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x87");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _tftwindow_type1( uint32 x_start, uint32 x_end, uint32 y_start, uint32 y_end )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x88");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _tftshadow_type1( uint32 width, uint32 height )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x89");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _tftupdate_type1( obj address_image )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x8A");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _gpiodmacapture( obj data, uint32 size )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x8B");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _perf_init( uchar8 event0, uchar8 event1 )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x8C");
+	return result;
+}
+
+__attribute__((noinline)) uint32 _perf_begin( uint32 marker )
+{
+	register uint32 result asm("r0");
+	asm volatile ("svc #0x8D");
+	return result;
+}
+
+__attribute__((noinline)) int32 _perf_end( uint32 marker )
+{
+	register int32 result asm("r0");
+	asm volatile ("svc #0x8E");
+	return result;
+}
+
 
 /**
  * Unique Definitions
@@ -240,8 +240,49 @@ typedef struct v3d32_ObjectV3D {
 	uint32 v3d32_uniforms;
 	uint32 v3d32_cl_render;
 	uint32 v3d32_cl_render_size;
+	uint32 v3d32_cl_framebuffer; // Retained Values for _execute_cl_frame
+	uint32 v3d32_cl_num_vertex;
+	uint32 v3d32_cl_vertex;
+	uint32 v3d32_cl_pending; // Asynchronous Rendering Is Not Waited
 } _ObjectV3D;
 
+typedef struct dma32_Segment {
+	uint32 ti; // Transfer Information
+	uint32 source; // Source Address (Bus Address)
+	uint32 dest; // Destination Address (Bus Address)
+	uint32 length; // Transfer Length
+	uint32 stride; // 2D Stride
+} _DMASegment;
+
+typedef struct timer32_Entry {
+	uint32 next;
+	uint32 prev; // 0 as Not Pending
+	uint32 expires; // Tick to Expire
+	uint32 period; // Ticks, 0 as One-shot
+	uint32 function;
+	uint32 argument;
+	uint32 count; // Number of Dispatches
+	uint32 latency_last; // Micro Seconds from Scheduled Time of Tick
+	uint32 latency_min;
+	uint32 latency_max; // Jitter Is latency_max - latency_min
+	uint32 latency_sum; // Lower 32 Bits, Average Is latency_sum / count
+	uint32 rsv;
+} _TimerEntry;
+
+typedef struct bus32_Transaction {
+	uint32 next;
+	uint32 address; // I2C: Slave Address, SPI: Value of CS, Bit[31] as Full Duplex
+	uchar8* tx;
+	uint32 tx_length; // 0 as No Writing
+	uchar8* rx;
+	uint32 rx_length; // 0 as No Reading
+	int32 status; // -1 as Pending, 0 as Success, 1 and More as Error
+	uint32 count_tx;
+	uint32 count_rx;
+	uint32 time; // Micro Seconds from Start to Completion
+	uint32 callback; // Function Called on Completion with Pointer of Transaction (IRQ Disabled), 0 as No Callback
+} _BusTransaction;
+
 /**
  * System calls
  * On _user_start, CPU runs with User mode. To access restricted memory area to write, usage of System calls is needed to acccess SVC mode.
@@ -353,6 +394,17 @@ __attribute__((noinline)) uint32 _set_overspillmemory( obj address_overspillmemo
 
 __attribute__((noinline)) uint32 _bind_objectv3d( _ObjectV3D* objectv3d );
 
+/**
+ * Patch only changed framebuffer, number of vertices, and shaded vertex data, then execute binning and rendering.
+ * If Bit[31] of timeout is set, it returns just after starting rendering (asynchronous).
+ * Use two blocks of shaded vertex data by turns on asynchronous rendering.
+ */
+__attribute__((noinline)) uint32 _execute_cl_frame( obj address_framebuffer, uint32 num_vertex, obj address_vertex, uint32 timeout );
+
+__attribute__((noinline)) uint32 _wait_cl_rendering( uint32 timeout );
+
+#define V3D32_ASYNC 0x80000000 // Bit[31] of Timeout on _execute_cl_frame
+
 
 /********************************
  * system32/arm/arm32.s
@@ -391,6 +443,38 @@ extern ObjArray ARM32_CORE_HANDLE_3;
 #endif
 extern uint32 ARM32_STOPWATCH_LOW;
 extern uint32 ARM32_STOPWATCH_HIGH;
+extern uint32 ARM32_CACHE_LINE;
+extern uint32 ARM32_CACHE_CROSSOVER;
+extern uint32* ARM32_PERF_BUFFER; // Markers of _perf_begin and _perf_end, Read by arm32/perf.h
+extern uint32 ARM32_PERF_EVENT0;
+extern uint32 ARM32_PERF_EVENT1;
+
+#define ARM32_PERF_MARKERS        16 // Same as equ32_arm32_perf_markers
+#define ARM32_PERF_ENTRY_WORDS    32 // 128 Bytes per Marker
+#define ARM32_PERF_COUNT          0  // Word Offset of Number of Measurements
+#define ARM32_PERF_CYCLES         4  // Word Offset of Statistics of Cycles (Sum Lower, Sum Upper, Min, Max)
+#define ARM32_PERF_EVENT_0        8  // Word Offset of Statistics of Event 0
+#define ARM32_PERF_EVENT_1        12 // Word Offset of Statistics of Event 1
+#define ARM32_PERF_HISTOGRAM      16 // Word Offset of Histogram of Cycles, 16 Buckets, Bucket N Is 4^N to 4^(N+1) - 1
+
+/* Event Numbers for _perf_init, Specific to CPU */
+#ifdef __ARMV6
+#define ARM32_PERF_ICACHE_MISS    0x00
+#define ARM32_PERF_ITLB_MISS      0x03 // Instruction MicroTLB Miss
+#define ARM32_PERF_DTLB_MISS      0x04 // Data MicroTLB Miss
+#define ARM32_PERF_BRANCH_MISS    0x06 // Branch Mispredicted
+#define ARM32_PERF_INSTRUCTION    0x07 // Instruction Executed
+#define ARM32_PERF_DCACHE_ACCESS  0x0A
+#define ARM32_PERF_DCACHE_MISS    0x0B
+#else
+#define ARM32_PERF_ICACHE_MISS    0x01 // L1 Instruction Cache Refill
+#define ARM32_PERF_ITLB_MISS      0x02 // L1 Instruction TLB Refill
+#define ARM32_PERF_DCACHE_MISS    0x03 // L1 Data Cache Refill
+#define ARM32_PERF_DCACHE_ACCESS  0x04
+#define ARM32_PERF_DTLB_MISS      0x05 // L1 Data TLB Refill
+#define ARM32_PERF_INSTRUCTION    0x08 // Instruction Architecturally Executed
+#define ARM32_PERF_BRANCH_MISS    0x10 // Branch Mispredicted or Not Predicted
+#endif
 
 /* Relative System Calls  */
 
@@ -416,6 +500,12 @@ __attribute__((noinline)) int32 _load_32( uint32 address );
 
 __attribute__((noinline)) uint64 _timestamp();
 
+__attribute__((noinline)) uint32 _perf_init( uchar8 event0, uchar8 event1 );
+
+__attribute__((noinline)) uint32 _perf_begin( uint32 marker );
+
+__attribute__((noinline)) int32 _perf_end( uint32 marker );
+
 __attribute__((noinline)) uint32 _armtimer( uint32 timer_ctl, uint32 load, uint32 predivider );
 
 __attribute__((noinline)) uint32 _armtimer_reload( uint32 reload );
@@ -424,6 +514,9 @@ __attribute__((noinline)) uint32 _armtimer_load( uint32 load );
 
 __attribute__((noinline)) uint32 _clockmanager( uint32 clocktype_base, uint32 clk_ctl, uint32 clk_divisors );
 
+/* Returns Crossover Length, Measures Cleaning of Cacheable Memory by Lines and by Whole Cache */
+__attribute__((noinline)) uint32 _cache_calibrate( obj address, uint32 length );
+
 __attribute__((noinline)) uint32 _clockmanager_divisor( uint32 clocktype_base, uint32 clk_divisors );
 
 /* Regular Functions */
@@ -556,6 +649,103 @@ extern uint32 clk32_check_week
 );
 
 
+/********************************
+ * system32/arm/timer32.s
+ ********************************/
+
+/**
+ * Entries (_TimerEntry) are added by timer32_add in vector32.s, and functions of entries run in IRQ.
+ * Statistics of latency in each entry can be read on user mode.
+ */
+extern uint32 TIMER32_TICK; // Next Tick to Be Dispatched
+extern uint32 TIMER32_PERIOD; // Micro Seconds per Tick
+
+
+/********************************
+ * system32/arm/dma32.s
+ ********************************/
+
+extern uint32 DMA32_POOL_CHANNEL;
+extern uint32 DMA32_POOL_TICKET;
+extern uint32 DMA32_COMPLETE_OVERFLOW;
+
+/* Returns Ticket, 0 as Error */
+__attribute__((noinline)) uint32 _dmasubmit( _DMASegment* segments, uint32 number_segments );
+
+/* Returns 0 as Completed, 1 as Pending, 2 as Invalid Ticket, 3 as DMA Error (Last 8 Tickets with Error Are Recorded) */
+__attribute__((noinline)) uint32 _dmapoll( uint32 ticket );
+
+/* Returns 0 as Completed, 1 as Time Out, 2 as Invalid Ticket, 3 as DMA Error */
+__attribute__((noinline)) uint32 _dmawait( uint32 ticket, uint32 timeout );
+
+/* Returns Ticket with Bit[31] as DMA Error, 0 as Empty Queue */
+__attribute__((noinline)) uint32 _dmacomplete();
+
+__attribute__((noinline)) uint32 _dmapoolinit( uint32 mask_channel, bool flag_irq );
+
+#define DMA32_ERROR 0x80000000 // Bit[31] of Ticket from _dmacomplete
+
+
+/********************************
+ * system32/arm/i2c32.s
+ ********************************/
+
+/**
+ * Transactions (_BusTransaction) are queued, then written and read (Write-then-read) in the background.
+ * The read phase follows the write phase with a repeated start if the whole write buffer is in FIFO before STOP, otherwise with STOP and START.
+ * Call i2c32_i2cirq in IRQ if _i2cqueueinit enables the interrupt, otherwise _i2cpoll serves the FIFO.
+ */
+extern uint32 I2C32_QUEUE_BUSY; // Sum of Micro Seconds of Transactions, Utilization Is Delta / Elapsed Time
+extern uint32 I2C32_QUEUE_COUNT;
+extern uint32 I2C32_QUEUE_BYTES;
+extern uint32 I2C32_QUEUE_IRQ; // Number of Services of FIFO, Not Time
+
+/* Returns 0 as Success, 1 as Pending Entry or No Byte */
+__attribute__((noinline)) uint32 _i2csubmit( _BusTransaction* transaction );
+
+/* Returns Status, -1 as Pending */
+__attribute__((noinline)) int32 _i2cpoll( _BusTransaction* transaction );
+
+__attribute__((noinline)) uint32 _i2cqueueinit( bool flag_irq );
+
+
+/********************************
+ * system32/arm/spi32.s
+ ********************************/
+
+/**
+ * Transactions (_BusTransaction) are queued, then written and read in the background.
+ * Set the clock with spi32_spiclk beforehand.
+ */
+extern uint32 SPI32_QUEUE_BUSY; // Sum of Micro Seconds of Transactions, Utilization Is Delta / Elapsed Time
+extern uint32 SPI32_QUEUE_COUNT;
+extern uint32 SPI32_QUEUE_BYTES;
+extern uint32 SPI32_QUEUE_IRQ; // Number of Services of FIFO, Not Time
+
+/* Returns 0 as Success, 1 as Pending Entry or No Byte */
+__attribute__((noinline)) uint32 _spisubmit( _BusTransaction* transaction );
+
+/* Returns Status, -1 as Pending */
+__attribute__((noinline)) int32 _spipoll( _BusTransaction* transaction );
+
+__attribute__((noinline)) uint32 _spiqueueinit( bool flag_irq );
+
+#define SPI32_DUPLEX 0x80000000 // Bit[31] of Address, Same as equ32_trans32_duplex
+
+/**
+ * Bulk transfer with DMA (DREQs of SPI0) after spi32_spistart, CS stays asserted until spi32_spistop.
+ * Length is a multiple of 4 up to 0xFFFC bytes, NULL as sending zeros or discarding.
+ */
+extern uint32 SPI32_DMA_TIME; // Micro Seconds of Last Transfer, Throughput Is Length / Time
+extern uint32 SPI32_DMA_BYTES;
+
+/* Returns 0 as Success, 1 as Invalid Length or Alignment, 2 as Previous Transfer Is Not Waited */
+__attribute__((noinline)) uint32 _spidma( uchar8* data_send, uchar8* data_receive, uint32 length );
+
+/* Returns 0 as Success, 1 as Time Out in Turns */
+__attribute__((noinline)) uint32 _spidmawait( uint32 timeout );
+
+
 /********************************
  * system32/arm/uart32.s
  ********************************/
@@ -568,6 +758,12 @@ extern uint32 UART32_UARTMALLOC_LENGTH;
 extern uint32 UART32_UARTMALLOC_NUMBER;
 extern uint32 UART32_UARTMALLOC_MAXROW;
 extern uint32 UART32_UARTINT_CLIENT_FIFO;
+extern uint32 UART32_UARTTX_HIGHWATER;
+extern uint32 UART32_UARTTX_BACKPRESSURE;
+extern uint32 UART32_UARTTX_DMACOUNT;
+extern obj UART32_UARTRX_RING;
+extern uint32 UART32_UARTRX_OVERRUN;
+extern uint32 UART32_UARTRX_ERROR;
 
 __attribute__((noinline)) uint32 _uartinit
 (
@@ -581,7 +777,8 @@ __attribute__((noinline)) uint32 _uartsettest
 (
 	bool rdr_on,
 	bool tx_on,
-	bool rx_on
+	bool rx_on,
+	bool loopback
 );
 
 __attribute__((noinline)) uint32 _uarttestwrite
@@ -612,6 +809,12 @@ __attribute__((noinline)) uint32 _uarttx
 	uint32 size
 );
 
+__attribute__((noinline)) uint32 _uarttxqueue
+(
+	String address_heap,
+	uint32 size
+);
+
 __attribute__((noinline)) uint32 _uartrx
 (
 	String address_heap,
@@ -620,6 +823,11 @@ __attribute__((noinline)) uint32 _uartrx
 
 __attribute__((noinline)) uint32 _uartclrrx();
 
+__attribute__((noinline)) uint32 _uartline
+(
+	bool flag_mirror
+);
+
 __attribute__((noinline)) uint32 _uartsetheap
 (
 	uint32 num_heap
@@ -702,6 +910,27 @@ __attribute__((noinline)) uint32 _gpioevent( uint32 number_gpio, uchar8 event_se
 
 __attribute__((noinline)) uint32 _gpiopull( uint32 number_gpio, uchar8 control );
 
+/**
+ * Play Chain of DMA Control Blocks Compiled by gpio32_seq_compile in gpio32/sequencer.c
+ * The buffer is 256-bit aligned in a heap block, compiled with the bus address of buffer + V3D32_BUS_COHERENCE.
+ * A channel is claimed from the DMA pool (DMA32_POOL_CHANNEL) until _gpiodmastop.
+ * Returns 0 as Success, 1 as Invalid Buffer or Size, 2 as No Free Channel in DMA Pool
+ */
+__attribute__((noinline)) uint32 _gpiodmaplay( obj buffer, uint32 size );
+
+/* Stop Chain and Release Channel to DMA Pool */
+__attribute__((noinline)) uint32 _gpiodmastop();
+
+/**
+ * Invalidate Captured Data and Return Bus Address of Current CB (0 as Not Active), for Chain of softuart32_cap_compile in softuart32/capture.c
+ */
+__attribute__((noinline)) uint32 _gpiodmacapture( obj data, uint32 size );
+
+/**
+ * PWM as Timebase of _gpiodmaplay, One Beat Takes divisors (Bit[23:12] Integer, Bit[11:0] Fractional) * range / 500Mhz
+ */
+__attribute__((noinline)) uint32 _gpiodmatimebase( uint32 divisors, uint32 range );
+
 
 /* Regular Functions */
 
@@ -1524,6 +1753,9 @@ extern uint32 snd32_musiclen
 #define STS32_FAL      16
 #define STS32_PWM      0
 #define STS32_I2S      1
+#define STS32_STEAL_OLDEST    0x1
+#define STS32_STEAL_QUIETEST  0x2
+#define STS32_STEAL_RETRIGGER 0x4
 
 /* Global Variable */
 
@@ -1539,6 +1771,9 @@ extern float32 STS32_DIGITALMOD_MIN;
 extern float32 STS32_DIGITALMOD_MEDIUM;
 extern float32 STS32_TONE;
 extern uint32 STS32_LANE;
+extern uint32 STS32_SYNTHEWAVE_SAMPLES;
+extern uint32 STS32_SYNTHEMIDI_EVENT_DROPPED;
+extern uint32 STS32_SYNTHEMIDI_STEAL;
 
 /* Relative System Calls  */
 
@@ -1548,6 +1783,8 @@ __attribute__((noinline)) uint32 _synthewave_i2s( float32 bend_rate, float32 ton
 
 __attribute__((noinline)) uint32 _syntheset( synthe_code* synthe, uint32 length, uint32 count, int32 repeat );
 
+__attribute__((noinline)) uint32 _synthesetpre( synthe_precode** array_synthe_precode, uint32 length, uint32 count, int32 repeat );
+
 __attribute__((noinline)) uint32 _syntheplay( uint32 offset_voice, uint32 number_voices );
 
 __attribute__((noinline)) uint32 _syntheclear( uint32 offset_voice, uint32 number_voices );
@@ -1586,6 +1823,19 @@ extern synthe_code* sts32_synthedecodelr
 );
 
 
+/**
+ * Count Maximum Beats in Sequences of Synthesizer Pre-code
+ * The result is the length for _synthesetpre.
+ *
+ * Return: Maximum Number of Beats in Sequences of Synthesizer Pre-code
+ */
+extern uint32 sts32_synthebeatlenlr
+(
+	synthe_precode** array_synthe_precode, // Two Dimentional (Array of Pointers), L and R Alternatively
+	uint32 number_voices
+);
+
+
 /********************************
  * system32/library/hid32.s
  ********************************/
@@ -1652,6 +1902,13 @@ __attribute__((noinline)) uint32 _softuarttx(
 extern uchar8* DMX32_BUFFER_FRONT;
 extern uchar8* DMX32_BUFFER_BACK;
 extern uint32 DMX32_BUFFER_LENGTH;
+extern uint32 DMX32_DMA_COUNT; // Number of Packets Sent by dmx32_dmx512dma_tx
+extern uint32 DMX32_DMA_RXCOUNT; // Number of Packets Received by dmx32_dmx512dma_rx
+extern uint32 DMX32_DMA_RXERROR; // Number of Packets Discarded by Errors
+extern uchar8* DMX32_DMA_RXFRONT; // Packet in Progress of dmx32_dmx512dma_rx
+extern uchar8* DMX32_DMA_RXBACK; // Last Packet of dmx32_dmx512dma_rx
+extern uint32 DMX32_DMA_RXSLOTS; // Slots of the Last Packet in DMX32_DMA_RXBACK
+extern uint32 DMX32_DMA_RXTIME; // Micro Seconds Spent in dmx32_dmx512dma_rx, Increase per Elapsed Time as CPU Load
 
 
 /********************************
@@ -1711,6 +1968,30 @@ __attribute__((noinline)) uint32 _lcdchargenerator(
 	uchar8 address_cgram
 );
 
+/* Asynchronous Functions, lcd32_lcdtick Is Needed to Be Called on Each Tick of Timer in FIQ/IRQ */
+__attribute__((noinline)) uint32 _lcdasyncinit(
+	uint32 tick_us
+);
+
+__attribute__((noinline)) uint32 _lcdqueue(
+	uchar8 character,
+	bool flag_data
+);
+
+__attribute__((noinline)) uint32 _lcdshadow(
+	uchar8 address_ddram,
+	String string,
+	uint32 length_string
+);
+
+__attribute__((noinline)) uint32 _lcdshadowcg(
+	uchar8 address_cgram,
+	String rows,
+	uint32 length_rows
+);
+
+__attribute__((noinline)) uint32 _lcdupdate();
+
 
 /********************************
  * system32/library/tft32.s
@@ -1731,6 +2012,29 @@ __attribute__((noinline)) uint32 _tftimage_type1(
 	uint32 size
 );
 
+__attribute__((noinline)) uint32 _tftwindow_type1(
+	uint32 x_start,
+	uint32 x_end,
+	uint32 y_start,
+	uint32 y_end
+);
+
+/* Dirty Rectangles, _tftupdate_type1 Writes Only Changed Windows of Image Compared with Shadow */
+extern obj TFT32_SHADOW;
+extern uint32 TFT32_SHADOW_WIDTH;
+extern uint32 TFT32_SHADOW_HEIGHT;
+extern uint32 TFT32_BYTES; // Bytes on Wire in Last Update
+extern uint32 TFT32_WINDOWS; // Windows in Last Update
+
+__attribute__((noinline)) uint32 _tftshadow_type1(
+	uint32 width,
+	uint32 height
+);
+
+__attribute__((noinline)) uint32 _tftupdate_type1(
+	obj address_image
+);
+
 
 /********************************
  * system32/library/math32.s
@@ -2116,6 +2420,50 @@ extern obj mtx32_multiply
 );
 
 
+/**
+ * Multiplies Two Matrix with Single Precision Float into Memory Space of Caller
+ * 4 by 4 and 3 by 3 are calculated by unrolled functions.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: Matrix to Be Calculated
+ */
+extern obj mtx32_multiply_into
+(
+	obj matrix1,
+	obj matrix2,
+	uint32 number,
+	obj matrix_result // Must Not Be Same as Matrix1 and Matrix2 Except 4 by 4 and 3 by 3
+);
+
+
+/**
+ * Multiplies Two 4 by 4 Matrix with Single Precision Float into Memory Space of Caller, Unrolled
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: Matrix to Be Calculated
+ */
+extern obj mtx32_multiply4_into
+(
+	obj matrix1,
+	obj matrix2,
+	obj matrix_result // Can Be Same as Matrix1 or Matrix2
+);
+
+
+/**
+ * Multiplies Two 3 by 3 Matrix with Single Precision Float into Memory Space of Caller, Unrolled
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: Matrix to Be Calculated
+ */
+extern obj mtx32_multiply3_into
+(
+	obj matrix1,
+	obj matrix2,
+	obj matrix_result // Can Be Same as Matrix1 or Matrix2
+);
+
+
 /**
  * Get Identity of Matrix
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2129,6 +2477,19 @@ extern obj mtx32_identity
 );
 
 
+/**
+ * Get Identity of Matrix into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: Matrix to Have Identity
+ */
+extern obj mtx32_identity_into
+(
+	uint32 number,
+	obj matrix_result
+);
+
+
 /**
  * Square Matrix and Column Vector Multiplication
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2144,6 +2505,37 @@ extern obj mtx32_multiply_vec
 );
 
 
+/**
+ * Square Matrix and Column Vector Multiplication into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: Vector to Be Calculated
+ */
+extern obj mtx32_multiply_vec_into
+(
+	obj matrix,
+	obj vector,
+	uint32 number,
+	obj vector_result // Must Not Be Same as Vector Except Vector Size 4
+);
+
+
+/**
+ * 4 by 4 Square Matrix and Column Vectors Multiplication, Unrolled
+ * Transforms an array of vectors (X, Y, Z, and W) by one matrix in one call.
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: Array of Vectors to Be Calculated
+ */
+extern obj mtx32_transform_vec4_array
+(
+	obj matrix,
+	obj array_vector, // Each Vector Must Be Four of Vector Size
+	obj array_vector_result, // Can Be Same as Array of Vectors
+	uint32 number_vector
+);
+
+
 /**
  * Normalize Vector
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2199,6 +2591,19 @@ extern obj mtx32_translate3d
 );
 
 
+/**
+ * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Translation into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: 4 by 4 Square Matrix to Be Calculated
+ */
+extern obj mtx32_translate3d_into
+(
+	obj vector, // Must Be Three of Vector Size, X, Y, and Z
+	obj matrix_result
+);
+
+
 /**
  * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Scale
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2212,6 +2617,19 @@ extern obj mtx32_scale3d
 );
 
 
+/**
+ * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Scale into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: 4 by 4 Square Matrix to Be Calculated
+ */
+extern obj mtx32_scale3d_into
+(
+	obj vector, // Must Be Three of Vector Size, X, Y, and Z
+	obj matrix_result
+);
+
+
 /**
  * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Rotate X
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2225,6 +2643,19 @@ extern obj mtx32_rotatex3d
 );
 
 
+/**
+ * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Rotate X into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: 4 by 4 Square Matrix to Be Calculated
+ */
+extern obj mtx32_rotatex3d_into
+(
+	float32 degrees,
+	obj matrix_result
+);
+
+
 /**
  * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Rotate Y
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2238,6 +2669,19 @@ extern obj mtx32_rotatey3d
 );
 
 
+/**
+ * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Rotate Y into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: 4 by 4 Square Matrix to Be Calculated
+ */
+extern obj mtx32_rotatey3d_into
+(
+	float32 degrees,
+	obj matrix_result
+);
+
+
 /**
  * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Rotate Z
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2251,6 +2695,19 @@ extern obj mtx32_rotatez3d
 );
 
 
+/**
+ * Make 4 by 4 Square Matrix (Column Order) with Vector of 3D Rotate Z into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: 4 by 4 Square Matrix to Be Calculated
+ */
+extern obj mtx32_rotatez3d_into
+(
+	float32 degrees,
+	obj matrix_result
+);
+
+
 /**
  * Make 4 by 4 Square Matrix (Column Order) with Perspective
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2267,6 +2724,22 @@ extern obj mtx32_perspective3d
 );
 
 
+/**
+ * Make 4 by 4 Square Matrix (Column Order) with Perspective into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: 4 by 4 Square Matrix to Be Calculated
+ */
+extern obj mtx32_perspective3d_into
+(
+	float32 fovy, // Field of View Y: Vertical
+	float32 aspect,
+	float32 near,
+	float32 far,
+	obj matrix_result
+);
+
+
 /**
  * Make 4 by 4 Square Matrix (Column Order) with View
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2282,6 +2755,21 @@ extern obj mtx32_view3d
 );
 
 
+/**
+ * Make 4 by 4 Square Matrix (Column Order) with View into Memory Space of Caller
+ * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
+ *
+ * Return: 4 by 4 Square Matrix to Be Calculated
+ */
+extern obj mtx32_view3d_into
+(
+	obj vector_camera, // Must Be Three of Vector Size, X, Y, and Z
+	obj vector_target, // Must Be Three of Vector Size, X, Y, and Z
+	obj vector_up, // Must Be Three of Vector Size, X, Y, and Z
+	obj matrix_result
+);
+
+
 /**
  * Make Versor
  * Caution! This Function Needs to Make VFPv2 Registers and Instructions Enable.
@@ -2396,6 +2884,26 @@ extern int32 geo32_fill3d
 );
 
 
+/**
+ * Make Shaded Vertices for V3D (NV Shader State) from Triangles
+ * Transfers vertices with the matrix, divides by W, maps them to the viewport, and culls flip side triangles
+ * Each shaded vertex is six words; X and Y (12.4 Fixed Point by Signed Half Word, Lower is X), Z, W (1.0), S, T, and Index
+ * On ARMv7 and later, four vertices are processed at once by NEON
+ * Caution! This Function Needs to Make VFP/NEON Registers and Instructions Enable
+ *
+ * Return: Number of Shaded Vertices Written
+ */
+extern uint32 geo32_shade3d
+(
+	obj vertices, // Arrays of X, Y, Z, S, T, and Index by Single Precision Float, Each Array Has Number of Vertices
+	uint32 number_vertices, // Must Be Multiple of 3 (Triangles)
+	obj matrix, // 4 by 4 Matrix (Projection, View, and Model)
+	obj shaded_vertices, // Needs Number of Vertices by 6 Words
+	uint32 width,
+	uint32 height,
+	uint32 rotation
+);
+
 #define GEO32_CCW  0 // Polygon with Counter Clockwise Is Front to Be Drawn
 #define GEO32_CW   1 // Polygon with Clockwise Is Front to Be Drawn
 #define GEO32_BOTH 2 // Both Are Going to Be Drawn
@@ -2980,6 +3488,14 @@ extern uint32 heap32_mpop
 	uint32 size_indicator
 );
 
+extern obj heap32_mringmalloc( uint32 block_size );
+
+extern uint32 heap32_mringwrite( obj ring, obj heap, uint32 size );
+
+extern uint32 heap32_mringread( obj ring, obj heap, uint32 size );
+
+extern uint32 heap32_mringcount( obj ring );
+
 extern obj heap32_malloc( uint32 block_size );
 
 extern obj heap32_malloc_noncache( uint32 block_size );
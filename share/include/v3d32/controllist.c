@@ -0,0 +1,441 @@
+/**
+ * v3d32/controllist.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/* Values Are Stored in Little Endian, Byte by Byte Because Records Are Not Aligned */
+static void v3d32_cl_put16( uchar8* list, uint16 value ) {
+	list[0] = value & 0xFF;
+	list[1] = (value >> 8) & 0xFF;
+}
+
+static void v3d32_cl_put32( uchar8* list, uint32 value ) {
+	list[0] = value & 0xFF;
+	list[1] = (value >> 8) & 0xFF;
+	list[2] = (value >> 16) & 0xFF;
+	list[3] = (value >> 24) & 0xFF;
+}
+
+static uint32 v3d32_cl_get16( uchar8* list ) {
+	return list[0]|list[1]<<8;
+}
+
+static uint32 v3d32_cl_get32( uchar8* list ) {
+	return list[0]|list[1]<<8|list[2]<<16|(uint32)list[3]<<24;
+}
+
+uchar8 v3d32_cl_length( uchar8 opcode ) {
+	switch ( opcode ) {
+		case V3D32_CL_HALT:
+		case V3D32_CL_NOP:
+		case V3D32_CL_FLUSH:
+		case V3D32_CL_FLUSH_ALL:
+		case V3D32_CL_START_TILE_BINNING:
+		case V3D32_CL_INC_SEMAPHORE:
+		case V3D32_CL_WAIT_SEMAPHORE:
+		case V3D32_CL_RETURN_SUBLIST:
+		case V3D32_CL_STORE_TILEBUFFER_MULTI:
+		case V3D32_CL_STORE_TILEBUFFER_MULTIEND:
+			return 1;
+		case V3D32_CL_PRIMITIVE_LIST_FORMAT:
+			return 2;
+		case V3D32_CL_RHT_X_BOUNDARY:
+		case V3D32_CL_TILE_COORDINATES:
+			return 3;
+		case V3D32_CL_CONFIG:
+			return 4;
+		case V3D32_CL_BRANCH:
+		case V3D32_CL_BRANCH_SUBLIST:
+		case V3D32_CL_STORE_TILEBUFFER_FULL:
+		case V3D32_CL_LOAD_TILEBUFFER_FULL:
+		case V3D32_CL_GL_SHADERSTATE:
+		case V3D32_CL_NV_SHADERSTATE:
+		case V3D32_CL_VG_SHADERSTATE:
+		case V3D32_CL_FLAT_SHADE_FLAGS:
+		case V3D32_CL_POINTS_SIZE:
+		case V3D32_CL_LINE_WIDTH:
+		case V3D32_CL_DEPTH_OFFSET:
+		case V3D32_CL_VIEWPORT_OFFSET:
+			return 5;
+		case V3D32_CL_STORE_TILEBUFFER_GENERAL:
+		case V3D32_CL_LOAD_TILEBUFFER_GENERAL:
+			return 7;
+		case V3D32_CL_CLIP_WINDOW:
+		case V3D32_CL_Z_CLIPPING_PLANE:
+		case V3D32_CL_CLIPPER_XY:
+		case V3D32_CL_CLIPPER_Z:
+			return 9;
+		case V3D32_CL_VERTEXARRAY_PRIMITIVES:
+			return 10;
+		case V3D32_CL_CONFIG_RENDERING:
+			return 11;
+		case V3D32_CL_INDEXED_PRIMITIVE:
+			return 14;
+		case V3D32_CL_CLEAR:
+			return 14;
+		case V3D32_CL_CONFIG_BINNING:
+			return 16;
+		default:
+			return 0;
+	}
+}
+
+uint32 v3d32_cl_encode_single( uchar8* list, uchar8 opcode ) {
+	if ( list ) list[0] = opcode;
+	return 1;
+}
+
+uint32 v3d32_cl_encode_address( uchar8* list, uchar8 opcode, uint32 address ) {
+	if ( list ) {
+		list[0] = opcode;
+		v3d32_cl_put32( list + 1, address );
+	}
+	return 5;
+}
+
+uint32 v3d32_cl_encode_config_binning( uchar8* list, uint32 tile_allocation, uint32 size_tile_allocation, uint32 tile_state, uchar8 width_tile, uchar8 height_tile, uchar8 flags ) {
+	if ( list ) {
+		list[0] = V3D32_CL_CONFIG_BINNING;
+		v3d32_cl_put32( list + 1, tile_allocation );
+		v3d32_cl_put32( list + 5, size_tile_allocation );
+		v3d32_cl_put32( list + 9, tile_state );
+		list[13] = width_tile;
+		list[14] = height_tile;
+		list[15] = flags;
+	}
+	return 16;
+}
+
+uint32 v3d32_cl_encode_clip_window( uchar8* list, uint16 left, uint16 bottom, uint16 width, uint16 height ) {
+	if ( list ) {
+		list[0] = V3D32_CL_CLIP_WINDOW;
+		v3d32_cl_put16( list + 1, left );
+		v3d32_cl_put16( list + 3, bottom );
+		v3d32_cl_put16( list + 5, width );
+		v3d32_cl_put16( list + 7, height );
+	}
+	return 9;
+}
+
+uint32 v3d32_cl_encode_config( uchar8* list, uint32 flags ) {
+	if ( list ) {
+		list[0] = V3D32_CL_CONFIG;
+		list[1] = flags & 0xFF;
+		list[2] = (flags >> 8) & 0xFF;
+		list[3] = (flags >> 16) & 0x0F; // 18-bit, Upper Bits Are Reserved
+	}
+	return 4;
+}
+
+uint32 v3d32_cl_encode_viewport_offset( uchar8* list, int16 x, int16 y ) {
+	if ( list ) {
+		list[0] = V3D32_CL_VIEWPORT_OFFSET;
+		v3d32_cl_put16( list + 1, (uint16)x );
+		v3d32_cl_put16( list + 3, (uint16)y );
+	}
+	return 5;
+}
+
+uint32 v3d32_cl_encode_z_clipping_plane( uchar8* list, float32 min, float32 max ) {
+	union { float32 f32; uint32 u32; } value;
+	if ( list ) {
+		list[0] = V3D32_CL_Z_CLIPPING_PLANE;
+		value.f32 = min;
+		v3d32_cl_put32( list + 1, value.u32 );
+		value.f32 = max;
+		v3d32_cl_put32( list + 5, value.u32 );
+	}
+	return 9;
+}
+
+uint32 v3d32_cl_encode_vertexarray_primitives( uchar8* list, uchar8 mode, uint32 number_vertices, uint32 index_vertex ) {
+	if ( list ) {
+		list[0] = V3D32_CL_VERTEXARRAY_PRIMITIVES;
+		list[1] = mode;
+		v3d32_cl_put32( list + 2, number_vertices );
+		v3d32_cl_put32( list + 6, index_vertex );
+	}
+	return 10;
+}
+
+uint32 v3d32_cl_encode_clear( uchar8* list, uint32 color, uint32 z, uchar8 alpha, uchar8 stencil ) {
+	if ( list ) {
+		list[0] = V3D32_CL_CLEAR;
+		v3d32_cl_put32( list + 1, color ); // Two Sets of RGBA8888
+		v3d32_cl_put32( list + 5, color );
+		list[9] = z & 0xFF;
+		list[10] = (z >> 8) & 0xFF;
+		list[11] = (z >> 16) & 0xFF;
+		list[12] = alpha;
+		list[13] = stencil;
+	}
+	return 14;
+}
+
+uint32 v3d32_cl_encode_config_rendering( uchar8* list, uint32 address, uint16 width, uint16 height, uint16 flags ) {
+	if ( list ) {
+		list[0] = V3D32_CL_CONFIG_RENDERING;
+		v3d32_cl_put32( list + 1, address );
+		v3d32_cl_put16( list + 5, width );
+		v3d32_cl_put16( list + 7, height );
+		v3d32_cl_put16( list + 9, flags );
+	}
+	return 11;
+}
+
+uint32 v3d32_cl_encode_tile_coordinates( uchar8* list, uchar8 column, uchar8 row ) {
+	if ( list ) {
+		list[0] = V3D32_CL_TILE_COORDINATES;
+		list[1] = column;
+		list[2] = row;
+	}
+	return 3;
+}
+
+uint32 v3d32_cl_encode_store_tilebuffer_general( uchar8* list, uint16 flags, uint32 address ) {
+	if ( list ) {
+		list[0] = V3D32_CL_STORE_TILEBUFFER_GENERAL;
+		v3d32_cl_put16( list + 1, flags );
+		v3d32_cl_put32( list + 3, address );
+	}
+	return 7;
+}
+
+/* Pointer Advances Only If Not NULL, to Calculate Size by NULL */
+#define V3D32_CL_NEXT(list,size,encoded) { uint32 bytes = encoded; size += bytes; if ( list ) list += bytes; }
+
+uint32 v3d32_cl_make_binning( uchar8* list, uint32 tile_allocation, uint32 tile_state, uint32 nv_shaderstate, uint16 width, uint16 height, uchar8 flags_binning, uint32 flags_config ) {
+	uint32 size = 0;
+	uint32 shift_tile = flags_binning & V3D32_CL_BINNING_MULTISAMPLE ? 5 : 6; // 32 or 64 Pixels
+	uchar8 width_tile = (width + (1 << shift_tile) - 1) >> shift_tile;
+	uchar8 height_tile = (height + (1 << shift_tile) - 1) >> shift_tile;
+	uint32 size_tile_allocation = width_tile * height_tile * V3D32_CL_TILE_ALLOCATION_SIZE;
+	uint32 size_minimum = v3d32_cl_size_tile_allocation( width_tile, height_tile, flags_binning );
+	if ( size_tile_allocation < size_minimum ) size_tile_allocation = size_minimum;
+
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_config_binning( list, tile_allocation, size_tile_allocation, tile_state, width_tile, height_tile, flags_binning ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_single( list, V3D32_CL_START_TILE_BINNING ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_clip_window( list, 0, 0, width, height ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_config( list, flags_config ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_viewport_offset( list, 0, 0 ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_z_clipping_plane( list, 0.0f, 1.0f ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_address( list, V3D32_CL_NV_SHADERSTATE, nv_shaderstate ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_vertexarray_primitives( list, 4, 0, 0 ) ); // Triangles
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_single( list, V3D32_CL_FLUSH ) );
+
+	return size;
+}
+
+uint32 v3d32_cl_make_rendering( uchar8* list, uint32 tile_allocation, uint32 address, uint16 width, uint16 height, uint16 flags, uchar8 flags_binning ) {
+	uint32 size = 0;
+	uint32 size_sublist = v3d32_cl_size_initblock( flags_binning );
+	uint32 shift_tile = flags & 0b1 ? 5 : 6; // Multisample Mode 4x, 32 or 64 Pixels
+	uchar8 width_tile = (width + (1 << shift_tile) - 1) >> shift_tile;
+	uchar8 height_tile = (height + (1 << shift_tile) - 1) >> shift_tile;
+	bool last;
+
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_clear( list, 0, 0, 0, 0 ) );
+
+	/* Offset 2 Bytes to Make 16 Bytes Distance Between Last and Next Items */
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_single( list, V3D32_CL_NOP ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_single( list, V3D32_CL_NOP ) );
+
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_config_rendering( list, address, width, height, flags ) );
+
+	/* Dummy Store to Clear Tile Buffer */
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_tile_coordinates( list, 0, 0 ) );
+	V3D32_CL_NEXT( list, size, v3d32_cl_encode_store_tilebuffer_general( list, 0, 0 ) );
+
+	for ( uint32 j = 0; j < height_tile; j++ ) {
+		for ( uint32 i = 0; i < width_tile; i++ ) {
+			V3D32_CL_NEXT( list, size, v3d32_cl_encode_tile_coordinates( list, i, j ) );
+			V3D32_CL_NEXT( list, size, v3d32_cl_encode_address( list, V3D32_CL_BRANCH_SUBLIST, tile_allocation + (j * width_tile + i) * size_sublist ) );
+			last = i + 1 >= width_tile && j + 1 >= height_tile;
+			V3D32_CL_NEXT( list, size, v3d32_cl_encode_single( list, last ? V3D32_CL_STORE_TILEBUFFER_MULTIEND : V3D32_CL_STORE_TILEBUFFER_MULTI ) );
+		}
+	}
+
+	return size;
+}
+
+int32 v3d32_cl_decode( uchar8* list, uint32 size, _CLRecord* records, uint32 max_records ) {
+	uint32 offset = 0;
+	uint32 number_records = 0;
+	uchar8 length;
+
+	while ( offset < size ) {
+		length = v3d32_cl_length( list[offset] );
+		if ( ! length ) return -1;
+		if ( offset + length > size ) return -2;
+		if ( records ) {
+			if ( number_records >= max_records ) return -3;
+			records[number_records].offset = offset;
+			records[number_records].opcode = list[offset];
+			records[number_records].length = length;
+			records[number_records].rsv16 = 0;
+		}
+		number_records++;
+		offset += length;
+	}
+
+	return number_records;
+}
+
+int32 v3d32_cl_find( _CLRecord* records, int32 number_records, uchar8 opcode, uint32 nth ) {
+	for ( int32 i = 0; i < number_records; i++ ) {
+		if ( records[i].opcode != opcode ) continue;
+		if ( ! nth ) return i;
+		nth--;
+	}
+
+	return -1;
+}
+
+int32 v3d32_cl_patch( uchar8* list, _CLRecord* record, uchar8* encoded ) {
+	bool changed = False;
+	uchar8* target = list + record->offset;
+
+	if ( encoded[0] != record->opcode || v3d32_cl_length( encoded[0] ) != record->length ) return -1;
+
+	for ( uint32 i = 1; i < record->length; i++ ) {
+		if ( target[i] != encoded[i] ) {
+			target[i] = encoded[i];
+			changed = True;
+		}
+	}
+
+	return changed;
+}
+
+int32 v3d32_cl_update( uchar8* list, uint32 size, uchar8* encoded, uint32 size_encoded ) {
+	_CLRecord record;
+	uint32 offset = 0;
+	int32 number_changed = 0;
+
+	/* Check Layout at First Not to Write Partially */
+	if ( size != size_encoded ) return -1;
+	while ( offset < size ) {
+		record.length = v3d32_cl_length( list[offset] );
+		if ( ! record.length || list[offset] != encoded[offset] || offset + record.length > size ) return -1;
+		offset += record.length;
+	}
+
+	for ( offset = 0; offset < size; offset += record.length ) {
+		record.offset = offset;
+		record.opcode = list[offset];
+		record.length = v3d32_cl_length( record.opcode );
+		number_changed += v3d32_cl_patch( list, &record, encoded + offset );
+	}
+
+	return number_changed;
+}
+
+uint32 v3d32_cl_size_initblock( uchar8 flags_binning ) {
+	return 32 << ((flags_binning >> V3D32_CL_BINNING_INITBLOCK_SHIFT) & 0b11);
+}
+
+uint32 v3d32_cl_size_tile_allocation( uchar8 width_tile, uchar8 height_tile, uchar8 flags_binning ) {
+	return width_tile * height_tile * v3d32_cl_size_initblock( flags_binning );
+}
+
+uint32 v3d32_cl_validate_binning( uchar8* list, uint32 size ) {
+	uint32 offset = 0;
+	bool configured = False;
+	uchar8 opcode = V3D32_CL_HALT;
+	uchar8 length;
+	uint32 width_tile = 0;
+	uint32 height_tile = 0;
+	uint32 shift_tile = 6;
+	uint32 address;
+
+	while ( offset < size ) {
+		opcode = list[offset];
+		length = v3d32_cl_length( opcode );
+		if ( ! length || offset + length > size ) return 1;
+
+		switch ( opcode ) {
+			case V3D32_CL_CONFIG_BINNING:
+				address = v3d32_cl_get32( list + offset + 1 );
+				if ( address & 0xFF ) return 3;
+				width_tile = list[offset + 13];
+				height_tile = list[offset + 14];
+				if ( v3d32_cl_get32( list + offset + 5 ) < v3d32_cl_size_tile_allocation( width_tile, height_tile, list[offset + 15] ) ) return 4;
+				if ( v3d32_cl_get32( list + offset + 9 ) & 0xF ) return 5;
+				shift_tile = list[offset + 15] & V3D32_CL_BINNING_MULTISAMPLE ? 5 : 6;
+				configured = True;
+				break;
+			case V3D32_CL_START_TILE_BINNING:
+				if ( ! configured ) return 2;
+				break;
+			case V3D32_CL_CLIP_WINDOW:
+				if ( v3d32_cl_get16( list + offset + 1 ) + v3d32_cl_get16( list + offset + 5 ) > width_tile << shift_tile ) return 6;
+				if ( v3d32_cl_get16( list + offset + 3 ) + v3d32_cl_get16( list + offset + 7 ) > height_tile << shift_tile ) return 6;
+				break;
+			case V3D32_CL_NV_SHADERSTATE:
+				if ( v3d32_cl_get32( list + offset + 1 ) & 0xF ) return 7;
+				break;
+		}
+
+		offset += length;
+	}
+
+	if ( opcode != V3D32_CL_FLUSH && opcode != V3D32_CL_FLUSH_ALL ) return 8;
+
+	return 0;
+}
+
+uint32 v3d32_cl_validate_rendering( uchar8* list, uint32 size, uint32 tile_allocation, uint32 size_tile_allocation, uchar8 flags_binning ) {
+	uint32 size_sublist = v3d32_cl_size_initblock( flags_binning );
+	uint32 offset = 0;
+	bool configured = False;
+	bool ended = False;
+	uchar8 opcode;
+	uchar8 length;
+	uint32 width_tile = 0;
+	uint32 height_tile = 0;
+	uint32 shift_tile;
+	uint32 column = 0;
+	uint32 row = 0;
+	uint32 address;
+
+	while ( offset < size ) {
+		opcode = list[offset];
+		length = v3d32_cl_length( opcode );
+		if ( ! length || offset + length > size ) return 1;
+		if ( ended && opcode != V3D32_CL_NOP && opcode != V3D32_CL_HALT ) return 5;
+
+		switch ( opcode ) {
+			case V3D32_CL_CONFIG_RENDERING:
+				shift_tile = list[offset + 9] & 0b1 ? 5 : 6; // Multisample Mode 4x
+				width_tile = (v3d32_cl_get16( list + offset + 5 ) + (1 << shift_tile) - 1) >> shift_tile;
+				height_tile = (v3d32_cl_get16( list + offset + 7 ) + (1 << shift_tile) - 1) >> shift_tile;
+				configured = True;
+				break;
+			case V3D32_CL_TILE_COORDINATES:
+				if ( ! configured ) return 2;
+				column = list[offset + 1];
+				row = list[offset + 2];
+				if ( column >= width_tile || row >= height_tile ) return 3;
+				break;
+			case V3D32_CL_BRANCH_SUBLIST:
+				address = v3d32_cl_get32( list + offset + 1 );
+				if ( address < tile_allocation || address >= tile_allocation + size_tile_allocation ) return 4;
+				if ( address != tile_allocation + (row * width_tile + column) * size_sublist ) return 4;
+				break;
+			case V3D32_CL_STORE_TILEBUFFER_MULTIEND:
+				if ( column + 1 != width_tile || row + 1 != height_tile ) return 5;
+				ended = True;
+				break;
+		}
+
+		offset += length;
+	}
+
+	if ( ! ended ) return 5;
+
+	return 0;
+}
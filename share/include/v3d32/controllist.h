@@ -0,0 +1,187 @@
+/**
+ * v3d32/controllist.h
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * This header file is for encoding, decoding, and validating control lists for V3D (VideoCore IV 3D).
+ * Functions in controllist.c touch only the memory of control lists given by pointers, i.e., no heap, no peripherals.
+ * So, controllist.c can be built and checked on a host machine as well as ../(asterisk)/system32/vendor/v3d32.s on the target.
+ * On the target, pass the ARM side address of GPU memory (GPU side address & 0x3FFFFFFF) as the pointer of a control list.
+ * Build on Host: cc -include share/include/system32.h -include share/include/v3d32/controllist.h -c share/include/v3d32/controllist.c
+ * Check on Host: See controllist_test.c, which compares lists made by this encoder with the templates in vendor/v3d32.s,
+ * and checks that only changed records are written by v3d32_cl_update and v3d32_cl_patch.
+ */
+
+/* Opcodes, Same as v3d32_cl_* in vendor/v3d32.s */
+#define V3D32_CL_HALT                      0
+#define V3D32_CL_NOP                       1
+#define V3D32_CL_FLUSH                     4   // Binning Only
+#define V3D32_CL_FLUSH_ALL                 5   // Binning Only
+#define V3D32_CL_START_TILE_BINNING        6   // Binning Only
+#define V3D32_CL_INC_SEMAPHORE             7
+#define V3D32_CL_WAIT_SEMAPHORE            8
+#define V3D32_CL_BRANCH                    16
+#define V3D32_CL_BRANCH_SUBLIST            17
+#define V3D32_CL_RETURN_SUBLIST            18
+#define V3D32_CL_STORE_TILEBUFFER_MULTI    24  // Rendering Only
+#define V3D32_CL_STORE_TILEBUFFER_MULTIEND 25  // Rendering Only, Signal End of Frame
+#define V3D32_CL_STORE_TILEBUFFER_FULL     26  // Rendering Only
+#define V3D32_CL_LOAD_TILEBUFFER_FULL      27  // Rendering Only
+#define V3D32_CL_STORE_TILEBUFFER_GENERAL  28  // Rendering Only
+#define V3D32_CL_LOAD_TILEBUFFER_GENERAL   29  // Rendering Only
+#define V3D32_CL_INDEXED_PRIMITIVE         32
+#define V3D32_CL_VERTEXARRAY_PRIMITIVES    33
+#define V3D32_CL_PRIMITIVE_LIST_FORMAT     56
+#define V3D32_CL_GL_SHADERSTATE            64
+#define V3D32_CL_NV_SHADERSTATE            65
+#define V3D32_CL_VG_SHADERSTATE            66
+#define V3D32_CL_CONFIG                    96
+#define V3D32_CL_FLAT_SHADE_FLAGS          97
+#define V3D32_CL_POINTS_SIZE               98
+#define V3D32_CL_LINE_WIDTH                99
+#define V3D32_CL_RHT_X_BOUNDARY            100
+#define V3D32_CL_DEPTH_OFFSET              101
+#define V3D32_CL_CLIP_WINDOW               102
+#define V3D32_CL_VIEWPORT_OFFSET           103
+#define V3D32_CL_Z_CLIPPING_PLANE          104
+#define V3D32_CL_CLIPPER_XY                105
+#define V3D32_CL_CLIPPER_Z                 106
+#define V3D32_CL_CONFIG_BINNING            112 // Binning Only
+#define V3D32_CL_CONFIG_RENDERING          113 // Rendering Only
+#define V3D32_CL_CLEAR                     114 // Rendering Only
+#define V3D32_CL_TILE_COORDINATES          115 // Rendering Only
+
+/* Flags of Tile Binning Mode Configuration, Same as r2 of v3d32_make_cl_binning */
+#define V3D32_CL_BINNING_MULTISAMPLE       0b1
+#define V3D32_CL_BINNING_INITBLOCK_SHIFT   3   // Bit[4:3], 32 Bytes << Value
+#define V3D32_CL_BINNING_BLOCK_SHIFT       5   // Bit[6:5], 32 Bytes << Value
+
+#define V3D32_CL_TILE_STATE_SIZE           48  // Bytes per Tile
+#define V3D32_CL_TILE_ALLOCATION_SIZE      128 // Bytes per Tile, Same as v3d32_make_cl_binning_buffersize (2^7) to Prevent Overspill
+
+typedef struct v3d32_CLRecord {
+	uint32 offset; // Bytes from Start of Control List
+	uchar8 opcode;
+	uchar8 length; // Bytes Including Opcode
+	uint16 rsv16; // For 4-byte Align
+} _CLRecord;
+
+/**
+ * Return Bytes of Record Including Opcode
+ *
+ * Return: Bytes, 0 as Unknown Opcode
+ */
+uchar8 v3d32_cl_length( uchar8 opcode );
+
+/**
+ * Encoders
+ * Each encoder writes one record to the pointer and returns bytes written.
+ * If the pointer is NULL, nothing is written and only bytes are returned to calculate the size of a control list.
+ */
+uint32 v3d32_cl_encode_single( uchar8* list, uchar8 opcode ); // Records without Data, e.g., Flush and Nop
+uint32 v3d32_cl_encode_address( uchar8* list, uchar8 opcode, uint32 address ); // Records with One Word, e.g., Branch
+uint32 v3d32_cl_encode_config_binning( uchar8* list, uint32 tile_allocation, uint32 size_tile_allocation, uint32 tile_state, uchar8 width_tile, uchar8 height_tile, uchar8 flags );
+uint32 v3d32_cl_encode_clip_window( uchar8* list, uint16 left, uint16 bottom, uint16 width, uint16 height );
+uint32 v3d32_cl_encode_config( uchar8* list, uint32 flags );
+uint32 v3d32_cl_encode_viewport_offset( uchar8* list, int16 x, int16 y );
+uint32 v3d32_cl_encode_z_clipping_plane( uchar8* list, float32 min, float32 max );
+uint32 v3d32_cl_encode_vertexarray_primitives( uchar8* list, uchar8 mode, uint32 number_vertices, uint32 index_vertex );
+uint32 v3d32_cl_encode_clear( uchar8* list, uint32 color, uint32 z, uchar8 alpha, uchar8 stencil );
+uint32 v3d32_cl_encode_config_rendering( uchar8* list, uint32 address, uint16 width, uint16 height, uint16 flags );
+uint32 v3d32_cl_encode_tile_coordinates( uchar8* list, uchar8 column, uchar8 row );
+uint32 v3d32_cl_encode_store_tilebuffer_general( uchar8* list, uint16 flags, uint32 address );
+
+/**
+ * Make Whole Control List for Binning, Same Layout as the Template in vendor/v3d32.s
+ *
+ * Return: Bytes of Control List
+ */
+uint32 v3d32_cl_make_binning( uchar8* list, uint32 tile_allocation, uint32 tile_state, uint32 nv_shaderstate, uint16 width, uint16 height, uchar8 flags_binning, uint32 flags_config );
+
+/**
+ * Make Whole Control List for Rendering, Same Layout as v3d32_make_cl_rendering
+ * flags_binning is the same as the binning control list, the sub-list of each tile starts at the initial block of the tile.
+ *
+ * Return: Bytes of Control List
+ */
+uint32 v3d32_cl_make_rendering( uchar8* list, uint32 tile_allocation, uint32 address, uint16 width, uint16 height, uint16 flags, uchar8 flags_binning );
+
+/**
+ * Decode Control List to Records
+ *
+ * Return: Number of Records, -1 as Unknown Opcode, -2 as Truncated Record, -3 as Overflow of Records
+ */
+int32 v3d32_cl_decode( uchar8* list, uint32 size, _CLRecord* records, uint32 max_records );
+
+/**
+ * Search Record with Opcode
+ * nth is the order of records with the same opcode, 0 as the first.
+ *
+ * Return: Index of Record, -1 as Not Found
+ */
+int32 v3d32_cl_find( _CLRecord* records, int32 number_records, uchar8 opcode, uint32 nth );
+
+/**
+ * Patch Record with Encoded Record Only If Changed
+ * For rebuilding per frame; encode a record to a scratch, then patch, so unchanged records aren't written to GPU memory.
+ *
+ * Return: 1 as Changed, 0 as Not Changed, -1 as Error (Opcode or Length Mismatch)
+ */
+int32 v3d32_cl_patch( uchar8* list, _CLRecord* record, uchar8* encoded );
+
+/**
+ * Update Control List with Re-encoded Control List Only on Changed Records
+ * Make the whole list to a scratch by v3d32_cl_make_* or encoders, then update the list on GPU memory with the scratch.
+ * Records which are the same as the scratch are not written.
+ * If the layout differs, e.g., the number of tiles is changed, nothing is written, and the list should be remade.
+ *
+ * Return: Number of Changed Records, -1 as Layout Mismatch (Size, Opcode, or Unknown Opcode)
+ */
+int32 v3d32_cl_update( uchar8* list, uint32 size, uchar8* encoded, uint32 size_encoded );
+
+/**
+ * Bytes of Initial Block per Tile from Tile Allocation Initial Block Size, i.e., Distance of Sub-lists in Tile Allocation Memory
+ *
+ * Return: Bytes
+ */
+uint32 v3d32_cl_size_initblock( uchar8 flags_binning );
+
+/**
+ * Minimum Size of Tile Allocation Memory, Initial Blocks of All Tiles
+ * If the tile allocation memory is smaller than this, binning overspills from the start.
+ *
+ * Return: Bytes
+ */
+uint32 v3d32_cl_size_tile_allocation( uchar8 width_tile, uchar8 height_tile, uchar8 flags_binning );
+
+/**
+ * Validate Control List for Binning
+ *
+ * Return: 0 as Success, 1-8 as Error
+ * Error(1): Unknown Opcode or Truncated Record
+ * Error(2): No Tile Binning Mode Configuration Before Start Tile Binning
+ * Error(3): Tile Allocation Memory Is Not 256-byte Aligned
+ * Error(4): Tile Allocation Memory Is Smaller Than Initial Blocks (Overspill from Start)
+ * Error(5): Tile State Data Array Is Not 16-byte Aligned
+ * Error(6): Clip Window Exceeds Tiles
+ * Error(7): NV Shader State Is Not 16-byte Aligned
+ * Error(8): No Flush at Last
+ */
+uint32 v3d32_cl_validate_binning( uchar8* list, uint32 size );
+
+/**
+ * Validate Control List for Rendering
+ *
+ * Return: 0 as Success, 1-5 as Error
+ * Error(1): Unknown Opcode or Truncated Record
+ * Error(2): No Tile Rendering Mode Configuration Before Tiles
+ * Error(3): Tile Coordinates Exceed Tiles
+ * Error(4): Branch to Sub-list Is Out of Tile Allocation Memory or Not Matched with Tile Coordinates
+ * Error(5): Signal End of Frame Is Not Only at Last Tile
+ */
+uint32 v3d32_cl_validate_rendering( uchar8* list, uint32 size, uint32 tile_allocation, uint32 size_tile_allocation, uchar8 flags_binning );
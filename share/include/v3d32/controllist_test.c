@@ -0,0 +1,289 @@
+/**
+ * v3d32/controllist_test.c
+ *
+ * Author: Kenta Ishii
+ * License: MIT
+ * License URL: https://opensource.org/licenses/MIT
+ *
+ */
+
+/**
+ * Host check of controllist.c against the templates of control lists in vendor/v3d32.s.
+ * The templates are written by hand in v3d32.s, so this program reads v3d32.s as text,
+ * collects bytes from _V3D32_TML_CL_BIN to _V3D32_TML_CL_BIN_END and from _V3D32_TML_CL_RENDER to _V3D32_TML_CL_RENDER_END,
+ * and compares them with lists made by the encoder in controllist.c.
+ * Then, lists re-encoded with changed values update lists only on changed records through v3d32_cl_update and v3d32_cl_patch.
+ * Build on Host: cc -D__ARMV7=1 -include share/include/system32.h -include share/include/v3d32/controllist.h -include share/include/v3d32/controllist.c -o controllist_test share/include/v3d32/controllist_test.c
+ * Run on Host: ./controllist_test share/aloha_raspi/system32/vendor/v3d32.s
+ * Return: 0 as success, 1 as mismatch, 2 as failure on reading v3d32.s
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define CONTROLLIST_TEST_LINE    1024
+#define CONTROLLIST_TEST_SYMBOLS 64
+#define CONTROLLIST_TEST_BYTES   256
+
+typedef struct _TestSymbol {
+	char name[64];
+	long value;
+} _TestSymbol;
+
+static _TestSymbol symbols[CONTROLLIST_TEST_SYMBOLS];
+static uint32 number_symbols = 0;
+
+/* Collect ".equ v3d32_cl_*" and ".equ v3d32_make_cl_*" to Resolve Opcodes in Templates */
+static void test_symbol( char* line ) {
+	char name[64];
+	long value;
+	if ( sscanf( line, " .equ %63[A-Za-z0-9_] , %li", name, &value ) != 2 ) return;
+	if ( strncmp( name, "v3d32_cl_", 9 ) && strncmp( name, "v3d32_make_cl_", 14 ) ) return;
+	if ( number_symbols >= CONTROLLIST_TEST_SYMBOLS ) return;
+	strcpy( symbols[number_symbols].name, name );
+	symbols[number_symbols].value = value;
+	number_symbols++;
+}
+
+static int32 test_resolve( char* token, long* value ) {
+	char* end;
+	*value = strtol( token, &end, 0 );
+	if ( end != token && *end == '\0' ) return 0;
+	for ( uint32 i = 0; i < number_symbols; i++ ) {
+		if ( ! strcmp( symbols[i].name, token ) ) {
+			*value = symbols[i].value;
+			return 0;
+		}
+	}
+	return -1;
+}
+
+/* Remove Comments, "@ ..." and C-style Blocks Which May Continue to Following Lines */
+static void test_strip( char* line, uint32* in_comment ) {
+	char* src = line;
+	char* dst = line;
+	while ( *src ) {
+		if ( *in_comment ) {
+			if ( src[0] == '*' && src[1] == '/' ) {
+				*in_comment = 0;
+				src += 2;
+			} else {
+				src++;
+			}
+		} else if ( src[0] == '/' && src[1] == '*' ) {
+			*in_comment = 1;
+			src += 2;
+		} else if ( src[0] == '@' || src[0] == '\n' ) {
+			break;
+		} else {
+			*dst++ = *src++;
+		}
+	}
+	*dst = '\0';
+}
+
+/* Return: Number of Bytes Appended, -1 as Unknown Directive or Symbol */
+static int32 test_directive( char* line, uchar8* bytes, uint32 size ) {
+	char directive[64];
+	int length;
+	uint32 width;
+	if ( sscanf( line, " %63s%n", directive, &length ) != 1 ) return 0;
+	if ( directive[strlen( directive ) - 1] == ':' ) return 0; // Label
+	if ( ! strcmp( directive, ".byte" ) ) width = 1;
+	else if ( ! strcmp( directive, ".hword" ) || ! strcmp( directive, ".short" ) ) width = 2;
+	else if ( ! strcmp( directive, ".word" ) || ! strcmp( directive, ".float" ) ) width = 4;
+	else return -1;
+	uint32 count = 0;
+	char* token = strtok( line + length, ", \t" );
+	while ( token ) {
+		union { uint32 u; float32 f; } value;
+		value.u = 0;
+		if ( ! strcmp( directive, ".float" ) ) {
+			value.f = strtof( token, NULL );
+		} else {
+			long resolved;
+			if ( test_resolve( token, &resolved ) ) {
+				fprintf( stderr, "Unknown Symbol: %s\n", token );
+				return -1;
+			}
+			value.u = resolved;
+		}
+		if ( size + count + width > CONTROLLIST_TEST_BYTES ) return -1;
+		for ( uint32 i = 0; i < width; i++ ) bytes[size + count + i] = (value.u >> (i * 8)) & 0xFF;
+		count += width;
+		token = strtok( NULL, ", \t" );
+	}
+	return count;
+}
+
+/* Return: Bytes of Template, -1 as Error */
+static int32 test_template( char* path, char* label, uchar8* bytes ) {
+	char line[CONTROLLIST_TEST_LINE];
+	char label_start[64];
+	char label_end[64];
+	uint32 in_comment = 0;
+	uint32 in_template = 0;
+	int32 size = -1;
+	FILE* file = fopen( path, "r" );
+	if ( file == NULL ) return -1;
+	snprintf( label_start, sizeof(label_start), "%s:", label );
+	snprintf( label_end, sizeof(label_end), "%s_END:", label );
+	number_symbols = 0;
+	while ( fgets( line, sizeof(line), file ) ) test_symbol( line ); // Symbols Are Defined after Templates
+	rewind( file );
+	while ( fgets( line, sizeof(line), file ) ) {
+		test_strip( line, &in_comment );
+		char* head = line;
+		while ( isspace( (uchar8)*head ) ) head++;
+		if ( ! in_template ) {
+			if ( ! strncmp( head, label_start, strlen( label_start ) ) ) {
+				in_template = 1;
+				size = 0;
+			}
+			continue;
+		}
+		if ( ! strncmp( head, label_end, strlen( label_end ) ) ) break;
+		int32 count = test_directive( head, bytes, size );
+		if ( count < 0 ) {
+			size = -1;
+			break;
+		}
+		size += count;
+	}
+	fclose( file );
+	return size;
+}
+
+static uint32 test_compare( char* name, uchar8* expected, int32 size_expected, uchar8* actual, uint32 size_actual ) {
+	if ( size_expected < 0 ) {
+		printf( "%s: Failure on Reading Template\n", name );
+		return 1;
+	}
+	if ( (uint32)size_expected != size_actual || memcmp( expected, actual, size_actual ) ) {
+		printf( "%s: Mismatch, Template %d Bytes, Encoder %d Bytes\n", name, (int)size_expected, (int)size_actual );
+		for ( uint32 i = 0; i < (uint32)size_expected || i < size_actual; i++ ) {
+			printf( "  %3d: %02X %02X\n", (int)i, i < (uint32)size_expected ? expected[i] : 0, i < size_actual ? actual[i] : 0 );
+		}
+		return 1;
+	}
+	printf( "%s: OK, %d Bytes\n", name, (int)size_actual );
+	return 0;
+}
+
+static uint32 test_update() {
+	uchar8 list[CONTROLLIST_TEST_BYTES * 4];
+	uchar8 scratch[CONTROLLIST_TEST_BYTES * 4];
+	uchar8 record[16];
+	_CLRecord records[CONTROLLIST_TEST_BYTES];
+	uint32 size_list;
+	uint32 size_scratch;
+	int32 number_records;
+	int32 index;
+
+	/* Frame Buffer Is Swapped, Only Tile Rendering Mode Configuration Changes */
+	size_list = v3d32_cl_make_rendering( list, 0x1000, 0xA000, 320, 240, 0x0004, 0 );
+	size_scratch = v3d32_cl_make_rendering( scratch, 0x1000, 0xB000, 320, 240, 0x0004, 0 );
+	if ( v3d32_cl_update( list, size_list, scratch, size_scratch ) != 1 || memcmp( list, scratch, size_list ) || v3d32_cl_update( list, size_list, scratch, size_scratch ) != 0 ) {
+		printf( "Update: Rendering Is Not Changed Only on One Record\n" );
+		return 1;
+	}
+
+	/* Shader State Is Changed on Binning */
+	size_list = v3d32_cl_make_binning( list, 0x1000, 0x8000, 0x9000, 320, 240, 0, 0x009003 );
+	size_scratch = v3d32_cl_make_binning( scratch, 0x1000, 0x8000, 0x9010, 320, 240, 0, 0x009003 );
+	if ( v3d32_cl_update( list, size_list, scratch, size_scratch ) != 1 || memcmp( list, scratch, size_list ) ) {
+		printf( "Update: Binning Is Not Changed Only on One Record\n" );
+		return 1;
+	}
+
+	/* Number of Tiles Is Changed, Layout Mismatch, Nothing Is Written */
+	size_list = v3d32_cl_make_rendering( list, 0x1000, 0xA000, 320, 240, 0x0004, 0 );
+	memcpy( scratch, list, size_list );
+	size_scratch = v3d32_cl_make_rendering( scratch, 0x1000, 0xA000, 640, 240, 0x0004, 0 );
+	if ( v3d32_cl_update( list, size_list, scratch, size_scratch ) != -1 ) {
+		printf( "Update: Layout Mismatch Is Not Detected\n" );
+		return 1;
+	}
+	size_scratch = v3d32_cl_make_rendering( scratch, 0x1000, 0xA000, 320, 240, 0x0004, 0 );
+	scratch[size_scratch - 1] = V3D32_CL_STORE_TILEBUFFER_MULTI; // Same Size, Different Opcode
+	memcpy( record, list, 16 );
+	if ( v3d32_cl_update( list, size_list, scratch, size_scratch ) != -1 || memcmp( record, list, 16 ) ) {
+		printf( "Update: Opcode Mismatch Is Not Detected or List Is Written\n" );
+		return 1;
+	}
+
+	/* Patch Clear Colors, Then Same Values, Then Wrong Opcode; Second Tile Coordinates Is First Tile After Dummy Store */
+	number_records = v3d32_cl_decode( list, size_list, records, CONTROLLIST_TEST_BYTES );
+	index = v3d32_cl_find( records, number_records, V3D32_CL_CLEAR, 0 );
+	if ( index < 0 || v3d32_cl_find( records, number_records, V3D32_CL_TILE_COORDINATES, 1 ) != index + 6 || v3d32_cl_find( records, number_records, V3D32_CL_CLEAR, 1 ) != -1 ) {
+		printf( "Patch: Records Are Not Found\n" );
+		return 1;
+	}
+	v3d32_cl_encode_clear( record, 0xFF00FF00, 0, 0, 0 );
+	if ( v3d32_cl_patch( list, &records[index], record ) != 1 || v3d32_cl_patch( list, &records[index], record ) != 0 || memcmp( list + records[index].offset, record, records[index].length ) ) {
+		printf( "Patch: Clear Colors Are Not Patched Only Once\n" );
+		return 1;
+	}
+	v3d32_cl_encode_tile_coordinates( record, 1, 1 );
+	if ( v3d32_cl_patch( list, &records[index], record ) != -1 ) {
+		printf( "Patch: Wrong Opcode Is Not Detected\n" );
+		return 1;
+	}
+
+	printf( "Update and Patch: OK\n" );
+	return 0;
+}
+
+int main( int argc, char** argv ) {
+	uchar8 template[CONTROLLIST_TEST_BYTES];
+	uchar8 list[CONTROLLIST_TEST_BYTES * 4];
+	uint32 result = 0;
+	if ( argc < 2 ) {
+		fprintf( stderr, "Usage: %s vendor/v3d32.s\n", argv[0] );
+		return 2;
+	}
+
+	/* Binning: Zeros and Configuration Bits (0x03, 0x90, 0x00) in Template */
+	int32 size_template = test_template( argv[1], "_V3D32_TML_CL_BIN", template );
+	if ( size_template < 0 ) return 2;
+	uint32 size_list = v3d32_cl_make_binning( list, 0, 0, 0, 0, 0, 0, 0x009003 );
+	result |= test_compare( "Binning", template, size_template, list, size_list );
+
+	/* Rendering: No Tile in Template, Tiles Are Appended by v3d32_make_cl_rendering */
+	size_template = test_template( argv[1], "_V3D32_TML_CL_RENDER", template );
+	if ( size_template < 0 ) return 2;
+	size_list = v3d32_cl_make_rendering( list, 0, 0, 0, 0, 0, 0 );
+	result |= test_compare( "Rendering", template, size_template, list, size_list );
+
+	/* Bytes of Tile Allocation Memory per Tile */
+	long shift;
+	if ( test_resolve( "v3d32_make_cl_binning_buffersize", &shift ) || 1 << shift != V3D32_CL_TILE_ALLOCATION_SIZE ) {
+		printf( "Tile Allocation: Mismatch, v3d32_make_cl_binning_buffersize Is Not Same as V3D32_CL_TILE_ALLOCATION_SIZE\n" );
+		result |= 1;
+	} else {
+		printf( "Tile Allocation: OK, %d Bytes per Tile\n", V3D32_CL_TILE_ALLOCATION_SIZE );
+	}
+
+	/* Made Lists Should Pass Validation with Each Initial Block Size */
+	for ( uchar8 initblock = 0; initblock < 4; initblock++ ) {
+		uchar8 flags_binning = initblock << V3D32_CL_BINNING_INITBLOCK_SHIFT;
+		uint32 tile_allocation = 0x1000;
+		size_list = v3d32_cl_make_binning( list, tile_allocation, 0x8000, 0x9000, 320, 240, flags_binning, 0x009003 );
+		uint32 size_tile_allocation = v3d32_cl_get32( list + 5 ); // Size in Tile Binning Mode Configuration
+		uint32 error = v3d32_cl_validate_binning( list, size_list );
+		size_list = v3d32_cl_make_rendering( list, tile_allocation, 0xA000, 320, 240, 0x0004, flags_binning );
+		error |= v3d32_cl_validate_rendering( list, size_list, tile_allocation, size_tile_allocation, flags_binning ) << 4;
+		if ( error ) {
+			printf( "Validation (Initial Block %d Bytes): Error 0x%02X\n", (int)v3d32_cl_size_initblock( flags_binning ), (int)error );
+			result |= 1;
+		} else {
+			printf( "Validation (Initial Block %d Bytes): OK\n", (int)v3d32_cl_size_initblock( flags_binning ) );
+		}
+	}
+
+	result |= test_update();
+
+	return result;
+}
@@ -177,6 +177,7 @@ uint32 pre_synthe_table_index[PRE_SYNTHE_NUMBER] = {
 
 synthe_code** synthe_code_table;
 uint32* synthelen_table;
+uint32* synthevoice_table; // Zero as Decoded Binaries, Others as Number of Voices of Pre-code
 int32 tempo_count; // Use Signed Integer (Using Comparison in IF Statement)
 int32 tempo_count_reload;
 uint32 tempo;
@@ -194,19 +195,22 @@ int32 _user_start() {
 	/* Initialization of Global Variables */
 	synthe_code_table = (synthe_code**)heap32_malloc( 128 );
 	synthelen_table = (uint32*)heap32_malloc( 128 );
+	synthevoice_table = (uint32*)heap32_malloc( 128 );
 
+	/* Pre-code Is Not Decoded in Advance, Synthesizer Code Is Made on Each Beat in _syntheplay */
 	for ( uint32 i = 0; i < PRE_SYNTHE_NUMBER; i++ ) {
 		number_voices = pre_synthe_voice_table[i];
+		table_index = pre_synthe_table_index[i];
 		if ( number_voices ) {
-			temp_synthe_code = sts32_synthedecodelr( pre_synthe_table[i], number_voices );
+			temp_synthe_code = (synthe_code*)pre_synthe_table[i];
+			// To Get Proper Latency, Get Lengths in Advance
+			synthelen_table[table_index] = sts32_synthebeatlenlr( pre_synthe_table[i], number_voices );
 		} else {
 			temp_synthe_code = (synthe_code*)pre_synthe_table[i]; // Decoded Binaries
+			synthelen_table[table_index] = sts32_synthelen( temp_synthe_code );
 		}
-		if ( (uint32)temp_synthe_code == -1 ) return EXIT_FAILURE;
-		table_index = pre_synthe_table_index[i];
 		synthe_code_table[table_index] = temp_synthe_code;
-		// To Get Proper Latency, Get Lengths in Advance
-		synthelen_table[table_index] = arm32_udiv( sts32_synthelen( temp_synthe_code ), number_voices );
+		synthevoice_table[table_index] = number_voices;
 	}
 	tempo_count = TEMPO_COUNT_DEFAULT;
 	tempo_count_reload = TEMPO_COUNT_DEFAULT;
@@ -218,15 +222,13 @@ int32 _user_start() {
 
 	while ( true ) {
 		// Time of _synthewave_i2s and synthemidi Is Up to Appx. 55us with Zero W in My Experience
+		// MIDI IN Is Parsed in IRQ (os_irq), and Events Are Applied at Timestamped Samples in _synthewave_*
 #ifdef __SOUND_I2S
 		_synthewave_i2s( STS32_DIGITALMOD_MEDIUM, STS32_TONE, 8 );
-		_synthemidi( OS_RESET_MIDI_CHANNEL, STS32_I2S, 8 );
 #elif defined(__SOUND_PWM)
 		_synthewave_pwm( STS32_DIGITALMOD_MEDIUM, STS32_TONE, 8 );
-		_synthemidi( OS_RESET_MIDI_CHANNEL, STS32_PWM, 8 );
 #elif defined(__SOUND_JACK)
 		_synthewave_pwm( STS32_DIGITALMOD_MEDIUM, STS32_TONE, 8 );
-		_synthemidi( OS_RESET_MIDI_CHANNEL, STS32_PWM, 8 );
 #endif
 
 		/* Detect Falling Edge of GPIO */
@@ -264,7 +266,11 @@ int32 _user_start() {
 				} else { // Symbal, etc.
 					STS32_LANE = 3;
 				}
-				_syntheset( synthe_code_table[detect_parallel], synthelen_table[detect_parallel], 0, 1 );
+				if ( synthevoice_table[detect_parallel] ) {
+					_synthesetpre( (synthe_precode**)synthe_code_table[detect_parallel], synthelen_table[detect_parallel], 0, 1 );
+				} else {
+					_syntheset( synthe_code_table[detect_parallel], synthelen_table[detect_parallel], 0, 1 );
+				}
 			} else if ( detect_parallel == 0b11111 ) { // 0b11111 (31)
 				STS32_LANE = 0;
 				_syntheclear( 0, 2 );
@@ -289,7 +295,11 @@ int32 _user_start() {
 			} else if ( detect_parallel > 0 ) { // 1-28
 				// Loop
 				STS32_LANE = 0;
-				_syntheset( synthe_code_table[detect_parallel], synthelen_table[detect_parallel], 0, -1 );
+				if ( synthevoice_table[detect_parallel] ) {
+					_synthesetpre( (synthe_precode**)synthe_code_table[detect_parallel], synthelen_table[detect_parallel], 0, -1 );
+				} else {
+					_syntheset( synthe_code_table[detect_parallel], synthelen_table[detect_parallel], 0, -1 );
+				}
 			} // Do Nothing at 0 for Preventing Chattering If Any Mechanical Switch
 			detect_parallel = 0;
 		}
@@ -60,6 +60,10 @@ os_reset:
 	mov r1, #0
 	str r1, [r0, #equ32_interrupt_fiq_control]       @ Disable ALL FIQs
 
+	/* Enable UART IRQ for MIDI IN */
+	mov r1, #1<<25                                   @ UART IRQ #57
+	str r1, [r0, #equ32_interrupt_enable_irqs2]
+
 	/**
 	 * GPIO
 	 */
@@ -175,6 +179,18 @@ os_reset:
 	bl sts32_synthemidi_malloc
 	pop {r0-r3}
 
+	push {r0-r3}
+	mov r0, #64                                               @ 64 Events
+	bl sts32_synthemidi_eventmalloc
+	pop {r0-r3}
+
+	/* Interrupts on Reaching 2 Bytes of RxFIFO (0b000) and Rx Timeout */
+	push {r0-r3}
+	mov r0, #0b000<<equ32_uart0_ifls_rxiflsel|0b000<<equ32_uart0_ifls_txiflsel @ Trigger Points of Both FIFOs Levels to 1/8
+	mov r1, #equ32_uart0_intr_rx|equ32_uart0_intr_rt
+	bl uart32_uartsetint
+	pop {r0-r3}
+
 	pop {pc}
 
 /* From share/include/sts32.h (Matched at Linker), C Compiler Implicitly Adds ".globl" Attribute to Variables Globally Scoped, Which Use Memory Space */
@@ -190,6 +206,17 @@ os_debug:
 
 os_irq:
 	push {r0-r12,lr}
+
+	/* Parse MIDI IN to Timestamped Events, Applied on Rendering by sts32_synthewave_* */
+	ldr r0, OS_RESET_MIDI_CHANNEL
+.ifdef __SOUND_I2S
+	mov r1, #1                                                @ PCM Mode
+.else
+	mov r1, #0                                                @ PWM Mode
+.endif
+	mov r2, #8                                                @ Number of Voices
+	bl sts32_synthemidi_event
+
 	pop {r0-r12,pc}
 
 os_fiq:
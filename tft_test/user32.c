@@ -92,6 +92,7 @@ int32 _user_start()
 	_RenderBuffer *renderbuffer = (_RenderBuffer*)heap32_malloc( draw32_renderbuffer );
 	draw32_renderbuffer_init( renderbuffer, TFT_WIDTH, TFT_HEIGHT, 16 );
 	_attach_buffer( renderbuffer );
+	_tftshadow_type1( TFT_WIDTH, TFT_HEIGHT ); // Only Changed Windows Are Sent by _tftupdate_type1
 
 	life_size = life_height * life_width;
 	life2 = (uchar8*)heap32_malloc( life_size / 4 ); // One Unit of This Malloc is One Word (4 Bytes)
@@ -166,7 +167,7 @@ int32 _user_start()
 				arm32_dsb();
 			}
 		}
-		_tftimage_type1( renderbuffer->addr, TFT_SIZE );
+		_tftupdate_type1( renderbuffer->addr );
 		_sleep( 250000 );
 	}
 
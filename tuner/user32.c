@@ -9,10 +9,15 @@
 
 #include "system32.h"
 #include "system32.c"
+#include "arm32/perf.h"
+#include "arm32/perf.c"
 
 extern bool TUNER_FIQ_FLAG_BACK;
 extern obj TUNER_FIQ_BUFFER;
 
+#define TUNER_PERF_FFT  0 // Marker of FFT, Reordering, and Coefficients
+#define TUNER_PERF_PASS 1 // Marker of One Pass from FFT to Update of LCD
+
 char8 scale88_chromatic [] =
 	"A 0\0A#0\0B 0\0C 1\0C#1\0D 1\0D#1\0E 1\0F 1\0F#1\0G 1\0G#1\0"\
 	"A 1\0A#1\0B 1\0C 2\0C#2\0D 2\0D#2\0E 2\0F 2\0F#2\0G 2\0G#2\0"\
@@ -80,18 +85,18 @@ int32 _user_start()
 	_lcdinit( false, true );
 	_lcddisplay( LCD32_DISPLAY_ON|LCD32_DISPLAY_CURSOR_ON|LCD32_DISPLAY_BLINK_ON );
 	_lcdentry( LCD32_ENTRY_INCREMENT|LCD32_ENTRY_SHIFT_CURSOR );
-	_lcdposition( 0x40 );
-	_lcdstring( "ALOHA!", 6 );
-	_lcdhome();
-	_lcdchargenerator( 0x08 ); // CGRAM2
-	_lcdstring( special_character_0, 8 );
-	_lcdposition( 0x04 );
-	_lcdstring( "\x1", 1 );
+	_lcdasyncinit( 61 ); // Tick Is FIQ, 16384Hz
+	_lcdshadow( 0x40, "ALOHA!", 6 );
+	_lcdshadowcg( 0x08, special_character_0, 8 ); // CGRAM2
+	_lcdshadow( 0x04, "\x1", 1 );
+	_lcdupdate();
+	_perf_init( ARM32_PERF_DCACHE_MISS, ARM32_PERF_BRANCH_MISS );
 	
 	while(True) {
 		if ( TUNER_FIQ_FLAG_BACK == flag_flip ) {
 
 			_stopwatch_start();
+			_perf_begin( TUNER_PERF_PASS );
 
 			flag_flip = flag_flip ^ true;
 
@@ -100,6 +105,7 @@ int32 _user_start()
 //print32_debug_hexa( TUNER_FIQ_BUFFER, 0, 24, 8 );
 
 			// One Set of FFT
+			_perf_begin( TUNER_PERF_FFT );
 			fft32_fft( TUNER_FIQ_BUFFER, imaginary_zeros, 15, tables_sin, tables_cos );
 
 //print32_debug_hexa( TUNER_FIQ_BUFFER, 0, 48, 8 );
@@ -109,6 +115,7 @@ int32 _user_start()
 			//fft32_change_order( imaginary_zeros, 32768 );
 			//fft32_coefficient( imaginary_zeros, 32768 );
 			arm32_dsb();
+			_perf_end( TUNER_PERF_FFT );
 
 			// Make Power Spectrum
 			//fft32_powerspectrum( TUNER_FIQ_BUFFER, imaginary_zeros, 32768 );
@@ -145,16 +152,18 @@ print32_string( scale88_chromatic + ( ( keynumber_int - 1 ) << 2 ), 100, 136, 3
 print32_string( scale101_cent + ( ( cent_int + 50 ) << 2 ), 100, 148, 3 );
 
 			// LCD Display
-			_lcdhome();
-			_lcdstring( scale88_chromatic + ( ( keynumber_int - 1 ) << 2 ), 3 );
-			_lcdstring( " ", 1 );
-			_lcdstring( scale101_cent + ( ( cent_int + 50 ) << 2 ), 3 );
+			_lcdshadow( 0x00, scale88_chromatic + ( ( keynumber_int - 1 ) << 2 ), 3 );
+			_lcdshadow( 0x03, " ", 1 );
+			_lcdshadow( 0x04, scale101_cent + ( ( cent_int + 50 ) << 2 ), 3 );
+			_lcdupdate();
 
 			heap32_mfill( TUNER_FIQ_BUFFER, 0 );
 			heap32_mfill( imaginary_zeros, 0 );
 
+			_perf_end( TUNER_PERF_PASS );
 			uint32 time = _stopwatch_end();
 print32_debug( time, 0, 36 );
+arm32_perf_report( ARM32_PERF_BUFFER, 0, 172, false );
 //print32_debug_hexa( TUNER_FIQ_BUFFER, 0, 48, 8 );
 //print32_debug_hexa( TUNER_FIQ_BUFFER + 16320 * 4, 0, 72, 260 );
 		}
@@ -122,11 +122,6 @@ os_irq:
 os_fiq:
 	push {r0-r7,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	/* Clear Timer Interrupt */
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_armtimer_base
@@ -144,6 +139,9 @@ os_fiq:
 
 	bl tuner_fiqhandler
 
+	/* Clock Out Queued Commands of LCD */
+	bl lcd32_lcdtick
+
 	macro32_dsb ip
 
 	pop {r0-r7,pc}
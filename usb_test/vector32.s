@@ -272,11 +272,6 @@ macro32_debug r0 500 224
 os_irq:
 	push {r0-r12,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_gpio_base
 	ldr r1, [r0, #equ32_gpio_gpeds0]                               @ Clear GPIO Event Detect
@@ -289,11 +284,6 @@ os_irq:
 os_fiq:
 	push {r0-r7,lr}
 
-.ifdef __ARMV6
-	macro32_invalidate_instruction_all ip
-	macro32_dsb ip
-.endif
-
 	mov r0, #equ32_peripherals_base
 	add r0, r0, #equ32_armtimer_base
 
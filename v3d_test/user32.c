@@ -39,6 +39,7 @@ typedef struct user32_Legend3D {
 
 /* Declare Unique Functions */
 void va_set_triangle3d( _GPUMemory* vertex_array, float32* vertices, uint32 num_vertex, _Legend3D* legend3d, obj mat_p_v, uint32 width_pixel, uint32 height_pixel );
+void vertices_to_soa( float32* vertices, uint32 num_vertex );
 void legend3D_change_position( _Legend3D* legend3d );
 
 /* Declare Unique Global Variables, Zero Can't Be Stored If You Want to Define with Declaration */
@@ -52,7 +53,7 @@ uint32 count_update;
  *              Multiplication of matrices needs to exchange Matrix 1 and Matrix 2 to get the same answer as column order.
  */
 
-// X, Y, Z, S, T, Index of Images
+// X, Y, Z, S, T, Index of Images, Converted to Structure of Arrays on Start
 float32 cube_vertices[] =
 {
 		// Front
@@ -110,7 +111,7 @@ float32 cube_vertices[] =
 		 0.25f, -0.25f,  0.25f, 1.0f, 1.0f, 1.0f
 };
 
-// X, Y, Z, S, T, Index of Images
+// X, Y, Z, S, T, Index of Images, Converted to Structure of Arrays on Start
 float32 background_vertices[] =
 {
 		-1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
@@ -135,7 +136,8 @@ int32 _user_start()
 
 	// Declare and Define Local Variables
 	_ObjectV3D *objectv3d;
-	_GPUMemory *vertex_array;
+	_GPUMemory *vertex_arrays[2]; // Double Buffered, Filled While Another Is Rendered
+	uint32 va_index = 0;
 	_GPUMemory *additional_uniforms;
 	_GPUMemory *overspillmemory;
 	_FragmentShader *fragmentshader;
@@ -161,8 +163,14 @@ int32 _user_start()
 	obj mat_projection = mtx32_perspective3d( 75.0f, 1.3333333f, 0.2f, 4.0f );
 	obj mat_p_v = mtx32_multiply( mat_projection, mat_view, 4 ); // Projection, View
 
-	vertex_array = (_GPUMemory*)heap32_malloc( _wordsizeof( _GPUMemory ) );
-	_gpumemory_init( vertex_array, 1872, 16, 0xC );
+	// Vertices to Structure of Arrays for geo32_shade3d
+	vertices_to_soa( cube_vertices, 36 );
+	vertices_to_soa( background_vertices, 6 );
+
+	vertex_arrays[0] = (_GPUMemory*)heap32_malloc( _wordsizeof( _GPUMemory ) );
+	_gpumemory_init( vertex_arrays[0], 1872, 16, 0xC );
+	vertex_arrays[1] = (_GPUMemory*)heap32_malloc( _wordsizeof( _GPUMemory ) );
+	_gpumemory_init( vertex_arrays[1], 1872, 16, 0xC );
 
 	additional_uniforms = (_GPUMemory*)heap32_malloc( _wordsizeof( _GPUMemory ) );
 	_gpumemory_init( additional_uniforms, 256, 16, 0xC );
@@ -258,6 +266,11 @@ int32 _user_start()
 	_control_qpul2cache( 0b101 );
 	_clear_qpucache( 0x0F0F0F0F );
 
+	// Values Retained in Control Lists, Only Changed Ones Are Patched by _execute_cl_frame
+	_clear_cl_rendering( COLOR32_CYAN, 0xFFFFFF, 0x0, 0x0 );
+	_set_nv_shaderstate( fragmentshader->gpu, vertex_arrays[0]->gpu, 3, 24 );
+	_set_overspillmemory( overspillmemory->gpu, 0x20000 );
+
 	va_count = 0; // Reset
 	while(True) {
 		if ( OS_FIQ_ONEFRAME ) {
@@ -267,24 +280,21 @@ int32 _user_start()
 			if ( ++count_update >= MAXCOUNT_UPDATE ) { // Increment Count Before, Then Compare with Number
 _stopwatch_start();
 
-				// Actual Rendering
-				_clear_cl_rendering( COLOR32_CYAN, 0xFFFFFF, 0x0, 0x0 );
-				_setbuffer_cl_rendering( FB32_FRAMEBUFFER->addr );
-				_set_nv_shaderstate( fragmentshader->gpu, vertex_array->gpu, 3, 24 );
-				_set_overspillmemory( overspillmemory->gpu, 0x20000 );
-				_execute_cl_binning( 4, va_count, 0, 0xFF0000 ); // TRIANGLE, 42 Vertices, Index from 0
-				_execute_cl_rendering( 0xFF0000 ); // The Point to Actually Draw Using Vertices
+				// Actual Rendering, Returns After Binning, Rendering Continues with Vertices Filled at Last
+				_execute_cl_frame( FB32_FRAMEBUFFER->addr, va_count, vertex_arrays[va_index]->gpu, V3D32_ASYNC|0xFF0000 );
+				va_index ^= 1;
 
-				// Calculate Vertices, Z Sort is Needed for Proper Drawing
+				// Calculate Vertices to Another Array While Rendering, Z Sort is Needed for Proper Drawing
 				va_count = 0; // Reset
-				va_set_triangle3d( vertex_array, background_vertices, 6, background, mat_identity4, width_pixel, height_pixel );
-				va_set_triangle3d( vertex_array, cube_vertices, 36, cubes[1], mat_p_v, width_pixel, height_pixel );
-				va_set_triangle3d( vertex_array, cube_vertices, 36, cubes[0], mat_p_v, width_pixel, height_pixel );
+				va_set_triangle3d( vertex_arrays[va_index], background_vertices, 6, background, mat_identity4, width_pixel, height_pixel );
+				va_set_triangle3d( vertex_arrays[va_index], cube_vertices, 36, cubes[1], mat_p_v, width_pixel, height_pixel );
+				va_set_triangle3d( vertex_arrays[va_index], cube_vertices, 36, cubes[0], mat_p_v, width_pixel, height_pixel );
 
 				legend3D_change_position( cubes[0] );
 				legend3D_change_position( cubes[1] );
 
 uint32 time = _stopwatch_end();
+_wait_cl_rendering( 0xFF0000 ); // Print After Rendering
 String num_string = cvt32_int32_to_string_deci( time, 0, 0 );
 print32_string( num_string, 0, 0, str32_strlen( num_string ) );
 //print32_debug_hexa( FB32_FRAMEBUFFER->addr + ((800 * 324) + 400)*4, 0, 64, 256 );
@@ -301,8 +311,11 @@ heap32_mfree( (obj)num_string );
 	heap32_mfree( mat_view );
 	heap32_mfree( mat_projection );
 	heap32_mfree( mat_p_v );
-	_gpumemory_free( vertex_array );
-	heap32_mfree( (obj)vertex_array );
+	_wait_cl_rendering( 0xFF0000 );
+	_gpumemory_free( vertex_arrays[0] );
+	heap32_mfree( (obj)vertex_arrays[0] );
+	_gpumemory_free( vertex_arrays[1] );
+	heap32_mfree( (obj)vertex_arrays[1] );
 	_gpumemory_free( additional_uniforms );
 	heap32_mfree( (obj)additional_uniforms );
 	_gpumemory_free( overspillmemory );
@@ -330,79 +343,36 @@ heap32_mfree( (obj)num_string );
 }
 
 void va_set_triangle3d( _GPUMemory* vertex_array, float32* vertices, uint32 num_vertex, _Legend3D* legend3d, obj mat_p_v, uint32 width_pixel, uint32 height_pixel ) {
-	float32 *vector_xyzw = (float32*)heap32_malloc( 4 );
-	float32 *result;
-	int16 int_x;
-	int16 int_y;
-	float32 width_float = vfp32_u32tof32( width_pixel );
-	float32 height_float = vfp32_u32tof32( height_pixel );
-	obj mat_translate = mtx32_translate3d( (obj)legend3d->position );
-	obj mat_scale = mtx32_scale3d( (obj)legend3d->scale );
+	obj mat_model = heap32_malloc( 16 );
+	obj mat_scale = heap32_malloc( 16 );
 	obj versor = mtx32_versor( legend3d->versor_angle, (obj)legend3d->versor_vector );
 	obj mat_versor = mtx32_versortomatrix( versor );
-	obj mat_t_r = mtx32_multiply( mat_translate, mat_versor, 4 ); // Translate and Rotate (Versor)
-	obj mat_model = mtx32_multiply( mat_t_r, mat_scale, 4 );
-	obj mat_p_v_m = mtx32_multiply( mat_p_v, mat_model, 4 ); // Projection, View, Model
-
-	for ( uint32 i = 0; i < num_vertex; i++ ) {
 
-		/* X of Vector*/
-		vector_xyzw[0] = vertices[i*6];
-
-		/* Y of Vector */
-		vector_xyzw[1] = vertices[i*6+1];
-
-		/* Z of Vector */
-		vector_xyzw[2] = vertices[i*6+2];
-
-		/* W of Vector */
-		vector_xyzw[3] = 1.0f;
-
-		result = (float32*)mtx32_multiply_vec( mat_p_v_m, (obj)vector_xyzw, 4 );
-
-		/* Divide X, Y, Z by W to Normalize */
-		result[0] = vfp32_fdiv( result[0], result[3] ); // X
-		result[1] = vfp32_fdiv( result[1], result[3] ); // Y
-		result[2] = vfp32_fdiv( result[2], result[3] ); // Z
-
-		/* Software (-1.0f, 1.0f) Coordinate to Hardware (0.0f, 1.0f) Coordinate, Flip Y and Z Coordinate */
-		result[0] = vfp32_fadd( result[0], 1.0f );
-		result[1] = vfp32_fadd( result[1], 1.0f );
-		result[2] = vfp32_fadd( result[2], 1.0f );
-		result[0] = vfp32_fdiv( result[0], 2.0f );
-		result[1] = vfp32_fdiv( result[1], 2.0f );
-		result[2] = vfp32_fdiv( result[2], 2.0f );
-		result[1] = vfp32_fsub( result[1], 1.0f );
-		result[1] = vfp32_fmul( result[1], -1.0f );
-		result[2] = vfp32_fsub( result[2], 1.0f );
-		result[2] = vfp32_fmul( result[2], -1.0f );
-
-		/* Multiply 0.0 to 1.0 Coordinates by Actual Width and Height of Framebuffer, Convert Float to Integer */
-		int_x = vfp32_f32tos32( vfp32_fmul( result[0], width_float ) );
-		int_y = vfp32_f32tos32( vfp32_fmul( result[1], height_float ) );
-
-		vertex_array->arm[va_count*6].u32 = int_x*16|(int_y*16)<<16; // X and Y
-		vertex_array->arm[va_count*6+1].f32 = result[2]; // Z
-		vertex_array->arm[va_count*6+2].f32 = 1.0f; // W
-		vertex_array->arm[va_count*6+3].f32 = vertices[i*6+3]; // S
-		vertex_array->arm[va_count*6+4].f32 = vertices[i*6+4]; // T
-		vertex_array->arm[va_count*6+5].f32 = vertices[i*6+5]; // Index of Back Color
-		va_count++;
-
-		heap32_mfree( (obj)result );
-		arm32_dsb();
-	}
+	/* Build Model Matrix in Place, No Allocation per Multiplication */
+	mtx32_translate3d_into( (obj)legend3d->position, mat_model );
+	mtx32_scale3d_into( (obj)legend3d->scale, mat_scale );
+	mtx32_multiply4_into( mat_model, mat_versor, mat_model ); // Translate and Rotate (Versor)
+	mtx32_multiply4_into( mat_model, mat_scale, mat_model );
+	mtx32_multiply4_into( mat_p_v, mat_model, mat_model ); // Projection, View, Model
 
-print32_debug( mat_versor, 0, 50 );
+	/* Transfer, Divide by W, Map to Viewport, and Cull Back Faces, Shaded Vertices Are Written Directly */
+	va_count += geo32_shade3d( (obj)vertices, num_vertex, mat_model, (obj)&vertex_array->arm[va_count*6], width_pixel, height_pixel, GEO32_CCW );
+	arm32_dsb();
 
-	heap32_mfree( (obj)vector_xyzw );
-	heap32_mfree( mat_translate );
+	heap32_mfree( mat_model );
 	heap32_mfree( mat_scale );
-	heap32_mfree( mat_t_r );
 	heap32_mfree( versor );
 	heap32_mfree( mat_versor );
-	heap32_mfree( mat_model );
-	heap32_mfree( mat_p_v_m );
+}
+
+void vertices_to_soa( float32* vertices, uint32 num_vertex ) {
+	// X, Y, Z, S, T, Index of Images for Each Vertex to Arrays of Each Element
+	float32 *soa = (float32*)heap32_malloc( num_vertex * 6 );
+	for ( uint32 i = 0; i < num_vertex; i++ ) {
+		for ( uint32 j = 0; j < 6; j++ ) soa[j*num_vertex+i] = vertices[i*6+j];
+	}
+	for ( uint32 i = 0; i < num_vertex * 6; i++ ) vertices[i] = soa[i];
+	heap32_mfree( (obj)soa );
 }
 
 void legend3D_change_position( _Legend3D* legend3d ) {